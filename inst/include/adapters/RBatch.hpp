@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_RBATCH_HPP
+#define MPCR_RBATCH_HPP
+
+
+#include <operations/BatchLinearAlgebra.hpp>
+#include <Rcpp.h>
+
+
+/**
+ * @brief
+ * R-Adapter for batched matrix-matrix multiplication, C[i] = alpha *
+ * op(A[i]) %*% op(B[i]) + beta * C[i]
+ *
+ * @param[in] aInputA
+ * List of MPCR Matrices A
+ * @param[in] aInputB
+ * List of MPCR Matrices B
+ * @param[in] aInputC
+ * List of MPCR Matrices C, or R_NilValue if beta is zero
+ * @param[in] aTransposeA
+ * if true, op(A) = t(A)
+ * @param[in] aTransposeB
+ * if true, op(B) = t(B)
+ * @param[in] aAlpha
+ * Scalar alpha
+ * @param[in] aBeta
+ * Scalar beta
+ *
+ * @returns
+ * List of MPCR Matrices C
+ */
+std::vector <DataType>
+RBatchGemm(Rcpp::ListOf <SEXP> aInputA, Rcpp::ListOf <SEXP> aInputB,
+           SEXP aInputC, const bool &aTransposeA, const bool &aTransposeB,
+           const double &aAlpha, const double &aBeta);
+
+/**
+ * @brief
+ * R-Adapter for batched Cholesky decomposition
+ *
+ * @param[in] aInputs
+ * List of MPCR symmetric positive definite Matrices
+ * @param[in] aUpperTriangle
+ * if true, the upper factors are returned, otherwise the lower ones
+ *
+ * @returns
+ * List of MPCR Cholesky factors
+ */
+std::vector <DataType>
+RBatchCholesky(Rcpp::ListOf <SEXP> aInputs, const bool &aUpperTriangle);
+
+/**
+ * @brief
+ * R-Adapter for batched triangular solve
+ *
+ * @param[in] aInputA
+ * List of MPCR triangular Matrices
+ * @param[in] aInputB
+ * List of MPCR Matrices B
+ * @param[in] aUpperTriangle
+ * if true, A is upper triangular, otherwise lower triangular
+ * @param[in] aTranspose
+ * if true, t(A) is used
+ * @param[in] aSide
+ * 'L' to solve op(A) X = alpha B , 'R' to solve X op(A) = alpha B
+ * @param[in] aAlpha
+ * Scalar alpha
+ *
+ * @returns
+ * List of MPCR Matrices X
+ */
+std::vector <DataType>
+RBatchTrsm(Rcpp::ListOf <SEXP> aInputA, Rcpp::ListOf <SEXP> aInputB,
+           const bool &aUpperTriangle, const bool &aTranspose,
+           const char &aSide, const double &aAlpha);
+
+/**
+ * @brief
+ * R-Adapter for batched general linear solve A[i] X[i] = B[i]
+ *
+ * @param[in] aInputA
+ * List of MPCR square Matrices
+ * @param[in] aInputB
+ * List of MPCR Matrices or vectors B
+ *
+ * @returns
+ * List of MPCR Matrices X
+ */
+std::vector <DataType>
+RBatchSolve(Rcpp::ListOf <SEXP> aInputA, Rcpp::ListOf <SEXP> aInputB);
+
+/**
+ * @brief
+ * R-Adapter for batched symmetric eigen decomposition
+ *
+ * @param[in] aInputs
+ * List of MPCR symmetric Matrices
+ * @param[in] aOnlyValues
+ * if true, only the eigen values are computed
+ *
+ * @returns
+ * List holding the eigen values of every matrix, followed by their eigen
+ * vectors if requested
+ */
+std::vector <DataType>
+RBatchEigen(Rcpp::ListOf <SEXP> aInputs, const bool &aOnlyValues);
+
+
+#endif //MPCR_RBATCH_HPP
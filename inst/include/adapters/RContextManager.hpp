@@ -22,4 +22,10 @@ GetOperationPlacement() {
 }
 
 
+void
+FreeScratchMemory() {
+    mpcr::kernels::ContextManager::GetOperationContext()->FreeScratchBuffersHost();
+}
+
+
 #endif //MPCR_RCONTEXTMANAGER_HPP
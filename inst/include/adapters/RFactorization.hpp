@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_RFACTORIZATION_HPP
+#define MPCR_RFACTORIZATION_HPP
+
+
+#include <data-units/MPCRFactorization.hpp>
+
+
+/**
+ * @brief
+ * Decompose an MPCR Matrix once, the returned handle keeps the factors
+ * resident for repeated solves.
+ *
+ * @param[in] aInput
+ * MPCR Matrix
+ * @param[in] aType
+ * Decomposition type, "lu", "chol" or "qr"
+ *
+ * @returns
+ * MPCR Factorization handle
+ */
+MPCRFactorization *
+RFactorize(DataType *aInput, const std::string &aType);
+
+/**
+ * @brief
+ * Solve A X = B using the factors held by the handle, the inverse of A is
+ * returned if B is NULL.
+ *
+ * @param[in] aFactor
+ * MPCR Factorization handle
+ * @param[in] aInputB
+ * MPCR Matrix or vector B, or R_NilValue
+ *
+ * @returns
+ * MPCR Matrix X in the precision of the factors
+ */
+DataType *
+RFactorizationSolve(MPCRFactorization *aFactor, SEXP aInputB);
+
+/**
+ * @brief
+ * Determinant of the decomposed matrix from the stored factors.
+ *
+ * @param[in] aFactor
+ * MPCR Factorization handle
+ * @param[in] aLogarithm
+ * if true, the logarithm of the modulus is returned
+ *
+ * @returns
+ * vector holding the modulus followed by the sign
+ */
+std::vector <double>
+RFactorizationDeterminant(MPCRFactorization *aFactor,
+                          const bool &aLogarithm);
+
+/**
+ * @brief
+ * Reciprocal condition number of the decomposed matrix from the stored
+ * factors.
+ *
+ * @param[in] aFactor
+ * MPCR Factorization handle
+ * @param[in] aNorm
+ * "O" for the 1-norm, "I" for the infinity norm
+ *
+ * @returns
+ * Reciprocal condition number
+ */
+double
+RFactorizationRCond(MPCRFactorization *aFactor, const std::string &aNorm);
+
+/**
+ * @brief
+ * Print a one line description of the factorization.
+ *
+ * @param[in] aFactor
+ * MPCR Factorization handle
+ *
+ */
+void
+RFactorizationGetType(MPCRFactorization *aFactor);
+
+
+#endif //MPCR_RFACTORIZATION_HPP
@@ -56,11 +56,43 @@ RTCrossProduct(DataType *aInputA, SEXP aInputB);
  * MPCR Square Matrix
  * @param[in] aOnlyValues
  * bool True, Only values will be returned ,otherwise values and vectors.
+ * @param[in] aOverwrite
+ * if true, aInputA is used as workspace and left empty.
  * @returns
  * vector of MPCR objects, First element Values ,and second element Vectors.
  */
 std::vector <DataType>
-REigen(DataType *aInputA, const bool &aOnlyValues);
+REigen(DataType *aInputA, const bool &aOnlyValues, const bool &aOverwrite);
+
+/**
+ * @brief
+ * Calculate only k Eigen Values and (optionally) Eigen Vectors of a symmetric
+ * matrix, either with Syevr selection by index or with the Lanczos iteration.
+ *
+ * @param[in] aInput
+ * MPCR Square Symmetric Matrix
+ * @param[in] aNumValues
+ * Number of eigenpairs to compute
+ * @param[in] aWhich
+ * "largest" or "smallest"
+ * @param[in] aOnlyValues
+ * bool True, Only values will be returned ,otherwise values and vectors.
+ * @param[in] aMethod
+ * "syevr" for the direct selection, "lanczos" for the iterative solver
+ * @param[in] aTolerance
+ * Relative residual tolerance of the Lanczos iteration
+ * @param[in] aMaxRestarts
+ * Maximum number of restarts of the Lanczos iteration
+ * @param[in] aSeed
+ * Seed of the Lanczos starting vector
+ * @returns
+ * vector of MPCR objects, First element Values ,and second element Vectors.
+ */
+std::vector <DataType>
+RPartialEigen(DataType *aInput, const size_t &aNumValues,
+              const std::string &aWhich, const bool &aOnlyValues,
+              const std::string &aMethod, const double &aTolerance,
+              const size_t &aMaxRestarts, const size_t &aSeed);
 
 /**
  * @brief
@@ -68,12 +100,15 @@ REigen(DataType *aInputA, const bool &aOnlyValues);
  *
  * @param[in] aInput
  * MPCR Matrix
+ * @param[in] aTolerance
+ * Largest absolute difference allowed between mirrored entries, a negative
+ * value uses the machine epsilon of the precision.
  * @returns
  * true if symmetric ,false otherwise
  *
  */
 bool
-RIsSymmetric(DataType *aInputA);
+RIsSymmetric(DataType *aInputA, const double &aTolerance);
 
 /**
  * @brief
@@ -106,12 +141,41 @@ RBackSolve(DataType *aInputA, DataType *aInputB, const long &aCol,
  *
  * @param[in] aInput
  * MPCR Matrix
+ * @param[in] aUpperTriangle
+ * if true, the upper factor is returned, otherwise the lower one.
+ * @param[in] aOverwrite
+ * if true, the factor is computed in the buffer of aInputA, which is left
+ * empty.
  * @returns
  * MPCR Matrix containing decomposition result
  *
  */
 DataType *
-RCholesky(DataType *aInputA, const bool &aUpperTriangle);
+RCholesky(DataType *aInputA, const bool &aUpperTriangle,
+          const bool &aOverwrite);
+
+/**
+ * @brief
+ * Calculate an adaptive mixed-precision Cholesky decomposition, off-diagonal
+ * tiles are computed in single precision when their norm allows it.
+ *
+ * @param[in] aInputA
+ * MPCR Matrix
+ * @param[in] aUpperTriangle
+ * if true, the upper factor is returned, otherwise the lower one.
+ * @param[in] aTolerance
+ * Accuracy required relative to the norm of the matrix
+ * @param[in] aTileSize
+ * Size of the square tiles
+ * @returns
+ * vector containing the MPCR Matrix of the decomposition, and an MPCR
+ * vector holding the achieved accuracy followed by the share of flops run
+ * in half, single and double precision.
+ *
+ */
+std::vector <DataType>
+RCholeskyAdaptive(DataType *aInputA, const bool &aUpperTriangle,
+                  const double &aTolerance, const size_t &aTileSize);
 
 /**
  * @brief
@@ -120,12 +184,35 @@ RCholesky(DataType *aInputA, const bool &aUpperTriangle);
  *
  * @param[in] aInput
  * MPCR Matrix containing Cholesky decomposition.
+ * @param[in] aInternalPrecision
+ * Precision used for inverting a double precision factor.
  * @returns
  * MPCR Matrix
  *
  */
 DataType *
-RCholeskyInv(DataType *aInputA, const size_t &aSize);
+RCholeskyInv(DataType *aInputA, const size_t &aSize,
+             const std::string &aInternalPrecision);
+
+/**
+ * @brief
+ * Solves the equation AX=B for a symmetric positive definite matrix A using
+ * its Cholesky decomposition.
+ *
+ * @param[in] aInputA
+ * MPCR symmetric positive definite Matrix A
+ * @param[in] aInputB
+ * MPCR Matrix B, if R_NilValue the inverse of A is computed.
+ * @param[in] aInternalPrecision
+ * Precision used for the Cholesky factorization, a reduced precision
+ * factorization is refined with double precision residuals.
+ * @returns
+ * MPCR Matrix X
+ *
+ */
+DataType *
+RCholeskySolve(DataType *aInputA, SEXP aInputB,
+               const std::string &aInternalPrecision);
 
 /**
  * @brief
@@ -139,13 +226,16 @@ RCholeskyInv(DataType *aInputA, const size_t &aSize);
  * string that indicate the precision used for the LU factorization in
  * case of using GESV routine in CuSolver.
  * Options: (float or single) ,half ,tensorfloat
+ * @param[in] aOverwrite
+ * if true, aInputA is factorized in place and left empty.
  *
  * @returns
  * MPCR Matrix B
  *
  */
 DataType *
-RSolve(DataType *aInputA, SEXP aInputB,const std::string &aInternalPrecision);
+RSolve(DataType *aInputA, SEXP aInputB,const std::string &aInternalPrecision,
+       const bool &aOverwrite);
 
 /**
  * @brief
@@ -164,13 +254,59 @@ RSolve(DataType *aInputA, SEXP aInputB,const std::string &aInternalPrecision);
  * @param[in] aTranspose
  * Bool if true, aOutputV will contain V ,otherwise VT
  * default true for svd() false for la.svd()
+ * @param[in] aRank
+ * Number of singular triplets for the randomized method, if positive with
+ * the exact method, aNu and aNv are set to it.
+ * @param[in] aMethod
+ * "exact" for the full SVD (gesdd), "randomized" for the randomized
+ * truncated SVD returning only aRank triplets.
+ * @param[in] aOversampling
+ * Number of extra sampled columns of the randomized method
+ * @param[in] aPowerIterations
+ * Number of power iterations of the randomized method
+ * @param[in] aInternalPrecision
+ * Working precision of the randomized method, "single" to run it in float,
+ * the outputs are returned in the precision of aInputA.
+ * @param[in] aSeed
+ * Seed of the Gaussian sketch of the randomized method
+ * @param[in] aOverwrite
+ * if true, the exact method uses aInputA as workspace and leaves it empty.
  * @returns
  * Vectors containing d,u,v or VT if aTranspose = false
  *
  */
 std::vector <DataType>
 RSVD(DataType *aInputA, const long &aNu, const long &aNv,
-     const bool &aTranspose);
+     const bool &aTranspose, const long &aRank, const std::string &aMethod,
+     const size_t &aOversampling, const size_t &aPowerIterations,
+     const std::string &aInternalPrecision, const size_t &aSeed,
+     const bool &aOverwrite);
+
+/**
+ * @brief
+ * Principal component analysis using the randomized truncated SVD, the data
+ * is centered on the fly.
+ *
+ * @param[in] aInput
+ * MPCR Matrix, one observation per row
+ * @param[in] aRank
+ * Number of principal components
+ * @param[in] aCenter
+ * Bool if true, the columns are centered
+ * @param[in] aOversampling
+ * Number of extra sampled columns
+ * @param[in] aPowerIterations
+ * Number of power iterations
+ * @param[in] aSeed
+ * Seed of the Gaussian sketch
+ * @returns
+ * Vectors containing sdev, rotation, x (scores) and center if aCenter = true
+ *
+ */
+std::vector <DataType>
+RPrincipalComponents(DataType *aInput, const size_t &aRank,
+                     const bool &aCenter, const size_t &aOversampling,
+                     const size_t &aPowerIterations, const size_t &aSeed);
 
 /**
  * @brief
@@ -183,6 +319,24 @@ RSVD(DataType *aInputA, const long &aNu, const long &aNv,
 DataType *
 RTranspose(DataType *aInputA);
 
+/**
+ * @brief
+ * Calculate t(x) %*% x or x %*% t(x) in packed symmetric storage.
+ *
+ * @param[in] aInputA
+ * MPCR Matrix
+ * @param[in] aUpperTriangle
+ * if true, the upper triangle is stored, otherwise the lower one.
+ * @param[in] aTranspose
+ * if true, t(x) %*% x is computed, otherwise x %*% t(x)
+ * @returns
+ * Packed MPCR Matrix
+ *
+ */
+DataType *
+RPackedCrossProduct(DataType *aInputA, const bool &aUpperTriangle,
+                    const bool &aTranspose);
+
 /**
  * @brief
  * Computes a matrix norm of aInput. The norm can be the one ("O") norm,
@@ -205,12 +359,15 @@ RNorm(DataType *aInputA, const std::string &aType);
  *
  * @param[in] aInputA
  * MPCR Matrix
+ * @param[in] aOverwrite
+ * if true, the decomposition is computed in the buffer of aInputA, which is
+ * left empty.
  * @returns
  * vector containing QR,QRaux,Pivot,Rank
  *
  */
 std::vector <DataType>
-RQRDecomposition(DataType *aInputA);
+RQRDecomposition(DataType *aInputA, const bool &aOverwrite);
 
 /**
  * @brief
@@ -233,6 +390,22 @@ RQRDecomposition(DataType *aInputA);
 double
 RRCond(DataType *aInputA, const std::string &aNorm, const bool &aTriangle);
 
+/**
+ * @brief
+ * Calculate the modulus and sign of the determinant of a square MPCR Matrix
+ * using its LU factorization.
+ *
+ * @param[in] aInputA
+ * MPCR Matrix
+ * @param[in] aLogarithm
+ * Bool if true, the modulus is returned on the log scale.
+ * @returns
+ * vector containing modulus, sign
+ *
+ */
+std::vector <double>
+RDeterminant(DataType *aInputA, const bool &aLogarithm);
+
 /**
  * @brief
  * returns R. This may be pivoted,
@@ -332,6 +505,56 @@ RQRDecompositionQy(DataType *aInputA, DataType *aInputB, DataType *aDvec);
 DataType *
 RQRDecompositionQty(DataType *aInputA, DataType *aInputB, DataType *aDvec);
 
+/**
+ * @brief
+ * Fit a (weighted, ridge) linear least squares model, as lm.fit.
+ *
+ * @param[in] aInputX
+ * MPCR Matrix X
+ * @param[in] aInputY
+ * MPCR Matrix or vector of responses
+ * @param[in] aWeights
+ * MPCR vector of observation weights, or NULL
+ * @param[in] aLambda
+ * Ridge penalty
+ * @param[in] aMethod
+ * "auto", "qr" or "chol"
+ * @param[in] aInternalPrecision
+ * "single" to factorize a double X in single precision with double
+ * refinement, "same" otherwise
+ * @param[in] aTolerance
+ * Tolerance used to detect the rank in the QR path
+ * @returns
+ * vector of MPCR objects, coefficients, residuals and rank.
+ *
+ */
+std::vector <DataType>
+RLeastSquares(DataType *aInputX, DataType *aInputY, SEXP aWeights,
+              const double &aLambda, const std::string &aMethod,
+              const std::string &aInternalPrecision, const double &aTolerance);
+
+/**
+ * @brief
+ * Tall and skinny QR decomposition (TSQR) of a matrix with many more rows
+ * than columns.
+ *
+ * @param[in] aInput
+ * MPCR Matrix
+ * @param[in] aInputY
+ * MPCR Matrix or vector, if not NULL t(Q) %*% y is returned
+ * @param[in] aComputeQ
+ * if true, the thin Q is formed, otherwise only R is computed
+ * @param[in] aBlockRows
+ * Number of rows of each block, 0 to split the rows over the cores
+ * @returns
+ * vector of MPCR objects, R, then Q if requested, then t(Q) %*% y if y is
+ * given.
+ *
+ */
+std::vector <DataType>
+RTSQR(DataType *aInput, SEXP aInputY, const bool &aComputeQ,
+      const size_t &aBlockRows);
+
 /**
  * @brief
  * Perform Matrix Matrix Multiplication using Gemm/Syrk routines
@@ -362,9 +585,86 @@ RGemm(DataType *aInputA, SEXP aInputB, DataType *aInputC,
       const bool &aTransposeA, const bool &aTransposeB, const double &aAlpha,
       const double &aBeta);
 
+/**
+ * @brief
+ * Perform Matrix Vector Multiplication using the Gemv routine
+ * performs:
+ * y = alpha op(A) x + beta y
+ *
+ * @param[in] aInputA
+ * MPCR Matrix
+ * @param[in] aInputX
+ * MPCR vector (or one column Matrix) of length ncol(op(A))
+ * @param[in,out] aInputY
+ * MPCR vector (or one column Matrix) of length nrow(op(A)), updated in
+ * place. If empty, it is allocated and beta is ignored.
+ * @param[in] aTranspose
+ * if true , op(A) = t(A)
+ * @param aAlpha
+ * factor of op(A) x
+ * @param aBeta
+ * factor of y
+ *
+ */
+void
+RGemv(DataType *aInputA, DataType *aInputX, DataType *aInputY,
+      const bool &aTranspose, const double &aAlpha, const double &aBeta);
+
 DataType *
 RTrsm(DataType *aInputA, DataType *aInputB, const bool &aUpperTri,
       const bool &aTranspose, const char &aSide, const double &aAlpha);
 
+/**
+ * @brief
+ * Perform Triangular Matrix Multiplication using the Trmm routine
+ * performs:
+ * alpha op(A) B  or  alpha B op(A)
+ *
+ * @param[in] aInputA
+ * MPCR square triangular Matrix
+ * @param[in] aInputB
+ * MPCR Matrix or vector
+ * @param[in] aUpperTri
+ * if true , the upper triangle of A is used, otherwise the lower one
+ * @param[in] aTranspose
+ * if true , op(A) = t(A)
+ * @param[in] aSide
+ * 'L' to multiply from the left, 'R' from the right
+ * @param aAlpha
+ * factor of the product
+ *
+ * @returns
+ * MPCR Matrix
+ *
+ */
+DataType *
+RTrmm(DataType *aInputA, DataType *aInputB, const bool &aUpperTri,
+      const bool &aTranspose, const char &aSide, const double &aAlpha);
+
+/**
+ * @brief
+ * Perform Symmetric Matrix Multiplication using the Symm routine
+ * performs:
+ * alpha A B  or  alpha B A
+ *
+ * @param[in] aInputA
+ * MPCR square symmetric Matrix
+ * @param[in] aInputB
+ * MPCR Matrix or vector
+ * @param[in] aUpperTri
+ * if true , the upper triangle of A is used, otherwise the lower one
+ * @param[in] aSide
+ * 'L' to multiply from the left, 'R' from the right
+ * @param aAlpha
+ * factor of the product
+ *
+ * @returns
+ * MPCR Matrix
+ *
+ */
+DataType *
+RSymm(DataType *aInputA, DataType *aInputB, const bool &aUpperTri,
+      const char &aSide, const double &aAlpha);
+
 
 #endif //MPCR_RLINEARALGEBRA_HPP
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_RSPARSE_HPP
+#define MPCR_RSPARSE_HPP
+
+
+#include <operations/SparseLinearAlgebra.hpp>
+
+
+/**
+ * @brief
+ * Create a sparse MPCR Matrix from (i, j, x) triplets, indices are one based
+ * as in R, duplicated entries are summed.
+ *
+ * @param[in] aRowIdx
+ * Row index of each entry
+ * @param[in] aColIdx
+ * Col index of each entry
+ * @param[in] aValues
+ * Value of each entry
+ * @param[in] aNumRow
+ * Number of rows of the matrix
+ * @param[in] aNumCol
+ * Number of cols of the matrix
+ * @param[in] aPrecision
+ * Precision of the values ("float" or "double")
+ * @param[in] aFormat
+ * Compressed layout of the matrix ("CSR" or "CSC")
+ * @returns
+ * Sparse MPCR Matrix
+ *
+ */
+SparseDataType *
+RSparseFromTriplets(std::vector <double> &aRowIdx,
+                    std::vector <double> &aColIdx,
+                    std::vector <double> &aValues, const size_t &aNumRow,
+                    const size_t &aNumCol, const std::string &aPrecision,
+                    const std::string &aFormat);
+
+/**
+ * @brief
+ * Multiply a sparse MPCR Matrix with a dense MPCR Matrix
+ * performs:
+ * x %*% y
+ *
+ * @param[in] aInputA
+ * Sparse MPCR Matrix
+ * @param[in] aInputB
+ * Dense MPCR Matrix or Vector
+ * @returns
+ * Dense MPCR Matrix
+ *
+ */
+DataType *
+RSparseMultiply(SparseDataType *aInputA, DataType *aInputB);
+
+/**
+ * @brief
+ * Multiply a dense MPCR Matrix with a sparse MPCR Matrix
+ * performs:
+ * x %*% y
+ *
+ * @param[in] aInputA
+ * Dense MPCR Matrix
+ * @param[in] aInputB
+ * Sparse MPCR Matrix
+ * @returns
+ * Dense MPCR Matrix
+ *
+ */
+DataType *
+RDenseSparseMultiply(DataType *aInputA, SparseDataType *aInputB);
+
+/**
+ * @brief
+ * Calculate CrossProduct of a sparse and a dense MPCR Matrix
+ * performs:
+ * t(x) %*% y
+ *
+ * @param[in] aInputA
+ * Sparse MPCR Matrix
+ * @param[in] aInputB
+ * Dense MPCR Matrix or Vector
+ * @returns
+ * Dense MPCR Matrix
+ *
+ */
+DataType *
+RSparseCrossProduct(SparseDataType *aInputA, DataType *aInputB);
+
+/**
+ * @brief
+ * Calculate CrossProduct of a sparse and a dense MPCR Matrix
+ * performs:
+ * x %*% t(y)
+ *
+ * @param[in] aInputA
+ * Sparse MPCR Matrix
+ * @param[in] aInputB
+ * Dense MPCR Matrix
+ * @returns
+ * Dense MPCR Matrix
+ *
+ */
+DataType *
+RSparseTCrossProduct(SparseDataType *aInputA, DataType *aInputB);
+
+/**
+ * @brief
+ * Transpose a sparse MPCR Matrix
+ *
+ * @param[in] aInput
+ * Sparse MPCR Matrix
+ * @returns
+ * New Sparse MPCR Matrix holding t(x)
+ *
+ */
+SparseDataType *
+RSparseTranspose(SparseDataType *aInput);
+
+/**
+ * @brief
+ * Expand a sparse MPCR Matrix into a dense MPCR Matrix
+ *
+ * @param[in] aInput
+ * Sparse MPCR Matrix
+ * @returns
+ * Dense MPCR Matrix
+ *
+ */
+DataType *
+RSparseToDense(SparseDataType *aInput);
+
+/**
+ * @brief
+ * Convert the compressed layout of a sparse MPCR Matrix in place
+ *
+ * @param[in,out] aInput
+ * Sparse MPCR Matrix
+ * @param[in] aFormat
+ * Requested layout ("CSR" or "CSC")
+ *
+ */
+void
+RSparseConvertFormat(SparseDataType *aInput, const std::string &aFormat);
+
+/**
+ * @brief
+ * Get the compressed layout of a sparse MPCR Matrix
+ *
+ * @param[in] aInput
+ * Sparse MPCR Matrix
+ * @returns
+ * "CSR" or "CSC"
+ *
+ */
+std::string
+RSparseGetFormat(SparseDataType *aInput);
+
+/**
+ * @brief
+ * Print the description of a sparse MPCR Matrix
+ *
+ * @param[in] aInput
+ * Sparse MPCR Matrix
+ *
+ */
+void
+RSparseGetType(SparseDataType *aInput);
+
+
+#endif //MPCR_RSPARSE_HPP
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_RTILE_HPP
+#define MPCR_RTILE_HPP
+
+
+#include <operations/TileLinearAlgebra.hpp>
+
+
+/**
+ * @brief
+ * Tiled matrix-matrix multiplication, C is updated in place
+ * performs:
+ * C = alpha * op(A) %*% op(B) + beta * C
+ *
+ * @param[in] aInputA
+ * MPCR Tile Matrix
+ * @param[in] aInputB
+ * MPCR Tile Matrix
+ * @param[in,out] aInputC
+ * MPCR Tile Matrix
+ * @param[in] aTransposeA
+ * if true, op(A) = t(A)
+ * @param[in] aTransposeB
+ * if true, op(B) = t(B)
+ * @param[in] aAlpha
+ * Scalar alpha
+ * @param[in] aBeta
+ * Scalar beta
+ *
+ */
+void
+RTileGemm(MPCRTile *aInputA, MPCRTile *aInputB, MPCRTile *aInputC,
+          const bool &aTransposeA, const bool &aTransposeB,
+          const double &aAlpha, const double &aBeta);
+
+/**
+ * @brief
+ * Tiled triangular solve, B is overwritten by the solution
+ * performs:
+ * op(A) X = alpha B  or  X op(A) = alpha B
+ *
+ * @param[in] aInputA
+ * MPCR Tile triangular Matrix
+ * @param[in,out] aInputB
+ * MPCR Tile Matrix
+ * @param[in] aUpperTri
+ * if true, A is upper triangular, otherwise lower triangular
+ * @param[in] aTranspose
+ * if true, op(A) = t(A)
+ * @param[in] aSide
+ * 'L' to solve op(A) X = alpha B, 'R' to solve X op(A) = alpha B
+ * @param[in] aAlpha
+ * Scalar alpha
+ *
+ */
+void
+RTileTrsm(MPCRTile *aInputA, MPCRTile *aInputB, const bool &aUpperTri,
+          const bool &aTranspose, const char &aSide, const double &aAlpha);
+
+/**
+ * @brief
+ * Tiled symmetric rank-k update of the lower triangle of C, in place
+ * performs:
+ * C = alpha * A %*% t(A) + beta * C  or  C = alpha * t(A) %*% A + beta * C
+ *
+ * @param[in] aInputA
+ * MPCR Tile Matrix
+ * @param[in,out] aInputC
+ * MPCR Tile square Matrix
+ * @param[in] aTranspose
+ * if true, C = alpha * t(A) %*% A + beta * C
+ * @param[in] aAlpha
+ * Scalar alpha
+ * @param[in] aBeta
+ * Scalar beta
+ *
+ */
+void
+RTileSyrk(MPCRTile *aInputA, MPCRTile *aInputC, const bool &aTranspose,
+          const double &aAlpha, const double &aBeta);
+
+/**
+ * @brief
+ * Assemble an MPCR Tile Matrix into one dense double precision MPCR Matrix
+ *
+ * @param[in] aInput
+ * MPCR Tile Matrix
+ * @returns
+ * MPCR Matrix
+ *
+ */
+DataType *
+RTileGetMatrix(MPCRTile *aInput);
+
+/**
+ * @brief
+ * Get a copy of one tile, indices are one based as in R
+ *
+ * @param[in] aInput
+ * MPCR Tile Matrix
+ * @param[in] aTileRowIdx
+ * Row index of the tile in the grid
+ * @param[in] aTileColIdx
+ * Col index of the tile in the grid
+ * @returns
+ * MPCR Matrix holding a copy of the tile
+ *
+ */
+DataType *
+RTileGetTile(MPCRTile *aInput, const size_t &aTileRowIdx,
+             const size_t &aTileColIdx);
+
+/**
+ * @brief
+ * Replace one tile, indices are one based as in R
+ *
+ * @param[in,out] aInput
+ * MPCR Tile Matrix
+ * @param[in] aTile
+ * MPCR Matrix with the dimensions of the replaced tile
+ * @param[in] aTileRowIdx
+ * Row index of the tile in the grid
+ * @param[in] aTileColIdx
+ * Col index of the tile in the grid
+ *
+ */
+void
+RTileInsertTile(MPCRTile *aInput, DataType *aTile, const size_t &aTileRowIdx,
+                const size_t &aTileColIdx);
+
+/**
+ * @brief
+ * Change the precision of one tile, indices are one based as in R
+ *
+ * @param[in,out] aInput
+ * MPCR Tile Matrix
+ * @param[in] aTileRowIdx
+ * Row index of the tile in the grid
+ * @param[in] aTileColIdx
+ * Col index of the tile in the grid
+ * @param[in] aPrecision
+ * Required precision of the tile
+ *
+ */
+void
+RTileChangePrecision(MPCRTile *aInput, const size_t &aTileRowIdx,
+                     const size_t &aTileColIdx, const std::string &aPrecision);
+
+/**
+ * @brief
+ * Print the description of an MPCR Tile Matrix
+ *
+ * @param[in] aInput
+ * MPCR Tile Matrix
+ *
+ */
+void
+RTileGetType(MPCRTile *aInput);
+
+
+#endif //MPCR_RTILE_HPP
@@ -205,6 +205,22 @@ public:
     void
     ClearUp();
 
+    /**
+     * @brief
+     * Hand the buffer of the given placement over to the caller, the buffer
+     * is synced first and the other buffer is de-allocated. The holder is
+     * left empty and the caller becomes responsible for freeing the buffer.
+     *
+     * @param[in] aPlacement
+     * Placement enum indicating which buffer should be released.
+     *
+     * @returns
+     * pointer to the released buffer, nullptr if the holder is empty.
+     *
+     */
+    char *
+    ReleaseDataPointer(const OperationPlacement &aPlacement);
+
     /**
      * @brief
      * Change precision of buffer. this function will detect whether to promote
@@ -217,6 +233,19 @@ public:
     void
     ChangePrecision();
 
+    /**
+     * @brief
+     * Resize the host buffer keeping its leading bytes, the buffer is
+     * reallocated in place whenever possible. Any device copy is synced
+     * first and then deleted.
+     *
+     * @param[in] aSizeInBytes
+     * New size of the buffer in bytes.
+     *
+     */
+    void
+    ResizeHostBuffer(const size_t &aSizeInBytes);
+
 
     /**
      * @brief
@@ -281,6 +310,8 @@ private:
      * @brief
      * Change precision on host pointer, this function will automatically delete
      * the data on device.
+     * The conversion is done inside the existing host buffer, which is resized
+     * to fit the new precision, so no second full-size buffer is needed.
      *
      */
     template <typename T, typename X>
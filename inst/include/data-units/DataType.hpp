@@ -15,6 +15,37 @@
 #include <utilities/MPCRDispatcher.hpp>
 
 
+/** Block side length used by the cache-blocked CPU kernels **/
+#define MPCR_CPU_BLOCK_SIZE 8
+
+
+/**
+ * Structural properties known for an MPCR Matrix, combined as bit flags.
+ * Composite properties include the flags they imply.
+ **/
+enum MatrixProperty {
+    /** Nothing is known about the structure **/
+    MATRIX_GENERAL = 0,
+    MATRIX_SYMMETRIC = 1,
+    /** Entries below the diagonal are zero **/
+    MATRIX_UPPER_TRIANGULAR = 2,
+    /** Entries above the diagonal are zero **/
+    MATRIX_LOWER_TRIANGULAR = 4,
+    /** Symmetric positive definite **/
+    MATRIX_SPD = 8 | MATRIX_SYMMETRIC,
+    MATRIX_DIAGONAL = MATRIX_SYMMETRIC | MATRIX_UPPER_TRIANGULAR |
+                      MATRIX_LOWER_TRIANGULAR,
+    /** The data was scanned, structural flags not set are known to fail **/
+    MATRIX_PROBED = 16,
+    /** The symmetry check failed at a tolerance of at least the machine
+     *  epsilon, so it fails at any tighter one **/
+    MATRIX_NOT_SYMMETRIC = 32,
+    /** The symmetry check passed at a tolerance of at most the machine
+     *  epsilon. Not exact, the solvers rely on MATRIX_SYMMETRIC only **/
+    MATRIX_NEARLY_SYMMETRIC = 64
+};
+
+
 /** Dimensions struct holding Dimensions for Representing a Vector as a Matrix **/
 typedef struct Dimensions {
 
@@ -468,6 +499,11 @@ public:
     ClearUp() {
         this->mSize = 0;
         this->mMatrix = false;
+        this->mTransposed = false;
+        this->mPacked = false;
+        this->mPackedUpper = false;
+        this->mPackedTriangular = false;
+        this->mProperties = MATRIX_GENERAL;
         delete this->mpDimensions;
         this->mpDimensions = nullptr;
         mData.ClearUp();
@@ -578,6 +614,39 @@ public:
     char *
     GetData(const OperationPlacement &aOperationPlacement = CPU);
 
+    /**
+     * @brief
+     * Get Data of Vector without materializing a pending lazy transpose.
+     * In case IsTransposed() is true, the buffer holds the transpose of the
+     * reported matrix, i.e. a GetNCol() x GetNRow() column-major matrix.
+     *
+     * @param[in] aOperationPlacement
+     * Enum to decide which pointer should be returned.
+     *
+     * @returns
+     * Char pointer pointing to the stored data (Must be casted according to
+     * precision)
+     */
+    char *
+    GetStoredData(const OperationPlacement &aOperationPlacement = CPU);
+
+    /**
+     * @brief
+     * Hand the data buffer over to the caller and clear the object, used by
+     * operations consuming their input instead of copying it. The buffer is
+     * returned as stored, i.e. packed or lazily transposed data is not
+     * converted, callers must request it with GetData() or GetPackedData()
+     * first to fix the layout.
+     *
+     * @param[in] aOperationPlacement
+     * Enum to decide which buffer should be released.
+     *
+     * @returns
+     * Char pointer to the released buffer, to be freed by the caller.
+     */
+    char *
+    ReleaseData(const OperationPlacement &aOperationPlacement = CPU);
+
     /**
      * @brief
      * Get Size of Vector or Matrix
@@ -813,12 +882,200 @@ public:
 
     /**
      * @brief
-     * Transpose MPCR Matrix
+     * Transpose MPCR Matrix in place.
+     * Square matrices are transposed block by block, rectangular matrices
+     * follow the permutation cycles using one bit of workspace per element,
+     * so no second copy of the data is allocated.
      *
      */
     void
     Transpose();
 
+    /**
+     * @brief
+     * Transpose MPCR Matrix into another MPCR object, leaving the current
+     * object unchanged. Uses a cache-blocked multithreaded copy.
+     *
+     * @param[out] aOutput
+     * MPCR Matrix holding the transpose, takes the precision of the input.
+     *
+     */
+    void
+    Transpose(DataType &aOutput);
+
+    /**
+     * @brief
+     * Logically transpose MPCR Matrix, the reported dimensions are swapped
+     * while the data stays in place. The transpose is applied to the data
+     * only when a physical layout is required (GetData), linear algebra
+     * routines fold it into their BLAS transpose arguments instead.
+     *
+     */
+    void
+    LazyTranspose();
+
+    /**
+     * @brief
+     * Physically apply a pending lazy transpose, if any.
+     *
+     */
+    void
+    MaterializeTranspose();
+
+    /**
+     * @brief
+     * Check if MPCR Matrix holds a pending lazy transpose.
+     *
+     * @returns
+     * true if the stored data is the transpose of the reported matrix.
+     */
+    inline
+    bool
+    IsTransposed() const {
+        return this->mTransposed;
+    }
+
+    /**
+     * @brief
+     * Convert a square MPCR Matrix to LAPACK packed storage, only one
+     * triangle is kept column by column (n*(n+1)/2 elements). The conversion
+     * is done inside the existing host buffer, which is then shrunk.
+     * Packed-aware routines (Cholesky, CholeskyInv, BackSolve,
+     * PackedCrossProduct) operate on the packed buffer directly, any other
+     * access through GetData unpacks the matrix first.
+     *
+     * @param[in] aUpperTriangle
+     * if true, the upper triangle is kept, otherwise the lower triangle.
+     * @param[in] aTriangular
+     * if true, the matrix is treated as triangular and the other triangle is
+     * filled with zeros on unpacking, otherwise it's treated as symmetric and
+     * the other triangle is mirrored.
+     *
+     */
+    void
+    ToPacked(const bool &aUpperTriangle = true,
+             const bool &aTriangular = false);
+
+    /**
+     * @brief
+     * Convert a packed MPCR Matrix back to full column-major storage.
+     *
+     */
+    void
+    Unpack();
+
+    /**
+     * @brief
+     * Mark a square MPCR Matrix as packed, the next SetData call is expected
+     * to provide a packed buffer of n*(n+1)/2 elements.
+     *
+     * @param[in] aUpperTriangle
+     * if true, the buffer holds the upper triangle, otherwise the lower one.
+     * @param[in] aTriangular
+     * if true, the matrix is triangular, otherwise symmetric.
+     *
+     */
+    void
+    SetPackedLayout(const bool &aUpperTriangle, const bool &aTriangular);
+
+    /**
+     * @brief
+     * Get the packed buffer of a packed MPCR Matrix without unpacking it.
+     *
+     * @param[in] aOperationPlacement
+     * Enum to decide which pointer should be returned.
+     *
+     * @returns
+     * Char pointer pointing to the packed data (Must be casted according to
+     * precision)
+     */
+    char *
+    GetPackedData(const OperationPlacement &aOperationPlacement = CPU);
+
+    /**
+     * @brief
+     * Check if MPCR Matrix is stored in packed format.
+     *
+     * @returns
+     * true if only one triangle of the matrix is stored.
+     */
+    inline
+    bool
+    IsPacked() const {
+        return this->mPacked;
+    }
+
+    /**
+     * @brief
+     * Check which triangle a packed MPCR Matrix holds.
+     *
+     * @returns
+     * true if the upper triangle is stored, false if the lower one.
+     */
+    inline
+    bool
+    IsPackedUpper() const {
+        return this->mPackedUpper;
+    }
+
+    /**
+     * @brief
+     * Check whether a packed MPCR Matrix is triangular or symmetric.
+     *
+     * @returns
+     * true if triangular, false if symmetric.
+     */
+    inline
+    bool
+    IsPackedTriangular() const {
+        return this->mPackedTriangular;
+    }
+
+    /**
+     * @brief
+     * Check a structural property of the MPCR Matrix. Properties are set by
+     * the routines producing structured outputs (CrossProduct, Cholesky,
+     * Symmetrize, ...) or by probing the data, and are dropped by any
+     * mutation through SetData, SetVal or a change of dimensions.
+     *
+     * @param[in] aProperty
+     * Property to check, composite properties require all their flags.
+     *
+     * @returns
+     * true if the property is known to hold.
+     */
+    inline
+    bool
+    HasProperty(const MatrixProperty &aProperty) const {
+        return ( this->mProperties & aProperty ) == aProperty;
+    }
+
+    /**
+     * @brief
+     * Record a structural property of the MPCR Matrix, the caller guarantees
+     * that the data satisfies it.
+     *
+     * @param[in] aProperty
+     * Property to add to the known ones.
+     *
+     */
+    inline
+    void
+    SetProperty(const MatrixProperty &aProperty) {
+        this->mProperties |= aProperty;
+    }
+
+    /**
+     * @brief
+     * Forget all structural properties of the MPCR Matrix.
+     *
+     */
+    inline
+    void
+    ClearProperties() {
+        this->mProperties = MATRIX_GENERAL;
+    }
+
     /**
      * @brief
      * Print a whole Row (given) in case of Matrix .
@@ -886,7 +1143,7 @@ public:
 
     /**
      * @brief
-     * Returns the determinant of all elements in MPCR Object
+     * Returns the determinant of a square MPCR Matrix (computed using LU)
      *
      * @returns
      * Determinant of all elements
@@ -1177,6 +1434,48 @@ private:
     void
     TransposeDispatcher();
 
+    /**
+     * @brief
+     * Dispatcher for transposing data matrix into an output object according
+     * to precision
+     *
+     * @param[out] aOutput
+     * MPCR Matrix holding the transpose
+     *
+     */
+    template <typename T>
+    void
+    TransposeOutOfPlaceDispatcher(DataType &aOutput);
+
+    /**
+     * @brief
+     * Dispatcher for applying a pending lazy transpose according to precision
+     *
+     */
+    template <typename T>
+    void
+    MaterializeTransposeDispatcher();
+
+    /**
+     * @brief
+     * Dispatcher for converting the matrix to packed storage according to
+     * precision
+     *
+     */
+    template <typename T>
+    void
+    PackDispatcher();
+
+    /**
+     * @brief
+     * Dispatcher for converting a packed matrix back to full storage
+     * according to precision
+     *
+     */
+    template <typename T>
+    void
+    UnpackDispatcher();
+
     /**
      * @brief
      * Dispatcher for printing one Row of the Matrix
@@ -1300,6 +1599,16 @@ private:
     mpcr::definitions::Precision mPrecision;
     /** Bool indicating whether it's a Matrix(True) or Vector(False) **/
     bool mMatrix;
+    /** Bool indicating whether the data holds the transpose of the Matrix **/
+    bool mTransposed = false;
+    /** Bool indicating whether only one triangle is stored (packed) **/
+    bool mPacked = false;
+    /** Bool indicating whether the packed triangle is the upper one **/
+    bool mPackedUpper = false;
+    /** Bool indicating whether the packed Matrix is triangular or symmetric **/
+    bool mPackedTriangular = false;
+    /** Bit flags of the structural properties known for the Matrix **/
+    int mProperties = MATRIX_GENERAL;
     /** Magic Number to check if object is DataType **/
     int mMagicNumber;
 
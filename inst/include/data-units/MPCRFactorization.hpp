@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_MPCRFACTORIZATION_HPP
+#define MPCR_MPCRFACTORIZATION_HPP
+
+
+#include <vector>
+#include <data-units/DataType.hpp>
+
+
+/** Enum describing the decomposition held by an MPCR Factorization **/
+enum class FactorizationType {
+    /** LU decomposition with partial pivoting, P A = L U **/
+    LU,
+    /** Cholesky decomposition, A = t(R) R **/
+    CHOLESKY,
+    /** QR decomposition with column pivoting, A P = Q R **/
+    QR
+};
+
+
+/** Factorization handle, the matrix is decomposed once at construction and
+ *  the factors (and pivots) are kept resident, so repeated solves, the
+ *  inverse, the log determinant and the reciprocal condition number reuse
+ *  the O(n^3) work and only cost O(n^2) per right-hand side.
+ *  The factors are kept in the precision of the input matrix, in host
+ *  memory, and all the operations on the handle run on the CPU.
+ **/
+class MPCRFactorization {
+
+public:
+
+    /**
+     * @brief
+     * MPCR Factorization constructor, decomposes the given matrix.
+     *
+     * @param[in] aInput
+     * MPCR Matrix to decompose, must be square for LU and Cholesky and have
+     * at least as many rows as cols for QR.
+     * @param[in] aType
+     * Decomposition type, "lu", "chol" or "qr".
+     *
+     */
+    MPCRFactorization(DataType &aInput, const std::string &aType);
+
+    /**
+     * @brief
+     * MPCR Factorization De-Constructor
+     */
+    ~MPCRFactorization() = default;
+
+    /**
+     * @brief
+     * Get the decomposition type of the handle
+     *
+     * @returns
+     * Factorization type
+     */
+    FactorizationType
+    GetFactorizationType() const;
+
+    /**
+     * @brief
+     * Get number of rows of the decomposed matrix
+     *
+     * @returns
+     * Number of rows
+     */
+    size_t
+    GetNRow() const;
+
+    /**
+     * @brief
+     * Get number of cols of the decomposed matrix
+     *
+     * @returns
+     * Number of cols
+     */
+    size_t
+    GetNCol() const;
+
+    /**
+     * @brief
+     * Get the precision of the factors
+     *
+     * @returns
+     * Precision of the factors
+     */
+    mpcr::definitions::Precision
+    GetPrecision();
+
+    /**
+     * @brief
+     * Check whether an exactly zero pivot was met while decomposing.
+     *
+     * @returns
+     * true if the decomposed matrix is singular (rank deficient for QR).
+     */
+    bool
+    IsSingular() const;
+
+    /**
+     * @brief
+     * Solve A X = B using the stored factors, for QR the least squares
+     * solution is returned.
+     *
+     * @param[in] aInputB
+     * MPCR Matrix or vector B, converted to the factors' precision if needed
+     * @param[out] aOutput
+     * MPCR Matrix X of dimensions (ncol(A), ncol(B))
+     *
+     */
+    void
+    Solve(DataType &aInputB, DataType &aOutput);
+
+    /**
+     * @brief
+     * Compute the inverse of the decomposed square matrix.
+     *
+     * @param[out] aOutput
+     * MPCR Matrix holding the inverse of A
+     *
+     */
+    void
+    Inverse(DataType &aOutput);
+
+    /**
+     * @brief
+     * Compute the determinant of the decomposed square matrix from the
+     * diagonal of the factors.
+     *
+     * @param[out] aModulus
+     * Modulus of the determinant
+     * @param[out] aSign
+     * Sign of the determinant, either 1 or -1
+     * @param[in] aLogarithm
+     * if true, the logarithm of the modulus is returned
+     *
+     */
+    void
+    Determinant(double &aModulus, int &aSign, const bool &aLogarithm = true);
+
+    /**
+     * @brief
+     * Estimate the reciprocal condition number of the decomposed square
+     * matrix without refactoring it. For QR the estimate is the one of the
+     * triangular factor R.
+     *
+     * @param[in] aNorm
+     * "O" for the 1-norm, "I" for the infinity norm
+     *
+     * @returns
+     * Reciprocal condition number
+     */
+    double
+    ReciprocalCondition(const std::string &aNorm = "O");
+
+    /**
+     * @brief
+     * Print a summary of the factorization.
+     *
+     */
+    void
+    Print();
+
+    /**
+     * @brief
+     * Checks if the object is an MPCR Factorization object.
+     *
+     * @returns
+     * true if the object is an MPCR Factorization, false otherwise.
+     */
+    inline
+    bool
+    IsMPCRFactorization() const {
+        return ( this->mMagicNumber == 914 );
+    }
+
+private:
+
+    /**
+     * @brief
+     * Dispatcher for decomposing the input matrix according to its precision
+     *
+     * @param[in] aInput
+     * MPCR Matrix to decompose
+     *
+     */
+    template <typename T>
+    void
+    FactorizeDispatcher(DataType &aInput);
+
+    /**
+     * @brief
+     * Dispatcher for solving against the stored factors
+     *
+     * @param[in,out] aOutput
+     * B on entry, X on exit, in the precision of the factors
+     *
+     */
+    template <typename T>
+    void
+    SolveDispatcher(DataType &aOutput);
+
+    /**
+     * @brief
+     * Dispatcher for inverting an LU or Cholesky factorization
+     *
+     * @param[out] aOutput
+     * MPCR Matrix holding the inverse of A
+     *
+     */
+    template <typename T>
+    void
+    InverseDispatcher(DataType &aOutput);
+
+    /**
+     * @brief
+     * Dispatcher for accumulating the log determinant over the diagonal
+     *
+     * @param[out] aModulus
+     * Logarithm of the modulus of the determinant
+     * @param[out] aSign
+     * Sign of the determinant
+     *
+     */
+    template <typename T>
+    void
+    DeterminantDispatcher(double &aModulus, int &aSign);
+
+    /**
+     * @brief
+     * Dispatcher for estimating the reciprocal condition number
+     *
+     * @param[in] aNorm
+     * "O" for the 1-norm, "I" for the infinity norm
+     * @param[out] aOutput
+     * Reciprocal condition number
+     *
+     */
+    template <typename T>
+    void
+    ReciprocalConditionDispatcher(const std::string &aNorm, double &aOutput);
+
+    /**
+     * @brief
+     * Throw if the decomposed matrix is not square
+     *
+     */
+    void
+    CheckSquare() const;
+
+    /**
+     * @brief
+     * Throw if the decomposed matrix is singular
+     *
+     */
+    void
+    CheckSingular() const;
+
+
+private:
+    /** LU factors, upper Cholesky factor R, or compact QR holding R **/
+    DataType mFactor;
+    /** Thin orthogonal factor Q of the QR decomposition **/
+    DataType mQ;
+    /** One based pivots, row pivots for LU and column pivots for QR **/
+    std::vector <int64_t> mPivots;
+    /** Decomposition type **/
+    FactorizationType mType;
+    /** 1-norm of the decomposed matrix **/
+    double mNormOne;
+    /** Infinity norm of the decomposed matrix **/
+    double mNormInf;
+    /** Number of elementary reflectors forming Q with a non-zero tau **/
+    size_t mReflectors;
+    /** true if an exactly zero pivot was met **/
+    bool mSingular;
+    /** Magic Number to check if object is MPCR Factorization **/
+    int mMagicNumber;
+
+};
+
+
+#endif //MPCR_MPCRFACTORIZATION_HPP
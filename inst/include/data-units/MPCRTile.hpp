@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_MPCRTILE_HPP
+#define MPCR_MPCRTILE_HPP
+
+
+#include <vector>
+#include <data-units/DataType.hpp>
+
+
+/** Tiled MPCR Matrix, the matrix is split into a grid of DataType tiles
+ *  stored in column major order. Every tile holds its own precision, so
+ *  blocks carrying most of the information (e.g. near the diagonal) can be
+ *  kept in double while the rest is held in single (or half) precision.
+ *  Tiles in the last row / col of the grid are cut to fit the matrix.
+ **/
+class MPCRTile {
+
+public:
+
+    /**
+     * @brief
+     * MPCR Tile constructor, creates a tiled matrix filled with zeros.
+     *
+     * @param[in] aRow
+     * Number of rows of the whole matrix
+     * @param[in] aCol
+     * Number of cols of the whole matrix
+     * @param[in] aTileRow
+     * Number of rows in each tile
+     * @param[in] aTileCol
+     * Number of cols in each tile
+     * @param[in] aPrecision
+     * Precision of all the tiles
+     *
+     */
+    MPCRTile(const size_t &aRow, const size_t &aCol, const size_t &aTileRow,
+             const size_t &aTileCol,
+             const mpcr::definitions::Precision &aPrecision);
+
+    /**
+     * @brief
+     * MPCR Tile constructor from the values of the whole matrix.
+     *
+     * @param[in] aRow
+     * Number of rows of the whole matrix
+     * @param[in] aCol
+     * Number of cols of the whole matrix
+     * @param[in] aTileRow
+     * Number of rows in each tile
+     * @param[in] aTileCol
+     * Number of cols in each tile
+     * @param[in] aValues
+     * Values of the whole matrix in column major order
+     * @param[in] aPrecisions
+     * Precision of each tile, tiles are ordered in column major order over
+     * the tile grid. A single precision is used for all the tiles.
+     *
+     */
+    MPCRTile(const size_t &aRow, const size_t &aCol, const size_t &aTileRow,
+             const size_t &aTileCol, const std::vector <double> &aValues,
+             const std::vector <std::string> &aPrecisions);
+
+    /**
+     * @brief
+     * MPCR Tile copy constructor, tiles are deep copied.
+     *
+     * @param[in] aTile
+     * MPCR Tile to copy
+     *
+     */
+    MPCRTile(const MPCRTile &aTile);
+
+    /**
+     * @brief
+     * MPCR Tile copy assignment, tiles are deep copied.
+     *
+     * @param[in] aTile
+     * MPCR Tile to copy
+     *
+     * @returns
+     * Reference to the copied object
+     *
+     */
+    MPCRTile &
+    operator =(const MPCRTile &aTile);
+
+    /**
+     * @brief
+     * MPCR Tile De-Constructor, frees all the tiles.
+     */
+    ~MPCRTile();
+
+    /**
+     * @brief
+     * Get number of rows of the whole matrix
+     *
+     * @returns
+     * Number of rows
+     */
+    size_t
+    GetNRow() const;
+
+    /**
+     * @brief
+     * Get number of cols of the whole matrix
+     *
+     * @returns
+     * Number of cols
+     */
+    size_t
+    GetNCol() const;
+
+    /**
+     * @brief
+     * Get number of rows in each tile
+     *
+     * @returns
+     * Number of rows in each tile
+     */
+    size_t
+    GetTileNRow() const;
+
+    /**
+     * @brief
+     * Get number of cols in each tile
+     *
+     * @returns
+     * Number of cols in each tile
+     */
+    size_t
+    GetTileNCol() const;
+
+    /**
+     * @brief
+     * Get number of tiles along the rows of the matrix
+     *
+     * @returns
+     * Number of rows of the tile grid
+     */
+    size_t
+    GetGridNRow() const;
+
+    /**
+     * @brief
+     * Get number of tiles along the cols of the matrix
+     *
+     * @returns
+     * Number of cols of the tile grid
+     */
+    size_t
+    GetGridNCol() const;
+
+    /**
+     * @brief
+     * Get a tile from the tile grid, the tile is still owned by the object.
+     *
+     * @param[in] aTileRowIdx
+     * Row index of the tile in the grid
+     * @param[in] aTileColIdx
+     * Col index of the tile in the grid
+     *
+     * @returns
+     * Pointer to the tile
+     */
+    DataType *
+    GetTile(const size_t &aTileRowIdx, const size_t &aTileColIdx);
+
+    /**
+     * @brief
+     * Replace a tile in the grid with a copy of the given MPCR Matrix, the
+     * new tile must have the same dimensions as the replaced one.
+     *
+     * @param[in] aTile
+     * MPCR Matrix to insert
+     * @param[in] aTileRowIdx
+     * Row index of the tile in the grid
+     * @param[in] aTileColIdx
+     * Col index of the tile in the grid
+     *
+     */
+    void
+    InsertTile(DataType &aTile, const size_t &aTileRowIdx,
+               const size_t &aTileColIdx);
+
+    /**
+     * @brief
+     * Change the precision of one tile.
+     *
+     * @param[in] aTileRowIdx
+     * Row index of the tile in the grid
+     * @param[in] aTileColIdx
+     * Col index of the tile in the grid
+     * @param[in] aPrecision
+     * New precision of the tile
+     *
+     */
+    void
+    ChangeTilePrecision(const size_t &aTileRowIdx, const size_t &aTileColIdx,
+                        const mpcr::definitions::Precision &aPrecision);
+
+    /**
+     * @brief
+     * Get a value from the whole matrix
+     *
+     * @param[in] aRow
+     * Row index
+     * @param[in] aCol
+     * Col index
+     *
+     * @returns
+     * Value at (aRow, aCol)
+     */
+    double
+    GetVal(const size_t &aRow, const size_t &aCol);
+
+    /**
+     * @brief
+     * Set a value in the whole matrix
+     *
+     * @param[in] aRow
+     * Row index
+     * @param[in] aCol
+     * Col index
+     * @param[in] aVal
+     * Value to set
+     *
+     */
+    void
+    SetVal(const size_t &aRow, const size_t &aCol, const double &aVal);
+
+    /**
+     * @brief
+     * Assemble the tiles into one dense MPCR Matrix.
+     *
+     * @param[out] aOutput
+     * Dense MPCR Matrix
+     * @param[in] aPrecision
+     * Precision of the output Matrix
+     *
+     */
+    void
+    GetMatrix(DataType &aOutput,
+              const mpcr::definitions::Precision &aPrecision);
+
+    /**
+     * @brief
+     * Print the whole matrix, up to 100 rows.
+     *
+     */
+    void
+    Print();
+
+    /**
+     * @brief
+     * Checks if the object is an MPCR Tile object.
+     *
+     * @returns
+     * true if the object is an MPCR Tile, false otherwise.
+     */
+    inline
+    bool
+    IsMPCRTile() const {
+        return ( this->mMagicNumber == 913 );
+    }
+
+private:
+
+    /**
+     * @brief
+     * Allocate the tile grid and fill the tiles from the whole matrix values.
+     *
+     * @param[in] aPrecisions
+     * Precision of each tile in column major order over the grid
+     * @param[in] apValues
+     * Values of the whole matrix in column major order, if nullptr the tiles
+     * are filled with zeros.
+     *
+     */
+    void
+    InitializeTiles(
+        const std::vector <mpcr::definitions::Precision> &aPrecisions,
+        const std::vector <double> *apValues);
+
+    /**
+     * @brief
+     * Dispatcher for assembling the tiles according to the output precision
+     *
+     * @param[out] aOutput
+     * Dense MPCR Matrix, precision already set
+     *
+     */
+    template <typename T>
+    void
+    GetMatrixDispatcher(DataType &aOutput);
+
+    /**
+     * @brief
+     * Free all the tiles
+     *
+     */
+    void
+    ClearUp();
+
+    /**
+     * @brief
+     * Check the given tile index against the grid dimensions
+     *
+     */
+    void
+    CheckTileIndex(const size_t &aTileRowIdx, const size_t &aTileColIdx) const;
+
+
+private:
+    /** Tiles of the matrix in column major order over the grid **/
+    std::vector <DataType *> mTiles;
+    /** Number of rows of the whole matrix **/
+    size_t mRow;
+    /** Number of cols of the whole matrix **/
+    size_t mCol;
+    /** Number of rows in each tile **/
+    size_t mTileRow;
+    /** Number of cols in each tile **/
+    size_t mTileCol;
+    /** Number of tiles along the rows **/
+    size_t mGridRow;
+    /** Number of tiles along the cols **/
+    size_t mGridCol;
+    /** Magic Number to check if object is MPCR Tile **/
+    int mMagicNumber;
+
+};
+
+
+#endif //MPCR_MPCRTILE_HPP
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_SPARSEDATATYPE_HPP
+#define MPCR_SPARSEDATATYPE_HPP
+
+
+#include <vector>
+#include <data-units/DataType.hpp>
+
+
+/** Enum describing the compressed layout of a sparse matrix **/
+enum class SparseFormat {
+    /** Compressed Sparse Row **/
+    CSR,
+    /** Compressed Sparse Column **/
+    CSC
+};
+
+
+/** Sparse Matrix in compressed row (CSR) or compressed column (CSC) format.
+ *  For CSR, the pointers array holds nrow+1 offsets into the indices
+ *  (column index of each non-zero) and values arrays, CSC is the same with
+ *  the roles of rows and columns swapped. Values are float or double, indices
+ *  and pointers are int64, all held inside DataHolders.
+ **/
+class SparseDataType {
+
+public:
+
+    /**
+     * @brief
+     * Sparse DataType constructor, creates an empty sparse matrix.
+     *
+     * @param[in] aPrecision
+     * Precision of the values (FLOAT or DOUBLE)
+     * @param[in] aFormat
+     * Compressed layout of the matrix
+     *
+     */
+    explicit
+    SparseDataType(const mpcr::definitions::Precision &aPrecision,
+                   const SparseFormat &aFormat = SparseFormat::CSR);
+
+    /**
+     * @brief
+     * Sparse DataType constructor from triplets (row, col, value), zero based.
+     * Duplicated entries are summed.
+     *
+     * @param[in] aRowIdx
+     * Row index of each entry
+     * @param[in] aColIdx
+     * Column index of each entry
+     * @param[in] aValues
+     * Value of each entry
+     * @param[in] aNumRow
+     * Number of rows of the matrix
+     * @param[in] aNumCol
+     * Number of cols of the matrix
+     * @param[in] aPrecision
+     * Precision of the values (FLOAT or DOUBLE)
+     * @param[in] aFormat
+     * Compressed layout of the matrix
+     *
+     */
+    SparseDataType(const std::vector <size_t> &aRowIdx,
+                   const std::vector <size_t> &aColIdx,
+                   const std::vector <double> &aValues,
+                   const size_t &aNumRow, const size_t &aNumCol,
+                   const mpcr::definitions::Precision &aPrecision,
+                   const SparseFormat &aFormat = SparseFormat::CSR);
+
+    /**
+     * @brief
+     * Sparse DataType copy constructor
+     *
+     * @param[in] aSparseDataType
+     * Sparse DataType to copy
+     *
+     */
+    SparseDataType(const SparseDataType &aSparseDataType);
+
+    /**
+     * @brief
+     * Sparse DataType copy assignment
+     *
+     * @param[in] aSparseDataType
+     * Sparse DataType to copy
+     *
+     * @returns
+     * Reference to the copied object
+     *
+     */
+    SparseDataType &
+    operator =(const SparseDataType &aSparseDataType);
+
+    /**
+     * @brief
+     * Sparse DataType De-Constructor
+     */
+    ~SparseDataType() = default;
+
+    /**
+     * @brief
+     * Get number of rows
+     *
+     * @returns
+     * Number of rows of the matrix
+     */
+    size_t
+    GetNRow() const;
+
+    /**
+     * @brief
+     * Get number of cols
+     *
+     * @returns
+     * Number of cols of the matrix
+     */
+    size_t
+    GetNCol() const;
+
+    /**
+     * @brief
+     * Get number of stored non-zero entries
+     *
+     * @returns
+     * Number of non-zeros
+     */
+    size_t
+    GetNnz() const;
+
+    /**
+     * @brief
+     * Get precision of the values
+     *
+     * @returns
+     * Precision of the values
+     */
+    mpcr::definitions::Precision &
+    GetPrecision();
+
+    /**
+     * @brief
+     * Get the compressed layout of the matrix
+     *
+     * @returns
+     * SparseFormat of the matrix
+     */
+    SparseFormat
+    GetFormat() const;
+
+    /**
+     * @brief
+     * Get the values buffer (Must be casted according to precision)
+     *
+     * @param[in] aOperationPlacement
+     * Enum to decide which pointer should be returned.
+     *
+     * @returns
+     * Char pointer pointing to the values
+     */
+    char *
+    GetValues(const OperationPlacement &aOperationPlacement = CPU);
+
+    /**
+     * @brief
+     * Get the indices buffer, column index of each value in case of CSR and
+     * row index in case of CSC.
+     *
+     * @param[in] aOperationPlacement
+     * Enum to decide which pointer should be returned.
+     *
+     * @returns
+     * Pointer to the indices
+     */
+    int64_t *
+    GetIndices(const OperationPlacement &aOperationPlacement = CPU);
+
+    /**
+     * @brief
+     * Get the pointers buffer, offset of each row (CSR) or col (CSC) in the
+     * indices and values buffers.
+     *
+     * @param[in] aOperationPlacement
+     * Enum to decide which pointer should be returned.
+     *
+     * @returns
+     * Pointer to the offsets
+     */
+    int64_t *
+    GetPointers(const OperationPlacement &aOperationPlacement = CPU);
+
+    /**
+     * @brief
+     * Transpose the sparse matrix. The CSR buffers of a matrix are the CSC
+     * buffers of its transpose, so only the format and dimensions change.
+     *
+     */
+    void
+    Transpose();
+
+    /**
+     * @brief
+     * Convert the matrix to the requested compressed layout, the buffers are
+     * rebuilt in O(nnz) using a counting sort.
+     *
+     * @param[in] aFormat
+     * Requested compressed layout
+     *
+     */
+    void
+    ConvertFormat(const SparseFormat &aFormat);
+
+    /**
+     * @brief
+     * Expand the sparse matrix into a dense MPCR Matrix.
+     *
+     * @param[out] aOutput
+     * Dense MPCR Matrix with the same precision
+     *
+     */
+    void
+    ToDense(DataType &aOutput);
+
+    /**
+     * @brief
+     * Get a value from the matrix
+     *
+     * @param[in] aRow
+     * Row index
+     * @param[in] aCol
+     * Col index
+     *
+     * @returns
+     * Stored value, or zero in case the entry is not stored
+     */
+    double
+    GetVal(const size_t &aRow, const size_t &aCol);
+
+    /**
+     * @brief
+     * Print the stored entries as (row, col) value triplets.
+     *
+     */
+    void
+    Print();
+
+    /**
+     * @brief
+     * Checks if the object is a Sparse DataType object.
+     *
+     * @returns
+     * true if the object is a Sparse DataType, false otherwise.
+     */
+    inline
+    bool
+    IsSparseDataType() const {
+        return ( this->mMagicNumber == 912 );
+    }
+
+private:
+
+    /**
+     * @brief
+     * Dispatcher for building the compressed buffers from triplets according
+     * to precision
+     *
+     */
+    template <typename T>
+    void
+    FromTripletsDispatcher(const std::vector <size_t> &aRowIdx,
+                           const std::vector <size_t> &aColIdx,
+                           const std::vector <double> &aValues);
+
+    /**
+     * @brief
+     * Dispatcher for converting the compressed layout according to precision
+     *
+     */
+    template <typename T>
+    void
+    ConvertFormatDispatcher();
+
+    /**
+     * @brief
+     * Dispatcher for expanding the matrix to dense according to precision
+     *
+     * @param[out] aOutput
+     * Dense MPCR Matrix
+     *
+     */
+    template <typename T>
+    void
+    ToDenseDispatcher(DataType &aOutput);
+
+    /**
+     * @brief
+     * Dispatcher for getting a value according to precision
+     *
+     */
+    template <typename T>
+    void
+    GetValueDispatcher(const size_t &aRow, const size_t &aCol,
+                       double &aOutput);
+
+    /**
+     * @brief
+     * Dispatcher for printing the entries according to precision
+     *
+     */
+    template <typename T>
+    void
+    PrintDispatcher();
+
+    /**
+     * @brief
+     * Number of rows (CSR) or cols (CSC), i.e. the compressed dimension
+     *
+     */
+    inline
+    size_t
+    GetOuterSize() const {
+        return ( this->mFormat == SparseFormat::CSR ) ? this->mNumRow
+                                                      : this->mNumCol;
+    }
+
+
+private:
+    /** Buffer holding the non-zero values **/
+    DataHolder mValues;
+    /** Buffer holding the column (CSR) or row (CSC) index of each value **/
+    DataHolder mIndices;
+    /** Buffer holding the row (CSR) or col (CSC) offsets **/
+    DataHolder mPointers;
+    /** Number of rows of the matrix **/
+    size_t mNumRow;
+    /** Number of cols of the matrix **/
+    size_t mNumCol;
+    /** Number of stored non-zero values **/
+    size_t mNnz;
+    /** Precision used to describe the values buffer **/
+    mpcr::definitions::Precision mPrecision;
+    /** Compressed layout of the matrix **/
+    SparseFormat mFormat;
+    /** Magic Number to check if object is Sparse DataType **/
+    int mMagicNumber;
+
+};
+
+
+#endif //MPCR_SPARSEDATATYPE_HPP
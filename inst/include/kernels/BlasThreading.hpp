@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_BLASTHREADING_HPP
+#define MPCR_BLASTHREADING_HPP
+
+
+namespace mpcr {
+    namespace kernels {
+
+        /**
+         * @brief
+         * Get the number of threads an OpenMP parallel region would use,
+         * which honors OMP_NUM_THREADS. 1 if built without OpenMP.
+         *
+         * @returns
+         * Maximum number of OpenMP threads
+         */
+        int
+        GetMaxThreads();
+
+
+        /** Scope keeping BLAS / LAPACK calls single threaded while alive,
+         *  for regions running independent problems on every core.
+         *  Nested OpenMP regions are disabled, which covers BLAS libraries
+         *  threaded with OpenMP, and the thread count of BLAS libraries
+         *  exposing one at runtime (OpenBLAS, MKL, BLIS) is set to 1.
+         *  Both are restored when the scope ends.
+         **/
+        class SequentialBlasScope {
+
+        public:
+
+            /**
+             * @brief
+             * Sequential BLAS scope constructor, must be created outside of
+             * the parallel region.
+             */
+            SequentialBlasScope();
+
+            /**
+             * @brief
+             * Sequential BLAS scope De-Constructor, restores the previous
+             * threading settings.
+             */
+            ~SequentialBlasScope();
+
+            SequentialBlasScope(const SequentialBlasScope &) = delete;
+
+            SequentialBlasScope &
+            operator =(const SequentialBlasScope &) = delete;
+
+        private:
+            /** OpenMP max active levels before the scope **/
+            int mMaxActiveLevels;
+            /** OpenBLAS threads before the scope, -1 if not available **/
+            int mOpenBlasThreads;
+            /** MKL threads before the scope, -1 if not available **/
+            int mMklThreads;
+            /** BLIS threads before the scope, -1 if not available **/
+            int mBlisThreads;
+
+        };
+
+    }
+}
+
+
+#endif //MPCR_BLASTHREADING_HPP
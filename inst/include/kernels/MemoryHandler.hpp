@@ -45,6 +45,29 @@ namespace mpcr {
                       const OperationPlacement &aPlacement,
                       const kernels::RunContext *aContext);
 
+        /**
+         * @brief
+         * Resize a previously allocated array, preserving its content up to the
+         * smaller of the two sizes. Host buffers are resized using realloc,
+         * which allows the allocator to grow or shrink the buffer in place
+         * (mremap for large mappings) instead of keeping two copies alive.
+         *
+         * @param[in,out] apArray
+         * The pointer to resize, updated with the new buffer address.
+         *
+         * @param[in] aOldSizeInBytes
+         * Current size of the array in bytes.
+         *
+         * @param[in] aNewSizeInBytes
+         * Required size of the array in bytes.
+         *
+         */
+        void
+        ReallocateArray(char *&apArray, const size_t &aOldSizeInBytes,
+                        const size_t &aNewSizeInBytes,
+                        const OperationPlacement &aPlacement,
+                        const kernels::RunContext *aContext);
+
         /**
          * @brief
          * Deallocate a previously allocated array.
@@ -57,6 +80,42 @@ namespace mpcr {
         DestroyArray(char *&apArray, const OperationPlacement &aPlacement,
                      const kernels::RunContext *aContext);
 
+        /**
+         * @brief
+         * Get a scratch array that doesn't outlive the calling operation.
+         * Host arrays are taken from the scratch arena of the context, so
+         * repeated calls on the same shapes don't hit the allocator, device
+         * arrays, arrays above the scratch limit of the context (or a
+         * missing context) fall back to AllocateArray.
+         *
+         * @param[in] aSizeInBytes
+         * Required size of the array in bytes.
+         * @param[in] aSlot
+         * Scratch slot of the context, arrays alive at the same time must
+         * use different slots.
+         *
+         */
+        char *
+        RequestScratchArray(const size_t &aSizeInBytes,
+                            const OperationPlacement &aPlacement,
+                            const kernels::RunContext *aContext,
+                            const size_t &aSlot);
+
+        /**
+         * @brief
+         * Release an array returned by RequestScratchArray, arrays owned by
+         * the context arena are kept for the next request, the others are
+         * freed.
+         *
+         * @param[in,out] apArray
+         * The pointer to release, set to nullptr.
+         *
+         */
+        void
+        ReleaseScratchArray(char *&apArray,
+                            const OperationPlacement &aPlacement,
+                            const kernels::RunContext *aContext);
+
         /**
          * @brief
          * Copy memory from a source pointer to a target pointer according to the transfer type.
@@ -158,6 +158,41 @@ namespace mpcr {
         }
 
 
+        /**
+         * @brief
+         * Check whether the internal precision of an operation requests a
+         * reduced precision factorization.
+         * Transforms the string to lower case to ensure proper parsing
+         *
+         * @param[in] aInternalPrecision
+         * "same", "double", "single", "float", "half" or "tensorfloat"
+         *
+         * @returns
+         * false for "same" and "double", true for the reduced precisions,
+         * or throw exception in-case it's not supported
+         */
+        inline
+        bool
+        IsReducedPrecision(std::string aInternalPrecision) {
+            std::transform(aInternalPrecision.begin(),
+                           aInternalPrecision.end(),
+                           aInternalPrecision.begin(), ::tolower);
+
+            if (aInternalPrecision == "same" ||
+                aInternalPrecision == "double") {
+                return false;
+            } else if (aInternalPrecision == "single" ||
+                       aInternalPrecision == "float" ||
+                       aInternalPrecision == "half" ||
+                       aInternalPrecision == "tensorfloat") {
+                return true;
+            }
+            auto msg = "Unknown internal precision " + aInternalPrecision;
+            MPCR_API_EXCEPTION(msg.c_str(), -1);
+            return false;
+        }
+
+
         /**
          * @brief
          * Get Precision for any Precision class as a string
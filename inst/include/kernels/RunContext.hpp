@@ -12,6 +12,7 @@
 #include <utilities/MPCRErrorHandler.hpp>
 #include <common/Definitions.hpp>
 #include <cstddef>
+#include <vector>
 
 
 #ifdef USE_CUDA
@@ -128,6 +129,78 @@ namespace mpcr {
             void
             Sync() const;
 
+            /**
+             * @brief
+             * Request a host scratch buffer from the context arena.
+             * Each slot holds one buffer that only grows, so repeated
+             * operations on the same shapes reuse the same memory instead of
+             * going through the allocator on every call. The content is not
+             * preserved when a slot grows.
+             * Requests above GetScratchLimitHost() are not served, so a
+             * single large call doesn't pin its buffers for the lifetime of
+             * the context.
+             * The buffer stays owned by the context, and the arena is not
+             * thread safe, so it must not be used inside parallel regions.
+             *
+             * @param[in] aBufferSize
+             * Requested size in bytes.
+             * @param[in] aSlot
+             * Index of the scratch slot.
+             *
+             * @returns
+             * void pointer to the scratch buffer, nullptr if the size is zero
+             * or above the scratch limit.
+             *
+             */
+            void *
+            RequestScratchBufferHost(const size_t &aBufferSize,
+                                     const size_t &aSlot) const;
+
+            /**
+             * @brief
+             * Get the largest request in bytes served by a host scratch slot.
+             *
+             * @returns
+             * Scratch limit in bytes.
+             *
+             */
+            size_t
+            GetScratchLimitHost() const;
+
+            /**
+             * @brief
+             * Check whether a buffer is held by one of the host scratch
+             * slots of the context.
+             *
+             * @param[in] apBuffer
+             * Buffer to check.
+             *
+             * @returns
+             * true if the buffer belongs to the scratch arena.
+             *
+             */
+            bool
+            IsScratchBufferHost(const void *apBuffer) const;
+
+            /**
+             * @brief
+             * Get the total size in bytes held by the host scratch arena.
+             *
+             * @returns
+             * Size of all the scratch slots in bytes.
+             *
+             */
+            size_t
+            GetScratchBufferSizeHost() const;
+
+            /**
+             * @brief
+             * Free all the host scratch buffers held by the context.
+             *
+             */
+            void
+            FreeScratchBuffersHost() const;
+
 #ifdef USE_CUDA
 
             /**
@@ -252,6 +325,8 @@ namespace mpcr {
             /** Cuda stream **/
             cudaStream_t mCudaStream;
 #endif
+            /** Host scratch buffers and their sizes, one per slot **/
+            mutable std::vector <std::pair <char *, size_t>> mScratchBuffersHost;
             /** Enum indicating whether the operation is sync or async **/
             RunMode mRunMode;
             /** Enum indicating whether the operation is done on GPU or CPU **/
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_BATCHLINEARALGEBRA_HPP
+#define MPCR_BATCHLINEARALGEBRA_HPP
+
+
+#include <data-units/DataType.hpp>
+
+
+namespace mpcr {
+    namespace operations {
+        namespace batch {
+
+            /**
+             * Batched routines run one independent problem per entry of the
+             * input vectors. Problems sharing the precision and dimensions
+             * of their operands are grouped, each group is dispatched once
+             * and its problems are scheduled across the cores, every problem
+             * running single threaded BLAS / LAPACK calls inside the OpenMP
+             * parallel region. Operands of a problem are computed in the
+             * precision of its first operand, and output objects must be
+             * distinct from each other and from the operands. The kernels
+             * run on the CPU.
+             **/
+
+            /**
+             * @brief
+             * Batched matrix-matrix multiplication
+             * performs, for each problem i:
+             * C[i] = alpha * op(A[i]) %*% op(B[i]) + beta * C[i]
+             *
+             * @param[in] aInputA
+             * MPCR Matrices A
+             * @param[in] aInputB
+             * MPCR Matrices B
+             * @param[in,out] aInputC
+             * MPCR Matrices C, only referenced if beta is not zero
+             * @param[in] aTransposeA
+             * if true, op(A) = t(A)
+             * @param[in] aTransposeB
+             * if true, op(B) = t(B)
+             * @param[in] aAlpha
+             * Scalar alpha
+             * @param[in] aBeta
+             * Scalar beta
+             *
+             */
+            void
+            BatchGemm(std::vector <DataType *> &aInputA,
+                      std::vector <DataType *> &aInputB,
+                      std::vector <DataType *> &aInputC,
+                      const bool &aTransposeA, const bool &aTransposeB,
+                      const double &aAlpha, const double &aBeta);
+
+            /**
+             * @brief
+             * Batched Cholesky decomposition, the other triangle of each
+             * factor is set to zero.
+             *
+             * @param[in] aInputs
+             * MPCR symmetric positive definite Matrices
+             * @param[out] aOutputs
+             * Cholesky factors
+             * @param[in] aUpperTriangle
+             * if true, the upper factors R (A = t(R) R) are computed,
+             * otherwise the lower factors L (A = L t(L))
+             *
+             */
+            void
+            BatchCholesky(std::vector <DataType *> &aInputs,
+                          std::vector <DataType *> &aOutputs,
+                          const bool &aUpperTriangle);
+
+            /**
+             * @brief
+             * Batched triangular solve
+             * performs, for each problem i:
+             * op(A[i]) X[i] = alpha B[i]  or  X[i] op(A[i]) = alpha B[i]
+             *
+             * @param[in] aInputA
+             * MPCR triangular square Matrices
+             * @param[in] aInputB
+             * MPCR Matrices B
+             * @param[out] aOutputs
+             * Solutions X
+             * @param[in] aLeftSide
+             * if true, op(A) X = alpha B, otherwise X op(A) = alpha B
+             * @param[in] aUpperTriangle
+             * if true, A is upper triangular, otherwise lower triangular
+             * @param[in] aTranspose
+             * if true, op(A) = t(A)
+             * @param[in] aAlpha
+             * Scalar alpha
+             *
+             */
+            void
+            BatchTrsm(std::vector <DataType *> &aInputA,
+                      std::vector <DataType *> &aInputB,
+                      std::vector <DataType *> &aOutputs,
+                      const bool &aLeftSide, const bool &aUpperTriangle,
+                      const bool &aTranspose, const double &aAlpha);
+
+            /**
+             * @brief
+             * Batched general linear solve using LU with partial pivoting
+             * performs, for each problem i:
+             * A[i] X[i] = B[i]
+             *
+             * @param[in] aInputA
+             * MPCR square Matrices
+             * @param[in] aInputB
+             * MPCR Matrices or vectors B
+             * @param[out] aOutputs
+             * Solutions X
+             *
+             */
+            void
+            BatchSolve(std::vector <DataType *> &aInputA,
+                       std::vector <DataType *> &aInputB,
+                       std::vector <DataType *> &aOutputs);
+
+            /**
+             * @brief
+             * Batched symmetric eigen decomposition, only the upper
+             * triangle of each matrix is referenced. Values are returned in
+             * decreasing order as for linear::Eigen.
+             *
+             * @param[in] aInputs
+             * MPCR symmetric Matrices
+             * @param[out] aOutputValues
+             * Eigen values of each matrix
+             * @param[out] apOutputVectors
+             * Eigen vectors of each matrix, not computed if nullptr
+             *
+             */
+            void
+            BatchEigen(std::vector <DataType *> &aInputs,
+                       std::vector <DataType *> &aOutputValues,
+                       std::vector <DataType *> *apOutputVectors);
+
+        }
+    }
+}
+
+
+#endif //MPCR_BATCHLINEARALGEBRA_HPP
@@ -55,11 +55,39 @@ namespace mpcr {
              * MPCR Matrix
              * @param[out] aOutput
              * true if symmetric ,false otherwise
+             * @param[in] aTolerance
+             * Largest absolute difference allowed between mirrored entries,
+             * a negative value uses the machine epsilon of the precision.
+             * The answer is cached on the Matrix until its data is modified,
+             * only a pass at tolerance 0 marks it symmetric for the solvers.
              *
              */
             template <typename T>
             void
-            IsSymmetric(DataType &aInput, bool &aOutput);
+            IsSymmetric(DataType &aInput, bool &aOutput,
+                        const double &aTolerance = -1);
+
+            /**
+             * @brief
+             * Calculate t(x) %*% x or x %*% t(x) directly into packed
+             * storage, only one triangle of the symmetric output is computed
+             * and stored.
+             *
+             * @param[in] aInput
+             * MPCR Matrix
+             * @param[out] aOutput
+             * Packed symmetric MPCR Matrix
+             * @param[in] aTranspose
+             * if true, t(x) %*% x is computed, otherwise x %*% t(x)
+             * @param[in] aUpperTriangle
+             * if true, the upper triangle is stored, otherwise the lower one.
+             *
+             */
+            template <typename T>
+            void
+            PackedCrossProduct(DataType &aInput, DataType &aOutput,
+                               const bool &aTranspose,
+                               const bool &aUpperTriangle = true);
 
             /**
              * @brief
@@ -69,12 +97,55 @@ namespace mpcr {
              * MPCR Matrix
              * @param[out] aOutput
              * MPCR Matrix containing decomposition result
+             * @param[in] aUpperTriangle
+             * if true, the upper factor is returned, otherwise the lower one.
+             * @param[in] aOverwrite
+             * if true, the factorization is done in the buffer of aInputA,
+             * which is handed over to aOutput and aInputA is left empty.
+             *
+             */
+            template <typename T>
+            void
+            Cholesky(DataType &aInputA, DataType &aOutput,
+                     const bool &aUpperTriangle = true,
+                     const bool &aOverwrite = false);
+
+            /**
+             * @brief
+             * Calculate an adaptive mixed-precision Cholesky decomposition.
+             * The matrix is split into square tiles, diagonal tiles are
+             * factorized in the caller's precision while an off-diagonal
+             * tile is demoted to single precision when
+             * ||A(i,j)||_F * u_single <= aTolerance * ||A||_F / nt,
+             * nt being the number of tiles along one dimension. Tiles of
+             * covariance matrices decaying away from the diagonal end up in
+             * single precision. The factor is returned in the caller's
+             * precision.
+             *
+             * @param[in] aInputA
+             * MPCR symmetric positive definite Matrix
+             * @param[out] aOutput
+             * MPCR Matrix containing decomposition result
+             * @param[in] aUpperTriangle
+             * if true, the upper factor is returned, otherwise the lower one.
+             * @param[in] aTolerance
+             * Accuracy required relative to ||A||_F
+             * @param[in] aTileSize
+             * Size of the square tiles
+             * @param[out] aAccuracy
+             * Achieved accuracy ||A - t(R) %*% R||_F / ||A||_F, estimated
+             * in O(n^2) from a few random matrix-vector products
+             * @param[out] aFlopShare
+             * Share of the flops run in each precision, indexed as
+             * {half, single, double}
              *
              */
             template <typename T>
             void
             Cholesky(DataType &aInputA, DataType &aOutput,
-                     const bool &aUpperTriangle = true);
+                     const bool &aUpperTriangle, const double &aTolerance,
+                     const size_t &aTileSize, double &aAccuracy,
+                     std::vector <double> &aFlopShare);
 
             /**
              * @brief
@@ -85,12 +156,49 @@ namespace mpcr {
              * MPCR Matrix containing Cholesky decomposition.
              * @param[out] aOutput
              * MPCR Matrix
+             * @param[in] aInternalPrecision
+             * Precision used for inverting a double precision factor on CPU,
+             * with (float or single), half the inverse is computed in single
+             * precision, without refinement, and returned as a single
+             * precision Matrix. Reduced precisions are rejected on GPU.
              *
              */
             template <typename T>
             void
             CholeskyInv(DataType &aInputA, DataType &aOutput,
-                        const size_t &aNCol);
+                        const size_t &aNCol,
+                        const std::string &aInternalPrecision = "same");
+
+            /**
+             * @brief
+             * Solves the equation AX=B for a symmetric positive definite
+             * matrix A using its Cholesky decomposition, only the upper
+             * triangle of A is referenced.
+             *
+             * @param[in] aInputA
+             * MPCR symmetric positive definite Matrix A
+             * @param[in] aInputB
+             * MPCR Matrix B
+             * @param[out] aOutput
+             * MPCR Matrix X
+             * @param[in] aSingle
+             * if true only aInputA will be used and the inverse of A is
+             * computed.
+             * @param [in] aInternalPrecision
+             * string that indicate the precision used for the Cholesky
+             * factorization of a double precision A on CPU. With
+             * (float or single), half or tensorfloat, A is factorized in
+             * single precision and the solution is refined with double
+             * precision residuals, falling back to a double factorization
+             * if the refinement stalls. Reduced precisions are rejected on
+             * GPU.
+             *
+             */
+            template <typename T>
+            void
+            CholeskySolve(DataType &aInputA, DataType &aInputB,
+                          DataType &aOutput, const bool &aSingle,
+                          const std::string &aInternalPrecision = "same");
 
             /**
              * @brief
@@ -108,12 +216,16 @@ namespace mpcr {
              * string that indicate the precision used for the LU factorization in
              * case of using GESV routine in CuSolver ( GPU operation & aSingle == false).
              * Options: (float or single) ,half ,tensorfloat
+             * @param[in] aOverwrite
+             * if true, aInputA is factorized in place and left empty, the
+             * inverse is returned in its buffer in case of aSingle.
              *
              */
             template <typename T>
             void
             Solve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
-                  const bool &aSingle,const std::string &aInternalPrecision="same");
+                  const bool &aSingle,const std::string &aInternalPrecision="same",
+                  const bool &aOverwrite = false);
 
 
             /**
@@ -143,6 +255,66 @@ namespace mpcr {
                       const size_t &aCol, const bool &aUpperTri,
                       const bool &aTranspose,const char &aSide='L',const double &aAlpha=1);
 
+            /**
+             * @brief
+             * Multiply by a triangular matrix, only the referenced triangle
+             * of aInputA is read, at half the flops of a general product.
+             * aOutput = alpha op(aInputA) aInputB  or
+             * aOutput = alpha aInputB op(aInputA)
+             *
+             * @param[in] aInputA
+             * MPCR square triangular Matrix
+             * @param[in] aInputB
+             * MPCR Matrix, a vector is used as a column for the left side
+             * and as a row for the right side
+             * @param[out] aOutput
+             * MPCR Matrix holding the product
+             * @param[in] aUpperTri
+             * if true, the upper triangle of aInputA is used, otherwise the
+             * lower one.
+             * @param[in] aTranspose
+             * if true, op(aInputA) = t(aInputA)
+             * @param[in] aSide
+             * 'L' to multiply from the left, 'R' from the right
+             * @param[in] aAlpha
+             * Scalar alpha
+             */
+            template <typename T>
+            void
+            TriangularMultiply(DataType &aInputA, DataType &aInputB,
+                               DataType &aOutput, const bool &aUpperTri,
+                               const bool &aTranspose, const char &aSide = 'L',
+                               const double &aAlpha = 1);
+
+            /**
+             * @brief
+             * Multiply by a symmetric matrix, only the referenced triangle of
+             * aInputA is read.
+             * aOutput = alpha aInputA aInputB  or
+             * aOutput = alpha aInputB aInputA
+             *
+             * @param[in] aInputA
+             * MPCR square symmetric Matrix
+             * @param[in] aInputB
+             * MPCR Matrix, a vector is used as a column for the left side
+             * and as a row for the right side
+             * @param[out] aOutput
+             * MPCR Matrix holding the product
+             * @param[in] aUpperTri
+             * if true, the upper triangle of aInputA is used, otherwise the
+             * lower one.
+             * @param[in] aSide
+             * 'L' to multiply from the left, 'R' from the right
+             * @param[in] aAlpha
+             * Scalar alpha
+             */
+            template <typename T>
+            void
+            SymmetricMultiply(DataType &aInputA, DataType &aInputB,
+                              DataType &aOutput, const bool &aUpperTri = true,
+                              const char &aSide = 'L',
+                              const double &aAlpha = 1);
+
             /**
              * @brief
              * Calculate Eigen Values and (optionally) Eigen Vectors.
@@ -154,22 +326,90 @@ namespace mpcr {
              * Eigen Values
              * @param[out] apOutputVectors
              * Eigen Vectors
+             * @param[in] aOverwrite
+             * if true, the vectors are computed in the buffer of aInput,
+             * which is left empty.
              */
             template <typename T>
             void
             Eigen(DataType &aInput, DataType &aOutputValues,
-                  DataType *apOutputVectors = nullptr);
+                  DataType *apOutputVectors = nullptr,
+                  const bool &aOverwrite = false);
+
+            /**
+             * @brief
+             * Calculate a selected range of Eigen Values and (optionally)
+             * Eigen Vectors of a symmetric matrix using Syevr, only the
+             * requested eigenpairs are computed. Indices follow the order of
+             * Eigen, index 1 is the largest eigen value.
+             * Runs on the CPU.
+             *
+             * @param[in] aInput
+             * MPCR Square Symmetric Matrix, only the upper triangle is used
+             * @param[out] aOutputValues
+             * Eigen Values aFirstIndex through aLastIndex, in decreasing order
+             * @param[out] apOutputVectors
+             * Corresponding Eigen Vectors, not computed if nullptr
+             * @param[in] aFirstIndex
+             * One based index of the first (largest) eigen value to compute
+             * @param[in] aLastIndex
+             * One based index of the last (smallest) eigen value to compute
+             */
+            template <typename T>
+            void
+            EigenRange(DataType &aInput, DataType &aOutputValues,
+                       DataType *apOutputVectors, const size_t &aFirstIndex,
+                       const size_t &aLastIndex);
+
+            /**
+             * @brief
+             * Calculate the largest or smallest Eigen Values and (optionally)
+             * Eigen Vectors of a symmetric matrix using a thick restarted
+             * Lanczos iteration with full reorthogonalization. The matrix is
+             * only accessed through products with blocks of vectors (Gemm),
+             * and the Krylov basis is kept in the precision of the matrix,
+             * so float storage halves the memory of the solver.
+             * Runs on the CPU.
+             *
+             * @param[in] aInput
+             * MPCR Square Symmetric Matrix
+             * @param[out] aOutputValues
+             * The aNumValues requested Eigen Values in decreasing order
+             * @param[out] apOutputVectors
+             * Corresponding Eigen Vectors, not returned if nullptr
+             * @param[in] aNumValues
+             * Number of eigenpairs to compute
+             * @param[in] aLargest
+             * if true, the largest eigen values are computed, otherwise the
+             * smallest ones
+             * @param[in] aTolerance
+             * Relative tolerance on the residual norm of each eigenpair
+             * @param[in] aMaxRestarts
+             * Maximum number of restarts before failing
+             * @param[in] aSeed
+             * Seed of the random starting vector
+             */
+            template <typename T>
+            void
+            Lanczos(DataType &aInput, DataType &aOutputValues,
+                    DataType *apOutputVectors, const size_t &aNumValues,
+                    const bool &aLargest = true,
+                    const double &aTolerance = 1e-8,
+                    const size_t &aMaxRestarts = 100,
+                    const size_t &aSeed = 0);
 
             /**
              * @brief
              * Computes a matrix norm of aInput. The norm can be the one ("O") norm,
-             * the infinity ("I") norm, the Frobenius ("F") norm, or the maximum
-             * modulus ("M") among elements of a matrix.
+             * the infinity ("I") norm, the Frobenius ("F" or "E") norm, the
+             * maximum modulus ("M") among elements of a matrix, or the spectral
+             * ("2") norm, estimated on the CPU by a Lanczos bidiagonalization
+             * instead of a full SVD.
              *
              * @param[in] aInput
              * MPCR Matrix
              * @param[in] aType
-             * Type of Norm ( O , 1 , I , F, M)
+             * Type of Norm ( O , 1 , I , F, E, M, 2)
              * @param[out] aOutput
              * Norm Value
              */
@@ -198,13 +438,16 @@ namespace mpcr {
              * @param[in] aTolerance
              * the tolerance for detecting linear dependencies in the columns of
              * aInputA
+             * @param[in] aOverwrite
+             * if true, the decomposition is done in the buffer of aInputA,
+             * which is handed over to aOutputQr and aInputA is left empty.
              *
              */
             template <typename T>
             void
             QRDecomposition(DataType &aInputA, DataType &aOutputQr,
                             DataType &aOutputQraux, DataType &aOutputPivot,
-                            DataType &aRank);
+                            DataType &aRank, const bool &aOverwrite = false);
 
             /**
              * @brief
@@ -254,23 +497,20 @@ namespace mpcr {
 
             /**
              * @brief
-             * Returns part or all of Q, the order-nrow(X) orthogonal (unitary)
-             * transformation represented by qr. If complete is TRUE, Q has
-             * nrow(X) columns. If complete is FALSE, Q has ncol(X) columns.
-             * and each column of Q is multiplied by the corresponding value in Dvec.
+             * Computes Q %*% y, or t(Q) %*% y, where Q is the orthogonal
+             * transformation represented by qr. The Householder reflectors
+             * are applied directly to a copy of y (Ormqr), Q is never formed.
+             *
              * @param[in] aInputA
-             * MPCR Matrix
+             * MPCR Matrix QR
              * @param[in] aInputB
              * MPCR Object Representing QRAUX
              * @param[in] aInputC
-             * MPCR Object Representing DVec
+             * MPCR Matrix or vector y with nrow(QR) rows
              * @param[out] aOutput
-             * returns Q. As MPCR Object.
-             * @param[in] aComplete
-             * logical expression . Indicates whether an arbitrary
-             * orthogonal completion of the Q or X matrices is to be made,
-             * or whether the  matrix is to be completed by binding zero-value
-             * rows beneath the square upper triangle.
+             * returns Q %*% y or t(Q) %*% y. As MPCR Object.
+             * @param[in] aTranspose
+             * if true, t(Q) %*% y is computed, otherwise Q %*% y.
              *
              */
             template <typename T>
@@ -279,6 +519,87 @@ namespace mpcr {
                               DataType &aInputC, DataType &aOutput,
                               const bool &aTranspose);
 
+            /**
+             * @brief
+             * Fits the (weighted, ridge) linear least squares problem
+             * min || W^(1/2) (Y - X B) ||^2 + lambda || B ||^2
+             * for every column of Y. With method "auto" the normal equations
+             * are factorized (Syrk / Potrf) and the QR path (Geqp3 / Ormqr /
+             * Trsm) is used instead when their reciprocal condition number
+             * is below sqrt(eps). X is referenced in place, it is only copied
+             * into a working buffer when it must be weighted, demoted or
+             * factorized by QR. CPU only.
+             *
+             * @param[in] aInputX
+             * MPCR Matrix X (n x p)
+             * @param[in] aInputY
+             * MPCR Matrix or vector Y with n rows
+             * @param[in] apWeights
+             * Non-negative weights of the n observations, unweighted if
+             * nullptr.
+             * @param[out] aCoefficients
+             * MPCR Matrix B (p x ncol(Y)), or vector for a vector Y.
+             * Coefficients of columns aliased by the QR path are NaN.
+             * @param[out] aResiduals
+             * Y - X B, with the dimensions of Y.
+             * @param[out] aRank
+             * Numerical rank of the fit.
+             * @param[in] aLambda
+             * Ridge penalty, non-negative.
+             * @param[in] aMethod
+             * "auto", "qr" or "chol" (normal equations).
+             * @param [in] aInternalPrecision
+             * (float or single), half factorizes a double precision X in
+             * single precision and refines B with double precision
+             * residuals, "same" otherwise. Unknown names are rejected.
+             * @param[in] aTolerance
+             * Relative tolerance on the diagonal of R used to detect the rank
+             * in the QR path.
+             *
+             */
+            template <typename T>
+            void
+            LeastSquares(DataType &aInputX, DataType &aInputY,
+                         DataType *apWeights, DataType &aCoefficients,
+                         DataType &aResiduals, size_t &aRank,
+                         const double &aLambda = 0,
+                         const std::string &aMethod = "auto",
+                         const std::string &aInternalPrecision = "same",
+                         const double &aTolerance = 1e-7);
+
+            /**
+             * @brief
+             * Communication avoiding QR decomposition of a tall and skinny
+             * matrix A (nrow >> ncol) without pivoting. The rows are split
+             * into blocks factorized in parallel, then the R factors of the
+             * blocks are reduced pairwise in a binary tree.
+             * Without Q, every block is streamed through a small panel so A
+             * is never copied as a whole, and t(Q) %*% Y is obtained by
+             * factorizing [A Y] instead of forming Q. With Q, t(Q) %*% Y is
+             * applied through the reflectors of the blocks and of the tree.
+             * CPU only.
+             *
+             * @param[in] aInput
+             * MPCR Matrix A, nrow(A) >= ncol(A) (+ ncol(Y))
+             * @param[out] aOutputR
+             * Upper triangular factor R (ncol x ncol)
+             * @param[out] apOutputQ
+             * Thin orthogonal factor Q (nrow x ncol), not computed if nullptr
+             * @param[in] apInputY
+             * MPCR Matrix or vector Y with nrow(A) rows, or nullptr
+             * @param[out] apOutputQty
+             * t(Q) %*% Y (ncol x ncol(Y)), only used with apInputY
+             * @param[in] aBlockRows
+             * Number of rows of each block, 0 to split the rows evenly over
+             * the available cores.
+             *
+             */
+            template <typename T>
+            void
+            TSQR(DataType &aInput, DataType &aOutputR, DataType *apOutputQ,
+                 DataType *apInputY = nullptr, DataType *apOutputQty = nullptr,
+                 const size_t &aBlockRows = 0);
+
             /**
              * @brief
              * Compute the singular-value decomposition of a rectangular matrix.
@@ -302,13 +623,16 @@ namespace mpcr {
              * This must be between 0 and n = ncol(aInputA).
              * @param[in] aTranspose
              * Bool if true, aOutputV will contain V ,otherwise VT
+             * @param[in] aOverwrite
+             * if true, aInputA is used as workspace and left empty.
              *
              */
             template <typename T>
             void
             SVD(DataType &aInputA, DataType &aOutputS, DataType &aOutputU,
                 DataType &aOutputV, const size_t &aNu,
-                const size_t &aNv, const bool &aTranspose = true);
+                const size_t &aNv, const bool &aTranspose = true,
+                const bool &aOverwrite = false);
 
             /**
              * @brief
@@ -333,6 +657,112 @@ namespace mpcr {
             ReciprocalCondition(DataType &aInput, double &aOutput,
                                 const std::string &aNorm,
                                 const bool &aTriangle);
+
+            /**
+             * @brief
+             * Calculate the modulus and sign of the determinant of a square
+             * matrix using its LU factorization (Getrf).
+             * det(A) = prod(U[i,i]) * (-1)^(number of row interchanges)
+             *
+             * @param[in] aInput
+             * MPCR Matrix
+             * @param[out] aModulus
+             * Modulus of the determinant, or its natural logarithm in case
+             * aLogarithm is true.
+             * @param[out] aSign
+             * Sign of the determinant (1 or -1).
+             * @param[in] aLogarithm
+             * Bool if true, aModulus will contain log(abs(det(A))).
+             *
+             */
+            template <typename T>
+            void
+            Determinant(DataType &aInput, double &aModulus, int &aSign,
+                        const bool &aLogarithm = true);
+
+            /**
+             * @brief
+             * Truncated singular value decomposition using a randomized range
+             * finder (Halko, Martinsson & Tropp). A Gaussian sketch of the
+             * range of A is orthonormalized (Geqp3 / Orgqr), refined with
+             * power iterations, and only the small projection of A on that
+             * range is decomposed, so only rank + oversampling columns are
+             * ever formed instead of a copy of the whole matrix.
+             * Runs on the CPU in the precision of A.
+             *
+             * @param[in] aInputA
+             * MPCR Matrix
+             * @param[out] aOutputS
+             * The first aRank singular values in decreasing order
+             * @param[out] aOutputU
+             * The first aRank left singular vectors
+             * @param[out] aOutputV
+             * The first aRank right singular vectors
+             * @param[in] aRank
+             * Number of singular triplets, between 1 and min(nrow, ncol)
+             * @param[in] aOversampling
+             * Number of extra sampled columns improving the accuracy
+             * @param[in] aPowerIterations
+             * Number of power iterations, improving the accuracy for slowly
+             * decaying spectra
+             * @param[in] aTranspose
+             * Bool if true, aOutputV will contain V ,otherwise VT
+             * @param[in] apCenter
+             * Column means in the precision of A, if not nullptr the SVD of
+             * the centered matrix (A - 1 t(center)) is computed without
+             * forming it.
+             * @param[in] aSeed
+             * Seed of the Gaussian sketch
+             *
+             */
+            template <typename T>
+            void
+            RandomizedSVD(DataType &aInputA, DataType &aOutputS,
+                          DataType &aOutputU, DataType &aOutputV,
+                          const size_t &aRank, const size_t &aOversampling = 10,
+                          const size_t &aPowerIterations = 2,
+                          const bool &aTranspose = true,
+                          DataType *apCenter = nullptr,
+                          const size_t &aSeed = 0);
+
+            /**
+             * @brief
+             * Principal component analysis of the rows of a matrix using the
+             * randomized truncated SVD, same outputs as R prcomp. The data is
+             * centered on the fly, the centered matrix is never formed.
+             *
+             * @param[in] aInput
+             * MPCR Matrix, one observation per row
+             * @param[out] aOutputSdev
+             * Standard deviations of the first aRank principal components
+             * @param[out] aOutputRotation
+             * Loadings, ncol(aInput) x aRank
+             * @param[out] aOutputCenter
+             * Column means used for centering, empty if aCenter is false
+             * @param[out] aOutputScores
+             * Rotated data (principal component scores), nrow(aInput) x aRank
+             * @param[in] aRank
+             * Number of principal components
+             * @param[in] aCenter
+             * Bool if true, the columns are centered
+             * @param[in] aOversampling
+             * Number of extra sampled columns of the randomized SVD
+             * @param[in] aPowerIterations
+             * Number of power iterations of the randomized SVD
+             * @param[in] aSeed
+             * Seed of the Gaussian sketch
+             *
+             */
+            template <typename T>
+            void
+            PrincipalComponents(DataType &aInput, DataType &aOutputSdev,
+                                DataType &aOutputRotation,
+                                DataType &aOutputCenter,
+                                DataType &aOutputScores, const size_t &aRank,
+                                const bool &aCenter = true,
+                                const size_t &aOversampling = 10,
+                                const size_t &aPowerIterations = 2,
+                                const size_t &aSeed = 0);
         }
     }
 }
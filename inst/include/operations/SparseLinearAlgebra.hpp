@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_SPARSELINEARALGEBRA_HPP
+#define MPCR_SPARSELINEARALGEBRA_HPP
+
+
+#include <data-units/SparseDataType.hpp>
+
+
+namespace mpcr {
+    namespace operations {
+        namespace linear {
+
+            /**
+             * @brief
+             * Multiply a sparse MPCR Matrix with a dense MPCR Matrix or
+             * Vector (SpMM / SpMV), the sparse matrix is never densified.
+             * performs:
+             * C = alpha * op(A) %*% op(B) + beta * C
+             * Rows of the output are computed in parallel.
+             *
+             * @param[in] aInputA
+             * Sparse MPCR Matrix
+             * @param[in] aInputB
+             * Dense MPCR Matrix or Vector (treated as one column), must have
+             * the same precision as aInputA
+             * @param[in,out] aOutput
+             * Dense MPCR Matrix, used as an input in case aBeta != 0
+             * @param[in] aTransposeA
+             * if true, op(A) = t(A)
+             * @param[in] aTransposeB
+             * if true, op(B) = t(B)
+             * @param[in] aAlpha
+             * Scalar alpha
+             * @param[in] aBeta
+             * Scalar beta
+             *
+             */
+            template <typename T>
+            void
+            SparseMultiply(SparseDataType &aInputA, DataType &aInputB,
+                           DataType &aOutput, const bool &aTransposeA,
+                           const bool &aTransposeB, const double &aAlpha = 1,
+                           const double &aBeta = 0);
+
+            /**
+             * @brief
+             * Calculate CrossProduct of a sparse and a dense MPCR Matrix
+             * performs:
+             * op(A) %*% op(B)
+             *
+             * @param[in] aInputA
+             * Sparse MPCR Matrix
+             * @param[in] aInputB
+             * Dense MPCR Matrix
+             * @param[out] aOutput
+             * Dense MPCR Matrix
+             * @param[in] aTransposeA
+             * if true, op(A) = t(A)
+             * @param[in] aTransposeB
+             * if true, op(B) = t(B)
+             *
+             */
+            template <typename T>
+            void
+            CrossProduct(SparseDataType &aInputA, DataType &aInputB,
+                         DataType &aOutput, const bool &aTransposeA,
+                         const bool &aTransposeB);
+
+            /**
+             * @brief
+             * Calculate CrossProduct of a dense and a sparse MPCR Matrix
+             * performs:
+             * op(A) %*% op(B) = t( t(op(B)) %*% t(op(A)) )
+             * the final transpose is applied lazily.
+             *
+             * @param[in] aInputA
+             * Dense MPCR Matrix
+             * @param[in] aInputB
+             * Sparse MPCR Matrix
+             * @param[out] aOutput
+             * Dense MPCR Matrix
+             * @param[in] aTransposeA
+             * if true, op(A) = t(A)
+             * @param[in] aTransposeB
+             * if true, op(B) = t(B)
+             *
+             */
+            template <typename T>
+            void
+            CrossProduct(DataType &aInputA, SparseDataType &aInputB,
+                         DataType &aOutput, const bool &aTransposeA,
+                         const bool &aTransposeB);
+
+        }
+    }
+}
+
+#endif //MPCR_SPARSELINEARALGEBRA_HPP
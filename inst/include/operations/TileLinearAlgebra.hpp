@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#ifndef MPCR_TILELINEARALGEBRA_HPP
+#define MPCR_TILELINEARALGEBRA_HPP
+
+
+#include <data-units/MPCRTile.hpp>
+
+
+namespace mpcr {
+    namespace operations {
+        namespace tile {
+
+            /**
+             * Tile algorithms are expressed as a graph of tile kernels
+             * submitted to the OpenMP task queue, dependencies are declared
+             * on the tiles, so independent tile updates run concurrently.
+             * Every kernel runs in the precision of the tile it writes to,
+             * input tiles held in another precision are converted on the fly.
+             * The kernels run on the CPU.
+             **/
+
+            /**
+             * @brief
+             * Tiled matrix-matrix multiplication
+             * performs:
+             * C = alpha * op(A) %*% op(B) + beta * C
+             *
+             * @param[in] aInputA
+             * MPCR Tile Matrix
+             * @param[in] aInputB
+             * MPCR Tile Matrix
+             * @param[in,out] aInputC
+             * MPCR Tile Matrix, the tiling must conform with op(A) and op(B)
+             * @param[in] aTransposeA
+             * if true, op(A) = t(A)
+             * @param[in] aTransposeB
+             * if true, op(B) = t(B)
+             * @param[in] aAlpha
+             * Scalar alpha
+             * @param[in] aBeta
+             * Scalar beta
+             *
+             */
+            void
+            TileGemm(MPCRTile &aInputA, MPCRTile &aInputB, MPCRTile &aInputC,
+                     const bool &aTransposeA, const bool &aTransposeB,
+                     const double &aAlpha, const double &aBeta);
+
+            /**
+             * @brief
+             * Tiled triangular solve
+             * performs:
+             * op(A) X = alpha B  or  X op(A) = alpha B
+             * B is overwritten by X.
+             *
+             * @param[in] aInputA
+             * MPCR Tile triangular square Matrix with square tiles
+             * @param[in,out] aInputB
+             * MPCR Tile Matrix, tiled like A along the solved dimension
+             * @param[in] aLeftSide
+             * if true, op(A) X = alpha B, otherwise X op(A) = alpha B
+             * @param[in] aUpperTriangle
+             * if true, A is upper triangular, otherwise lower triangular
+             * @param[in] aTranspose
+             * if true, op(A) = t(A)
+             * @param[in] aAlpha
+             * Scalar alpha
+             *
+             */
+            void
+            TileTrsm(MPCRTile &aInputA, MPCRTile &aInputB,
+                     const bool &aLeftSide, const bool &aUpperTriangle,
+                     const bool &aTranspose, const double &aAlpha);
+
+            /**
+             * @brief
+             * Tiled symmetric rank-k update, only the lower triangle of C
+             * is referenced and updated.
+             * performs:
+             * C = alpha * A %*% t(A) + beta * C
+             * C = alpha * t(A) %*% A + beta * C   (aTranspose = true)
+             *
+             * @param[in] aInputA
+             * MPCR Tile Matrix
+             * @param[in,out] aInputC
+             * MPCR Tile square Matrix with square tiles
+             * @param[in] aTranspose
+             * if true, op(A) = t(A)
+             * @param[in] aAlpha
+             * Scalar alpha
+             * @param[in] aBeta
+             * Scalar beta
+             *
+             */
+            void
+            TileSyrk(MPCRTile &aInputA, MPCRTile &aInputC,
+                     const bool &aTranspose, const double &aAlpha,
+                     const double &aBeta);
+
+            /**
+             * @brief
+             * Tiled right-looking Cholesky decomposition, A is overwritten
+             * by the lower triangular factor L where A = L %*% t(L).
+             * Tiles above the diagonal are neither referenced nor updated.
+             * Each POTRF / TRSM / SYRK / GEMM tile update runs in the
+             * precision of the tile it writes to.
+             *
+             * @param[in,out] aInputA
+             * MPCR Tile symmetric positive definite square Matrix with square
+             * tiles
+             * @param[out] aFlops
+             * Number of flops run in each precision, indexed as
+             * {half, single, double}. Half precision tiles are updated in
+             * single precision, so their flops are counted as single.
+             *
+             */
+            void
+            TileCholesky(MPCRTile &aInputA, std::vector <double> &aFlops);
+
+        }
+    }
+}
+
+
+#endif //MPCR_TILELINEARALGEBRA_HPP
@@ -14,8 +14,6 @@
 #include <operations/interface/Helpers.hpp>
 
 
-#define MPCR_CPU_BLOCK_SIZE 8
-
 namespace mpcr::operations {
     namespace helpers {
 
@@ -83,6 +81,7 @@ namespace mpcr::operations {
 
             void
             IsSymmetric(DataType &aInput,bool &aOutput,
+                        const double &aTolerance,
                         kernels::RunContext *aContext);
 
 
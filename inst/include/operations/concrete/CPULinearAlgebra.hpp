@@ -30,6 +30,26 @@ namespace mpcr {
                      const T *apDataA, const int &aLda, const T &aBeta,
                      T *apDataC, const int &aLdc);
 
+                void
+                Gemv(const bool &aTranspose, const int &aNumRowA,
+                     const int &aNumColA, const T &aAlpha, const T *apDataA,
+                     const int &aLda, const T *apDataX, const int &aIncX,
+                     const T &aBeta, T *apDataY, const int &aIncY);
+
+                T
+                Dot(const int &aNumElements, const T *apDataX,
+                    const int &aIncX, const T *apDataY, const int &aIncY);
+
+                void
+                Ger(const int &aNumRowA, const int &aNumColA, const T &aAlpha,
+                    const T *apDataX, const int &aIncX, const T *apDataY,
+                    const int &aIncY, T *apDataA, const int &aLda);
+
+                void
+                Axpy(const int &aNumElements, const T &aAlpha,
+                     const T *apDataX, const int &aIncX, T *apDataY,
+                     const int &aIncY);
+
 
                 void
                 Trsm(const bool &aLeftSide, const bool &aFillUpperTri,
@@ -37,6 +57,19 @@ namespace mpcr {
                      const int &aNumColsB, const T &aAlpha, const T *apDataA,
                      const int &aLda, T *apDataB, const int &aLdb);
 
+                void
+                Trmm(const bool &aLeftSide, const bool &aFillUpperTri,
+                     const bool &aTranspose, const int &aNumRowsB,
+                     const int &aNumColsB, const T &aAlpha, const T *apDataA,
+                     const int &aLda, T *apDataB, const int &aLdb);
+
+                void
+                Symm(const bool &aLeftSide, const bool &aFillUpperTri,
+                     const int &aNumRowsC, const int &aNumColsC,
+                     const T &aAlpha, const T *apDataA, const int &aLda,
+                     const T *apDataB, const int &aLdb, const T &aBeta,
+                     T *apDataC, const int &aLdc);
+
 
                 int
                 Potrf(const bool &aFillUpperTri, const int &aNumRow, T *apDataA,
@@ -54,6 +87,12 @@ namespace mpcr {
                      T *apDataOut, const int &aLdo,
                      const std::string &aInternalPrecision = "same");
 
+                int
+                Posv(const bool &aFillUpperTri, const int &aNumN,
+                     const int &aNumNRH, T *apDataA, const int &aLda,
+                     T *apDataB, const int &aLdb,
+                     const std::string &aInternalPrecision = "same");
+
                 int
                 Getrf(const int &aNumRow, const int &aNumCol, T *apDataA,
                       const int &aLda, int64_t *apIpiv);
@@ -75,14 +114,33 @@ namespace mpcr {
                       const int &aNumCol, T *apDataA, const int64_t &aLda,
                       T *apDataW);
 
+                int
+                Syevr(const bool &aJobzNoVec, const bool &aFillUpperTri,
+                      const int &aNumCol, T *apDataA, const int64_t &aLda,
+                      const bool &aByIndex, const T &aLower, const T &aUpper,
+                      const int64_t &aFirstIndex, const int64_t &aLastIndex,
+                      int64_t &aNumFound, T *apDataW, T *apDataZ,
+                      const int64_t &aLdz);
+
                 int
                 Geqp3(const int &aNumRow, const int &aNumCol, T *apDataA,
                       const int &aLda, int64_t *aJpVt, T *aTaw);
 
+                int
+                Geqrf(const int &aNumRow, const int &aNumCol, T *apDataA,
+                      const int &aLda, T *aTau);
+
                 int
                 Orgqr(const int &aNumRow, const int &aNum, const int &aNumCol,
                       T *apDataA, const int &aLda, const T *aTau);
 
+                int
+                Ormqr(const bool &aLeftSide, const bool &aTranspose,
+                      const int &aNumRow, const int &aNumCol,
+                      const int &aNumReflectors, const T *apDataA,
+                      const int &aLda, const T *aTau, T *apDataC,
+                      const int &aLdc);
+
                 int
                 Gecon(const std::string &aNorm, const int &aNumRow,
                       const T *apData, const int &aLda, T aNormVal, T *aRCond);
@@ -93,6 +151,11 @@ namespace mpcr {
                       const T *apData,
                       const int &aLda, T *aRCond);
 
+                int
+                Pocon(const bool &aFillUpperTri, const int &aNumRow,
+                      const T *apData, const int &aLda, T aNormVal,
+                      T *aRCond);
+
                 int
                 Getrs(const bool &aTransposeA, const size_t &aNumRowA,
                       const size_t &aNumRhs, const T *apDataA,
@@ -104,6 +167,25 @@ namespace mpcr {
                 Trtri(const size_t &aSideLength, T *apDataA, const size_t &aLda,
                       const bool &aUpperTri);
 
+                int
+                Pptrf(const bool &aFillUpperTri, const int &aNumRow,
+                      T *apDataA);
+
+                int
+                Pptri(const bool &aFillUpperTri, const int &aNumRow,
+                      T *apDataA);
+
+                int
+                Tptrs(const bool &aFillUpperTri, const bool &aTranspose,
+                      const int &aNumRow, const int &aNumRhs, const T *apDataA,
+                      T *apDataB, const int &aLdb);
+
+                void
+                PackedSyrk(const bool &aFillLower, const bool &aTranspose,
+                           const int &aNumRowA, const int &aNumColA,
+                           const T &aAlpha, const T *apDataA, const int &aLda,
+                           const T &aBeta, T *apDataC);
+
             };
 
             MPCR_INSTANTIATE_CLASS(CPULinearAlgebra)
@@ -80,6 +80,7 @@ namespace mpcr::operations {
 
             void
             IsSymmetric(DataType &aInput,bool &aOutput,
+                        const double &aTolerance,
                         kernels::RunContext *aContext);
 
 
@@ -206,6 +206,9 @@ namespace mpcr {
                  * MPCR Matrix.
                  * @param [out] aOutput
                  * flag indicating whether the matrix is symmetric or not.
+                 * @param [in] aTolerance
+                 * Largest absolute difference allowed between mirrored
+                 * entries.
                  * @param [in] aContext
                  * Run context used for GPU helpers, can be null in case of CPU.
                  *
@@ -213,6 +216,7 @@ namespace mpcr {
                 virtual
                 void
                 IsSymmetric(DataType &aInput, bool &aOutput,
+                            const double &aTolerance,
                             kernels::RunContext *aContext) = 0;
 
                 /**
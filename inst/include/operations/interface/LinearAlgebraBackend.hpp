@@ -109,6 +109,123 @@ namespace mpcr {
                      const T *apDataA, const int &aLda, const T &aBeta,
                      T *apDataC, const int &aLdc) = 0;
 
+                /**
+                 * @brief
+                 * Computes a matrix-vector product with a general matrix.
+                 * Solves :  y = alpha * op(A) * x + beta * y
+                 * Where op: op(X)=X or op(X)=X^T
+                 *
+                 * @param [in] aTranspose
+                 * if True op(A) = A^T ,otherwise op(A)= A
+                 * @param [in] aNumRowA
+                 * Number of rows in matrix A
+                 * @param [in] aNumColA
+                 * Number of cols in matrix A
+                 * @param [in] aAlpha
+                 * Scalar alpha. If alpha is zero, A and x are not accessed
+                 * @param [in] apDataA
+                 * Matrix A data
+                 * @param [in] aLda
+                 * Leading dimension for matrix A
+                 * @param [in] apDataX
+                 * Vector x data
+                 * @param [in] aIncX
+                 * Stride between consecutive elements of x
+                 * @param [in] aBeta
+                 * Scalar beta. If beta is zero, y need not be set on input.
+                 * @param [in,out] apDataY
+                 * input and output vector y, will be used as an input in case
+                 * aBeta != 0
+                 * @param [in] aIncY
+                 * Stride between consecutive elements of y
+                 *
+                 */
+                virtual
+                void
+                Gemv(const bool &aTranspose, const int &aNumRowA,
+                     const int &aNumColA, const T &aAlpha, const T *apDataA,
+                     const int &aLda, const T *apDataX, const int &aIncX,
+                     const T &aBeta, T *apDataY, const int &aIncY) = 0;
+
+                /**
+                 * @brief
+                 * Computes the dot product of two vectors.
+                 *
+                 * @param [in] aNumElements
+                 * Number of elements in vectors x and y
+                 * @param [in] apDataX
+                 * Vector x data
+                 * @param [in] aIncX
+                 * Stride between consecutive elements of x
+                 * @param [in] apDataY
+                 * Vector y data
+                 * @param [in] aIncY
+                 * Stride between consecutive elements of y
+                 *
+                 * @returns
+                 * t(x) %*% y, returned to the host
+                 */
+                virtual
+                T
+                Dot(const int &aNumElements, const T *apDataX,
+                    const int &aIncX, const T *apDataY, const int &aIncY) = 0;
+
+                /**
+                 * @brief
+                 * Performs a rank one update of a general matrix.
+                 * Solves :  A = alpha * x * y^T + A
+                 *
+                 * @param [in] aNumRowA
+                 * Number of rows in matrix A
+                 * @param [in] aNumColA
+                 * Number of cols in matrix A
+                 * @param [in] aAlpha
+                 * Scalar alpha
+                 * @param [in] apDataX
+                 * Vector x data, of length aNumRowA
+                 * @param [in] aIncX
+                 * Stride between consecutive elements of x
+                 * @param [in] apDataY
+                 * Vector y data, of length aNumColA
+                 * @param [in] aIncY
+                 * Stride between consecutive elements of y
+                 * @param [in,out] apDataA
+                 * Matrix A data, overwritten by the updated matrix
+                 * @param [in] aLda
+                 * Leading dimension for matrix A
+                 *
+                 */
+                virtual
+                void
+                Ger(const int &aNumRowA, const int &aNumColA, const T &aAlpha,
+                    const T *apDataX, const int &aIncX, const T *apDataY,
+                    const int &aIncY, T *apDataA, const int &aLda) = 0;
+
+                /**
+                 * @brief
+                 * Adds a scaled vector to another vector.
+                 * Solves :  y = alpha * x + y
+                 *
+                 * @param [in] aNumElements
+                 * Number of elements in vectors x and y
+                 * @param [in] aAlpha
+                 * Scalar alpha
+                 * @param [in] apDataX
+                 * Vector x data
+                 * @param [in] aIncX
+                 * Stride between consecutive elements of x
+                 * @param [in,out] apDataY
+                 * Vector y data, overwritten by the result
+                 * @param [in] aIncY
+                 * Stride between consecutive elements of y
+                 *
+                 */
+                virtual
+                void
+                Axpy(const int &aNumElements, const T &aAlpha,
+                     const T *apDataX, const int &aIncX, T *apDataY,
+                     const int &aIncY) = 0;
+
                 /**
                  * @brief
                  * Solve the triangular matrix-vector equation.
@@ -148,6 +265,91 @@ namespace mpcr {
                      const int &aNumColsB, const T &aAlpha, const T *apDataA,
                      const int &aLda, T *apDataB, const int &aLdb) = 0;
 
+                /**
+                 * @brief
+                 * Computes a matrix-matrix product where one input matrix is
+                 * triangular.
+                 * Solves :  B = alpha * op(A) * B
+                 *           B = alpha * B * op(A)
+                 *
+                 *
+                 * @param [in] aLeftSide
+                 * if True, the operation will be as follow:
+                 * B = alpha * op(A) * B
+                 * otherwise, B = alpha * B * op(A)
+                 * @param [in] aFillUpperTri
+                 * if true, A is upper triangle, otherwise, lower triangle.
+                 * @param [in] aTranspose
+                 * if True, op(A) = A^T, otherwise, op(A) = A
+                 * @param [in] aNumRowsB
+                 * Number of rows in matrix B
+                 * @param [in] aNumColsB
+                 * Number of cols in matrix B
+                 * @param [in] aAlpha
+                 * Scalar alpha. If alpha is zero, A is not accessed.
+                 * @param [in] apDataA
+                 * matrix A data, the other triangle is not referenced
+                 * @param [in] aLda
+                 * Leading dimension of matrix A
+                 * @param [in,out] apDataB
+                 * input and output matrix B, overwritten by the product.
+                 * @param [in] aLdb
+                 * Leading dimension of matrix B
+                 *
+                 */
+                virtual
+                void
+                Trmm(const bool &aLeftSide, const bool &aFillUpperTri,
+                     const bool &aTranspose, const int &aNumRowsB,
+                     const int &aNumColsB, const T &aAlpha, const T *apDataA,
+                     const int &aLda, T *apDataB, const int &aLdb) = 0;
+
+                /**
+                 * @brief
+                 * Computes a matrix-matrix product where one input matrix is
+                 * symmetric.
+                 * Solves :  C = alpha * A * B + beta * C
+                 *           C = alpha * B * A + beta * C
+                 *
+                 *
+                 * @param [in] aLeftSide
+                 * if True, the operation will be as follow:
+                 * C = alpha * A * B + beta * C
+                 * otherwise, C = alpha * B * A + beta * C
+                 * @param [in] aFillUpperTri
+                 * if true, the upper triangle of A is referenced, otherwise,
+                 * the lower triangle.
+                 * @param [in] aNumRowsC
+                 * Number of rows in matrices B and C
+                 * @param [in] aNumColsC
+                 * Number of cols in matrices B and C
+                 * @param [in] aAlpha
+                 * Scalar alpha. If alpha is zero, A and B are not accessed.
+                 * @param [in] apDataA
+                 * Symmetric matrix A data
+                 * @param [in] aLda
+                 * Leading dimension of matrix A
+                 * @param [in] apDataB
+                 * Matrix B data
+                 * @param [in] aLdb
+                 * Leading dimension of matrix B
+                 * @param [in] aBeta
+                 * Scalar beta. If beta is zero, C need not be set on input.
+                 * @param [in,out] apDataC
+                 * input and output matrix C, will be used as an input in case
+                 * aBeta != 0
+                 * @param [in] aLdc
+                 * Leading dimension of matrix C
+                 *
+                 */
+                virtual
+                void
+                Symm(const bool &aLeftSide, const bool &aFillUpperTri,
+                     const int &aNumRowsC, const int &aNumColsC,
+                     const T &aAlpha, const T *apDataA, const int &aLda,
+                     const T *apDataB, const int &aLdb, const T &aBeta,
+                     T *apDataC, const int &aLdc) = 0;
+
                 /**
                  * @brief
                  * Computes the Cholesky factorization of a symmetric
@@ -258,6 +460,50 @@ namespace mpcr {
                      const int &aLdb, T *apDataOut, const int &aLdo,
                      const std::string &aInternalPrecision = "same") = 0;
 
+                /**
+                 * @brief
+                 * Computes the solution to system of linear equations A * X = B
+                 * for symmetric positive definite matrices.
+                 * The Cholesky decomposition is used to factor A as:
+                 * A = t(U) * U  or  A = L * t(L)
+                 * and the factored form of A is then used to solve the system.
+                 *
+                 * @param [in] aFillUpperTri
+                 * if true, the upper triangle of A is referenced, otherwise
+                 * the lower triangle.
+                 * @param [in] aNumN
+                 * Number of linear equations, the order of the matrix.
+                 * @param [in] aNumNRH
+                 * Number of right hand sides, the number of cols of matrix B
+                 * @param [in,out] apDataA
+                 *  On entry, the N-by-N symmetric positive definite matrix A.
+                 *  On exit, A may be overwritten by its Cholesky factor.
+                 * @param [in] aLda
+                 * Leading dimension of matrix A
+                 * @param [in,out] apDataB
+                 *  On entry, the N-by-NRHS matrix of right hand side matrix B.
+                 *  On exit, if rc = 0, the N-by-NRHS solution matrix X.
+                 * @param [in] aLdb
+                 * Leading dimension of matrix B
+                 * @param [in] aInternalPrecision
+                 * Precision of the factorization, a reduced precision
+                 * factorization is refined to the precision of A.
+                 *
+                 * @returns
+                 * rc code :
+                 *  = 0:  successful exit
+                 *  < 0:  if rc = -i, the i-th argument had an illegal value
+                 *  > 0:  if rc = i, the leading minor of order i of A is not
+                 *  positive definite, so the solution could not be computed
+                 *
+                 */
+                virtual
+                int
+                Posv(const bool &aFillUpperTri, const int &aNumN,
+                     const int &aNumNRH, T *apDataA, const int &aLda,
+                     T *apDataB, const int &aLdb,
+                     const std::string &aInternalPrecision = "same") = 0;
+
                 /**
                  * @brief
                  * Computes an LU factorization of a general M-by-N matrix A
@@ -379,6 +625,61 @@ namespace mpcr {
                       const int &aNumCol, T *apDataA, const int64_t &aLda,
                       T *apDataW) = 0;
 
+                /**
+                 * @brief
+                 * Computes selected eigenvalues and, optionally, eigenvectors
+                 * of SY matrices using the MRRR algorithm. Only the requested
+                 * eigenpairs are computed, either by index or by value range.
+                 *
+                 * @param [in] aJobzNoVec
+                 * If True, Compute eigenvalues only, otherwise, compute both
+                 * eigenvalues and eigenvectors.
+                 * @param [in] aFillUpperTri
+                 * If True, Upper triangle is stored, otherwise, lower triangle.
+                 * @param [in] aNumCol
+                 * Number of Cols, Matrix order.
+                 * @param [in,out] apDataA
+                 * On entry, the symmetric matrix A, destroyed on exit.
+                 * @param[in] aLda
+                 * Leading dimension of matrix A
+                 * @param[in] aByIndex
+                 * If True, the eigenvalues aFirstIndex through aLastIndex
+                 * (one based, ascending order) are computed, otherwise the
+                 * eigenvalues in the half open interval (aLower, aUpper].
+                 * @param[in] aLower
+                 * Lower bound of the interval, not referenced if aByIndex.
+                 * @param[in] aUpper
+                 * Upper bound of the interval, not referenced if aByIndex.
+                 * @param[in] aFirstIndex
+                 * Index of the smallest eigenvalue to compute.
+                 * @param[in] aLastIndex
+                 * Index of the largest eigenvalue to compute.
+                 * @param[out] aNumFound
+                 * Number of eigenvalues found.
+                 * @param[out] apDataW
+                 * The selected eigenvalues in ascending order, must hold
+                 * aNumCol values.
+                 * @param[out] apDataZ
+                 * The selected eigenvectors, not referenced if aJobzNoVec.
+                 * @param[in] aLdz
+                 * Leading dimension of Z
+                 *
+                 * @returns
+                 * rc code :
+                 *  = 0:  successful exit
+                 *  < 0:  if rc = -i, the i-th argument had an illegal value
+                 *  > 0:  internal error
+                 *
+                 */
+                virtual
+                int
+                Syevr(const bool &aJobzNoVec, const bool &aFillUpperTri,
+                      const int &aNumCol, T *apDataA, const int64_t &aLda,
+                      const bool &aByIndex, const T &aLower, const T &aUpper,
+                      const int64_t &aFirstIndex, const int64_t &aLastIndex,
+                      int64_t &aNumFound, T *apDataW, T *apDataZ,
+                      const int64_t &aLdz) = 0;
+
                 /**
                  * @brief
                  * Computes a QR factorization with column pivoting of a
@@ -417,6 +718,38 @@ namespace mpcr {
                 Geqp3(const int &aNumRow, const int &aNumCol, T *apDataA,
                       const int &aLda, int64_t *aJpVt, T *aTaw) = 0;
 
+                /**
+                 * @brief
+                 * Computes a QR factorization without pivoting of a
+                 *  matrix A:  A = Q*R
+                 *
+                 * @param [in] aNumRow
+                 * Number of rows of matrix A
+                 * @param [in] aNumCol
+                 * Number of cols of matrix A
+                 * @param [in,out] apDataA
+                 * On entry, the matrix A.
+                 * On exit, the upper triangle of the array contains the
+                 * min(M,N)-by-N upper trapezoidal matrix R; the elements below
+                 * the diagonal, together with the array TAU, represent the
+                 * orthogonal matrix Q as a product of min(M,N) elementary
+                 * reflectors.
+                 * @param [in] aLda
+                 * Leading dimension of matrix A
+                 * @param[out] aTau
+                 * The scalar factors of the elementary reflectors.
+                 *
+                 * @returns
+                 * rc code :
+                 *   = 0: successful exit.
+                 *   < 0: if rc = -i, the i-th argument had an illegal value.
+                 *
+                 */
+                virtual
+                int
+                Geqrf(const int &aNumRow, const int &aNumCol, T *apDataA,
+                      const int &aLda, T *aTau) = 0;
+
                 /**
                  * @brief
                  * Generates an NumRow-by-Num real matrix Q with orthonormal columns,
@@ -451,6 +784,50 @@ namespace mpcr {
                 Orgqr(const int &aNumRow, const int &aNum, const int &aNumCol,
                       T *apDataA, const int &aLda, const T *aTau) = 0;
 
+                /**
+                 * @brief
+                 * Overwrites the general M-by-N matrix C with Q C, t(Q) C,
+                 * C Q or C t(Q), where Q is the product of K elementary
+                 * reflectors as returned by Geqp3, without forming Q.
+                 *
+                 * @param [in] aLeftSide
+                 * if true, Q is applied from the left, otherwise from the right
+                 * @param [in] aTranspose
+                 * if true, t(Q) is applied, otherwise Q
+                 * @param [in] aNumRow
+                 * The number of rows of the matrix C
+                 * @param [in] aNumCol
+                 * The number of columns of the matrix C
+                 * @param [in] aNumReflectors
+                 * The number of elementary reflectors whose product defines the
+                 * matrix Q
+                 * @param [in] apDataA
+                 * The i-th column must contain the vector which defines the
+                 * elementary reflector H(i)
+                 * @param[in] aLda
+                 * Leading dimension of matrix A
+                 * @param[in] aTau
+                 * Contains the scalar factor of the elementary reflector H(i)
+                 * @param [in,out] apDataC
+                 * On entry, the M-by-N matrix C.
+                 * On exit, C is overwritten by the product.
+                 * @param[in] aLdc
+                 * Leading dimension of matrix C
+                 *
+                 * @returns
+                 * rc code :
+                 *   = 0: successful exit.
+                 *   < 0: if rc = -i, the i-th argument had an illegal value.
+                 *
+                 */
+                virtual
+                int
+                Ormqr(const bool &aLeftSide, const bool &aTranspose,
+                      const int &aNumRow, const int &aNumCol,
+                      const int &aNumReflectors, const T *apDataA,
+                      const int &aLda, const T *aTau, T *apDataC,
+                      const int &aLdc) = 0;
+
                 /**
                  * @brief
                  * Estimates the reciprocal of the condition number of a general
@@ -541,6 +918,39 @@ namespace mpcr {
                       const bool &aUnitTriangle, const int &aMatOrder,
                       const T *apData, const int &aLda, T *aRCond) = 0;
 
+                /**
+                 * @brief
+                 * Estimates the reciprocal of the condition number (in the
+                 * 1-norm) of a symmetric positive definite matrix A using the
+                 * Cholesky factorization computed by POTRF.
+                 *    RCOND = 1 / ( norm(A) * norm(inv(A)) ).
+                 *
+                 * @param [in] aFillUpperTri
+                 * If True, the upper triangle factor is stored, otherwise
+                 * the lower triangle factor.
+                 * @param [in] aNumRow
+                 * The order of matrix A.
+                 * @param [in] apData
+                 * The triangular factor U or L from the Cholesky factorization
+                 * as computed by POTRF.
+                 * @param [in] aLda
+                 * Leading dimension of matrix A.
+                 * @param [in] aNormVal
+                 * The 1-norm (or infinity-norm) of the symmetric matrix A.
+                 * @param[out] aRCond
+                 *  The reciprocal of the condition number of the matrix A.
+                 *
+                 * @returns
+                 * rc code :
+                 *  = 0:  successful exit
+                 *  < 0:  if rc = -i, the i-th argument had an illegal value
+                 */
+                virtual
+                int
+                Pocon(const bool &aFillUpperTri, const int &aNumRow,
+                      const T *apData, const int &aLda, T aNormVal,
+                      T *aRCond) = 0;
+
                 /**
                  * @brief
                  * This function solves a linear system of multiple right-hand sides
@@ -605,6 +1015,122 @@ namespace mpcr {
                 Trtri(const size_t &aSideLength, T *apDataA, const size_t &aLda,
                       const bool &aUpperTri) = 0;
 
+                /**
+                 * @brief
+                 * Computes the Cholesky factorization of a symmetric
+                 * positive-definite matrix stored in packed format.
+                 *
+                 * @param [in] aFillUpperTri
+                 * Indicates whether the upper or lower triangle of A is packed.
+                 * @param [in] aNumRow
+                 * Order of matrix A.
+                 * @param [in,out] apDataA
+                 * Packed matrix A data (n*(n+1)/2 elements), on exit, the
+                 * packed triangular factor in the same triangle.
+                 *
+                 * @returns
+                 * rc code : if = 0, the execution is successful.
+                 * If rc = -i, the i-th parameter had an illegal value.
+                 * If rc = i, the leading minor of order i is not
+                 * positive-definite.
+                 *
+                 */
+                virtual
+                int
+                Pptrf(const bool &aFillUpperTri, const int &aNumRow,
+                      T *apDataA) = 0;
+
+                /**
+                 * @brief
+                 * Computes the inverse of a symmetric positive-definite matrix
+                 * from its packed Cholesky factor.
+                 *
+                 * @param [in] aFillUpperTri
+                 * Indicates whether the upper or lower triangle is packed.
+                 * @param [in] aNumRow
+                 * Order of matrix A.
+                 * @param [in,out] apDataA
+                 * Packed Cholesky factor, on exit, the packed inv(A).
+                 *
+                 * @returns
+                 * rc code : if = 0, the execution is successful.
+                 * If rc = -i, the i-th parameter had an illegal value.
+                 * If rc = i, the i-th diagonal element of the factor is zero.
+                 *
+                 */
+                virtual
+                int
+                Pptri(const bool &aFillUpperTri, const int &aNumRow,
+                      T *apDataA) = 0;
+
+                /**
+                 * @brief
+                 * Solves op(A) X = B, where A is a triangular matrix stored in
+                 * packed format.
+                 *
+                 * @param [in] aFillUpperTri
+                 * if true, A is upper triangle, otherwise, lower triangle.
+                 * @param [in] aTranspose
+                 * if True, op(A) = A^T, otherwise, op(A) = A
+                 * @param [in] aNumRow
+                 * Order of matrix A.
+                 * @param [in] aNumRhs
+                 * Number of cols in matrix B
+                 * @param [in] apDataA
+                 * Packed matrix A data
+                 * @param [in,out] apDataB
+                 * Matrix B, on exit, overwritten by the solution matrix X.
+                 * @param [in] aLdb
+                 * Leading dimension of matrix B
+                 *
+                 * @returns
+                 * rc code : if = 0, the execution is successful.
+                 * If rc = -i, the i-th parameter had an illegal value.
+                 * If rc = i, A(i,i) is exactly zero.
+                 *
+                 */
+                virtual
+                int
+                Tptrs(const bool &aFillUpperTri, const bool &aTranspose,
+                      const int &aNumRow, const int &aNumRhs, const T *apDataA,
+                      T *apDataB, const int &aLdb) = 0;
+
+                /**
+                 * @brief
+                 * Symmetric rank-k update with the output in packed format.
+                 * Solves :  C = alpha * A * A^T + beta * C
+                 *           C = alpha * A^T * A + beta * C
+                 *
+                 * @param [in] aFillLower
+                 * if TRUE, the lower triangle of C is packed, otherwise the
+                 * upper triangle.
+                 * @param [in] aTranspose
+                 * if True, the operation will be as follow:
+                 * C = alpha * A^T * A + beta * C
+                 * otherwise, C = alpha * A * A^T + beta * C
+                 * @param [in] aNumRowA
+                 * Order of matrix C
+                 * @param [in] aNumColA
+                 * Inner dimension of the product
+                 * @param [in] aAlpha
+                 * Scalar alpha.
+                 * @param [in] apDataA
+                 * Matrix A data
+                 * @param [in] aLda
+                 * Leading dimension for matrix A
+                 * @param [in] aBeta
+                 * Scalar beta. If beta is zero, C need not be set on input.
+                 * @param [in,out] apDataC
+                 * Packed matrix C data (n*(n+1)/2 elements)
+                 *
+                 */
+                virtual
+                void
+                PackedSyrk(const bool &aFillLower, const bool &aTranspose,
+                           const int &aNumRowA, const int &aNumColA,
+                           const T &aAlpha, const T *apDataA, const int &aLda,
+                           const T &aBeta, T *apDataC) = 0;
+
 
             };
 
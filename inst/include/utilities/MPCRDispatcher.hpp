@@ -17,7 +17,7 @@
 using namespace mpcr::definitions;
 
 /** Dispatcher to support Dispatching of template functions with Rcpp
- * Only 10 arguments are supported here.
+ * Only 15 arguments are supported here.
  * It can be expanded to whatever number of arguments needed
  **/
 
@@ -26,7 +26,7 @@ using namespace mpcr::definitions;
 /**
  * if there's only one argument, expands to nothing.  if there is more
  * than one argument, expands to a comma followed by everything but
- * the first argument.  only supports up to 9 arguments but can be
+ * the first argument.  only supports up to 15 arguments but can be
  * trivially expanded.
  */
 
@@ -36,9 +36,12 @@ using namespace mpcr::definitions;
 #define REST_HELPER_ONE(first)
 #define REST_HELPER_TWOORMORE(first, ...) , __VA_ARGS__
 #define NUM(...) \
-    SELECT_10TH(__VA_ARGS__, TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE,\
-                TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE, ONE, throwaway)
-#define SELECT_10TH(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, ...) a10
+    SELECT_16TH(__VA_ARGS__, TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE,\
+                TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE,     \
+                TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE, TWOORMORE, ONE,\
+                throwaway)
+#define SELECT_16TH(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13,   \
+                    a14, a15, a16, ...) a16
 
 /** Dispatcher for one template arguments **/
 #define SIMPLE_DISPATCH(PRECISION, __FUN__, ...)                               \
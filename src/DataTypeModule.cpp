@@ -12,6 +12,10 @@
 #include <adapters/RLinearAlgebra.hpp>
 #include <adapters/RHelpers.hpp>
 #include <adapters/RContextManager.hpp>
+#include <adapters/RSparse.hpp>
+#include <adapters/RTile.hpp>
+#include <adapters/RFactorization.hpp>
+#include <adapters/RBatch.hpp>
 
 
 
@@ -20,6 +24,9 @@
  *  Allows C++ to Send and Receive Class object from R
  **/
 RCPP_EXPOSED_CLASS(DataType)
+RCPP_EXPOSED_CLASS(SparseDataType)
+RCPP_EXPOSED_CLASS(MPCRTile)
+RCPP_EXPOSED_CLASS(MPCRFactorization)
 
 /** Expose C++ Object With the Given functions **/
 RCPP_MODULE(MPCR) {
@@ -36,6 +43,7 @@ RCPP_MODULE(MPCR) {
         .property("Size", &DataType::GetSize)
         .property("Row", &DataType::GetNRow)
         .property("Col", &DataType::GetNCol)
+        .property("IsPacked", &DataType::IsPacked)
         .method("PrintValues", &DataType::Print)
         .method("ToMatrix", &DataType::ToMatrix)
         .method("ToVector", &DataType::ToVector)
@@ -61,7 +69,46 @@ RCPP_MODULE(MPCR) {
         .method("IsGPUAllocated",&DataType::IsGPUAllocated)
         .method("IsCPUAllocated",&DataType::IsCPUAllocated)
         .method("FreeGPU",&DataType::FreeGPUMemory)
-        .method("FreeCPU",&DataType::FreeCPUMemory);
+        .method("FreeCPU",&DataType::FreeCPUMemory)
+        .method("ToPacked", &DataType::ToPacked)
+        .method("Unpack", &DataType::Unpack);
+
+    /** MPCR Sparse Class **/
+    class_ <SparseDataType>("MPCRSparse")
+        .property("Row", &SparseDataType::GetNRow)
+        .property("Col", &SparseDataType::GetNCol)
+        .property("Nnz", &SparseDataType::GetNnz)
+        .property("Format", &RSparseGetFormat)
+        .method("PrintValues", &SparseDataType::Print)
+        .method("show", &RSparseGetType)
+        .method("MPCR.GetVal", &SparseDataType::GetVal)
+        .method("ConvertFormat", &RSparseConvertFormat)
+        .method("ToDense", &RSparseToDense);
+
+    /** MPCR Tile Class **/
+    class_ <MPCRTile>("MPCRTile")
+        .constructor <size_t, size_t, size_t, size_t, std::vector <double>,
+            std::vector <std::string> >()
+        .property("Row", &MPCRTile::GetNRow)
+        .property("Col", &MPCRTile::GetNCol)
+        .property("TileRow", &MPCRTile::GetTileNRow)
+        .property("TileCol", &MPCRTile::GetTileNCol)
+        .method("PrintTile", &MPCRTile::Print)
+        .method("show", &RTileGetType)
+        .method("MPCRTile.GetVal", &MPCRTile::GetVal)
+        .method("MPCRTile.SetVal", &MPCRTile::SetVal)
+        .method("ChangeTilePrecision", &RTileChangePrecision)
+        .method("GetTile", &RTileGetTile)
+        .method("InsertTile", &RTileInsertTile)
+        .method("GetMatrix", &RTileGetMatrix);
+
+    /** MPCR Factorization Class **/
+    class_ <MPCRFactorization>("MPCRFactorization")
+        .property("Row", &MPCRFactorization::GetNRow)
+        .property("Col", &MPCRFactorization::GetNCol)
+        .property("Singular", &MPCRFactorization::IsSingular)
+        .method("PrintFactorization", &MPCRFactorization::Print)
+        .method("show", &RFactorizationGetType);
 
     /** Function that are not masked **/
 
@@ -148,33 +195,89 @@ RCPP_MODULE(MPCR) {
     function("MPCR.forwardsolve", &RBackSolve,
              List::create(_[ "r" ], _[ "x" ], _[ "k" ] = -1,
                           _[ "upper.tri" ] = false, _[ "transpose" ] = false));
-    function("MPCR.chol", &RCholesky);
-    function("MPCR.chol2inv", &RCholeskyInv);
+    function("MPCR.chol", &RCholesky,
+             List::create(_[ "x" ], _[ "upper_triangle" ] = true,
+                          _[ "overwrite" ] = false));
+    function("MPCR.chol.adaptive", &RCholeskyAdaptive,
+             List::create(_[ "x" ], _[ "upper_triangle" ] = true,
+                          _[ "tolerance" ] = 1e-8, _[ "tile_size" ] = 256));
+    function("MPCR.chol2inv", &RCholeskyInv,
+             List::create(_[ "x" ], _[ "size" ],
+                          _[ "internal_precision" ] = "same"));
+    function("MPCR.chol.solve", &RCholeskySolve,
+             List::create(_[ "a" ], _[ "b" ] = R_NilValue,
+                          _[ "internal_precision" ] = "same"));
     function("MPCR.crossprod", &RCrossProduct,
              List::create(_[ "x" ], _[ "y" ] = R_NilValue));
     function("MPCR.tcrossprod", &RTCrossProduct,
              List::create(_[ "x" ], _[ "y" ] = R_NilValue));
     function("MPCR.eigen", &REigen,
-             List::create(_[ "x" ], _[ "only.values" ] = false));
-    function("MPCR.isSymmetric", &RIsSymmetric);
+             List::create(_[ "x" ], _[ "only.values" ] = false,
+                          _[ "overwrite" ] = false));
+    function("MPCR.eigen.partial", &RPartialEigen,
+             List::create(_[ "x" ], _[ "k" ], _[ "which" ] = "largest",
+                          _[ "only.values" ] = false, _[ "method" ] = "syevr",
+                          _[ "tolerance" ] = 1e-8, _[ "max_restarts" ] = 100,
+                          _[ "seed" ] = 0));
+    function("MPCR.isSymmetric", &RIsSymmetric,
+             List::create(_[ "x" ], _[ "tolerance" ] = -1));
     function("MPCR.svd", &RSVD,
              List::create(_[ "x" ], _[ "nu" ] = -1, _[ "nv" ] = -1,
-                          _[ "Transpose" ] = true));
+                          _[ "Transpose" ] = true, _[ "k" ] = -1,
+                          _[ "method" ] = "exact", _[ "oversampling" ] = 10,
+                          _[ "power_iterations" ] = 2,
+                          _[ "internal_precision" ] = "same",
+                          _[ "seed" ] = 0, _[ "overwrite" ] = false));
     function("MPCR.La.svd", &RSVD,
              List::create(_[ "x" ], _[ "nu" ] = -1, _[ "nv" ] = -1,
-                          _[ "Transpose" ] = false));
+                          _[ "Transpose" ] = false, _[ "k" ] = -1,
+                          _[ "method" ] = "exact", _[ "oversampling" ] = 10,
+                          _[ "power_iterations" ] = 2,
+                          _[ "internal_precision" ] = "same",
+                          _[ "seed" ] = 0, _[ "overwrite" ] = false));
+    function("MPCR.prcomp", &RPrincipalComponents,
+             List::create(_[ "x" ], _[ "rank" ], _[ "center" ] = true,
+                          _[ "oversampling" ] = 10,
+                          _[ "power_iterations" ] = 2, _[ "seed" ] = 0));
     function("MPCR.norm", &RNorm, List::create(_[ "x" ], _[ "type" ] = "O"));
-    function("MPCR.qr", &RQRDecomposition,List::create(_["x"]));
+    function("MPCR.qr", &RQRDecomposition,
+             List::create(_[ "x" ], _[ "overwrite" ] = false));
     function("MPCR.qr.Q", &RQRDecompositionQ,
              List::create(_[ "qr" ], _[ "qraux" ], _[ "complete" ] = false,
                           _[ "Dvec" ] = R_NilValue));
     function("MPCR.qr.R", &RQRDecompositionR);
+    function("MPCR.tsqr", &RTSQR,
+             List::create(_[ "x" ], _[ "y" ] = R_NilValue, _[ "q" ] = false,
+                          _[ "block_rows" ] = 0));
+    function("MPCR.lm.fit", &RLeastSquares,
+             List::create(_[ "x" ], _[ "y" ], _[ "weights" ] = R_NilValue,
+                          _[ "lambda" ] = 0, _[ "method" ] = "auto",
+                          _[ "internal_precision" ] = "same",
+                          _[ "tol" ] = 1e-7));
     function("MPCR.rcond", &RRCond,
              List::create(_[ "x" ], _[ "norm" ] = "O", _[ "useInv" ] = false));
+    function("MPCR.determinant", &RDeterminant,
+             List::create(_[ "x" ], _[ "logarithm" ] = true));
     function("MPCR.solve", &RSolve,
              List::create(_[ "a" ], _[ "b" ] = R_NilValue,
-                          _[ "internal_precision" ] = "same"));
+                          _[ "internal_precision" ] = "same",
+                          _[ "overwrite" ] = false));
     function("MPCR.t", &RTranspose);
+    function("MPCR.crossprod.packed", &RPackedCrossProduct,
+             List::create(_[ "x" ], _[ "upper_triangle" ] = true,
+                          _[ "transpose" ] = true));
+    function("MPCR.tcrossprod.packed", &RPackedCrossProduct,
+             List::create(_[ "x" ], _[ "upper_triangle" ] = true,
+                          _[ "transpose" ] = false));
+    function("MPCR.sparse", &RSparseFromTriplets,
+             List::create(_[ "i" ], _[ "j" ], _[ "x" ], _[ "nrow" ],
+                          _[ "ncol" ], _[ "precision" ] = "double",
+                          _[ "format" ] = "CSR"));
+    function("MPCR.sparse.multiply", &RSparseMultiply);
+    function("MPCR.dense.sparse.multiply", &RDenseSparseMultiply);
+    function("MPCR.sparse.crossprod", &RSparseCrossProduct);
+    function("MPCR.sparse.tcrossprod", &RSparseTCrossProduct);
+    function("MPCR.sparse.t", &RSparseTranspose);
     function("MPCR.qr.qy", &RQRDecompositionQy);
     function("MPCR.qr.qty", &RQRDecompositionQty);
 
@@ -183,18 +286,75 @@ RCPP_MODULE(MPCR) {
                           _[ "precision" ],_["placement"]="CPU"));
 
 
-    /** Function to expose gemm , trsm , syrk **/
+    /** Function to expose gemm , gemv , trsm , trmm , symm **/
     function("MPCR.gemm", &RGemm,
              List::create(_[ "a" ], _[ "b" ] = R_NilValue, _[ "c" ],
                           _[ "transpose_a" ] = false,
                           _[ "transpose_b" ] = false, _[ "alpha" ] = 1,
                           _[ "beta" ] = 0));
 
+    function("MPCR.gemv", &RGemv,
+             List::create(_[ "a" ], _[ "x" ], _[ "y" ],
+                          _[ "transpose" ] = false, _[ "alpha" ] = 1,
+                          _[ "beta" ] = 0));
+
     function("MPCR.trsm", &RTrsm,
              List::create(_[ "a" ], _[ "b" ], _[ "upper_triangle" ],
                           _[ "transpose" ] = false, _[ "side" ] = 'L',
                           _[ "alpha" ] = 1));
 
+    function("MPCR.trmm", &RTrmm,
+             List::create(_[ "a" ], _[ "b" ], _[ "upper_triangle" ],
+                          _[ "transpose" ] = false, _[ "side" ] = 'L',
+                          _[ "alpha" ] = 1));
+
+    function("MPCR.symm", &RSymm,
+             List::create(_[ "a" ], _[ "b" ], _[ "upper_triangle" ] = true,
+                          _[ "side" ] = 'L', _[ "alpha" ] = 1));
+
+    /** Tile-parallel gemm , trsm , syrk **/
+    function("MPCRTile.gemm", &RTileGemm,
+             List::create(_[ "a" ], _[ "b" ], _[ "c" ],
+                          _[ "transpose_a" ] = false,
+                          _[ "transpose_b" ] = false, _[ "alpha" ] = 1,
+                          _[ "beta" ] = 0));
+    function("MPCRTile.trsm", &RTileTrsm,
+             List::create(_[ "a" ], _[ "b" ], _[ "upper_triangle" ],
+                          _[ "transpose" ] = false, _[ "side" ] = 'L',
+                          _[ "alpha" ] = 1));
+    function("MPCRTile.syrk", &RTileSyrk,
+             List::create(_[ "a" ], _[ "c" ], _[ "transpose" ] = false,
+                          _[ "alpha" ] = 1, _[ "beta" ] = 0));
+
+
+    /** Reusable factorizations **/
+    function("MPCR.factorize", &RFactorize,
+             List::create(_[ "x" ], _[ "type" ] = "lu"));
+    function("MPCR.factorization.solve", &RFactorizationSolve,
+             List::create(_[ "a" ], _[ "b" ] = R_NilValue));
+    function("MPCR.factorization.determinant", &RFactorizationDeterminant,
+             List::create(_[ "x" ], _[ "logarithm" ] = true));
+    function("MPCR.factorization.rcond", &RFactorizationRCond,
+             List::create(_[ "x" ], _[ "norm" ] = "O"));
+
+
+    /** Batched small-matrix linear algebra over lists of MPCR objects **/
+    function("MPCR.batch.gemm", &RBatchGemm,
+             List::create(_[ "a" ], _[ "b" ], _[ "c" ] = R_NilValue,
+                          _[ "transpose_a" ] = false,
+                          _[ "transpose_b" ] = false, _[ "alpha" ] = 1,
+                          _[ "beta" ] = 0));
+    function("MPCR.batch.chol", &RBatchCholesky,
+             List::create(_[ "x" ], _[ "upper_triangle" ] = true));
+    function("MPCR.batch.trsm", &RBatchTrsm,
+             List::create(_[ "a" ], _[ "b" ], _[ "upper_triangle" ],
+                          _[ "transpose" ] = false, _[ "side" ] = 'L',
+                          _[ "alpha" ] = 1));
+    function("MPCR.batch.solve", &RBatchSolve,
+             List::create(_[ "a" ], _[ "b" ]));
+    function("MPCR.batch.eigen", &RBatchEigen,
+             List::create(_[ "x" ], _[ "only_values" ] = false));
+
 
     function("MPCR.copy",&RCopyMPR,List::create(_["x"]));
 
@@ -203,5 +363,6 @@ RCPP_MODULE(MPCR) {
 
     function("MPCR.SetOperationPlacement",&SetOperationPlacement,List::create(_["placement"]));
     function("MPCR.GetOperationPlacement",&GetOperationPlacement);
+    function("MPCR.FreeScratchMemory",&FreeScratchMemory);
 
 }
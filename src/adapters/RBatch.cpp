@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <adapters/RBatch.hpp>
+
+
+using namespace mpcr::operations;
+using namespace mpcr::precision;
+
+
+/**
+ * @brief
+ * Unwrap a list of MPCR objects into DataType pointers
+ *
+ */
+std::vector <DataType *>
+GetBatchObjects(Rcpp::ListOf <SEXP> &aList) {
+    std::vector <DataType *> objects;
+    objects.reserve(aList.size());
+
+    for (auto itr = aList.begin(); itr < aList.end(); ++itr) {
+        auto temp_mpr = (DataType *) Rcpp::internal::as_module_object_internal(
+            itr->get());
+        if (!temp_mpr->IsDataType()) {
+            MPCR_API_EXCEPTION(
+                "Undefined Object . Make Sure all Objects are MMPR Objects",
+                (int) objects.size());
+        }
+        objects.push_back(temp_mpr);
+    }
+
+    return objects;
+}
+
+
+/**
+ * @brief
+ * Allocate the output objects of a batch, the precision of each one is set
+ * by the batched routine.
+ *
+ */
+void
+AllocateBatchOutputs(const size_t &aSize, std::vector <DataType> &aOutput,
+                     std::vector <DataType *> &aPointers) {
+    aOutput.reserve(aOutput.size() + aSize);
+    for (auto i = 0; i < aSize; i++) {
+        aOutput.emplace_back(DOUBLE);
+        aPointers.push_back(&aOutput.back());
+    }
+}
+
+
+std::vector <DataType>
+RBatchGemm(Rcpp::ListOf <SEXP> aInputA, Rcpp::ListOf <SEXP> aInputB,
+           SEXP aInputC, const bool &aTransposeA, const bool &aTransposeB,
+           const double &aAlpha, const double &aBeta) {
+
+    auto input_a = GetBatchObjects(aInputA);
+    auto input_b = GetBatchObjects(aInputB);
+    std::vector <DataType> output;
+    std::vector <DataType *> pointers;
+
+    if (aBeta == 0) {
+        AllocateBatchOutputs(input_a.size(), output, pointers);
+    } else if (aInputC == R_NilValue) {
+        MPCR_API_EXCEPTION("C must be provided if beta is not zero", -1);
+    } else {
+        Rcpp::ListOf <SEXP> list_c(aInputC);
+        auto input_c = GetBatchObjects(list_c);
+        output.reserve(input_c.size());
+        for (auto &c: input_c) {
+            output.emplace_back(*c);
+            pointers.push_back(&output.back());
+        }
+    }
+
+    batch::BatchGemm(input_a, input_b, pointers, aTransposeA, aTransposeB,
+                     aAlpha, aBeta);
+    return output;
+}
+
+
+std::vector <DataType>
+RBatchCholesky(Rcpp::ListOf <SEXP> aInputs, const bool &aUpperTriangle) {
+
+    auto inputs = GetBatchObjects(aInputs);
+    std::vector <DataType> output;
+    std::vector <DataType *> pointers;
+    AllocateBatchOutputs(inputs.size(), output, pointers);
+
+    batch::BatchCholesky(inputs, pointers, aUpperTriangle);
+    return output;
+}
+
+
+std::vector <DataType>
+RBatchTrsm(Rcpp::ListOf <SEXP> aInputA, Rcpp::ListOf <SEXP> aInputB,
+           const bool &aUpperTriangle, const bool &aTranspose,
+           const char &aSide, const double &aAlpha) {
+
+    auto input_a = GetBatchObjects(aInputA);
+    auto input_b = GetBatchObjects(aInputB);
+    std::vector <DataType> output;
+    std::vector <DataType *> pointers;
+    AllocateBatchOutputs(input_a.size(), output, pointers);
+
+    batch::BatchTrsm(input_a, input_b, pointers, ( aSide == 'L' ),
+                     aUpperTriangle, aTranspose, aAlpha);
+    return output;
+}
+
+
+std::vector <DataType>
+RBatchSolve(Rcpp::ListOf <SEXP> aInputA, Rcpp::ListOf <SEXP> aInputB) {
+
+    auto input_a = GetBatchObjects(aInputA);
+    auto input_b = GetBatchObjects(aInputB);
+    std::vector <DataType> output;
+    std::vector <DataType *> pointers;
+    AllocateBatchOutputs(input_a.size(), output, pointers);
+
+    batch::BatchSolve(input_a, input_b, pointers);
+    return output;
+}
+
+
+std::vector <DataType>
+RBatchEigen(Rcpp::ListOf <SEXP> aInputs, const bool &aOnlyValues) {
+
+    auto inputs = GetBatchObjects(aInputs);
+    auto batch_size = inputs.size();
+    std::vector <DataType> output;
+    std::vector <DataType *> values;
+    std::vector <DataType *> vectors;
+
+    /** Reserve once so the pointers of both halves stay valid **/
+    output.reserve(batch_size * ( aOnlyValues ? 1 : 2 ));
+    AllocateBatchOutputs(batch_size, output, values);
+    if (!aOnlyValues) {
+        AllocateBatchOutputs(batch_size, output, vectors);
+    }
+
+    batch::BatchEigen(inputs, values, aOnlyValues ? nullptr : &vectors);
+    return output;
+}
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <adapters/RFactorization.hpp>
+#include <sstream>
+
+
+using namespace mpcr::precision;
+
+
+MPCRFactorization *
+RFactorize(DataType *aInput, const std::string &aType) {
+    return new MPCRFactorization(*aInput, aType);
+}
+
+
+DataType *
+RFactorizationSolve(MPCRFactorization *aFactor, SEXP aInputB) {
+
+    auto pOutput = new DataType(aFactor->GetPrecision());
+
+    if ((SEXP) aInputB == R_NilValue) {
+        aFactor->Inverse(*pOutput);
+        return pOutput;
+    }
+
+    auto temp_b = (DataType *) Rcpp::internal::as_module_object_internal(
+        aInputB);
+    if (!temp_b->IsDataType()) {
+        delete pOutput;
+        MPCR_API_EXCEPTION(
+            "Undefined Object . Make Sure You're Using MMPR Object", -1);
+    }
+
+    aFactor->Solve(*temp_b, *pOutput);
+    return pOutput;
+}
+
+
+std::vector <double>
+RFactorizationDeterminant(MPCRFactorization *aFactor,
+                          const bool &aLogarithm) {
+    double modulus = 0;
+    int sign = 1;
+    aFactor->Determinant(modulus, sign, aLogarithm);
+
+    std::vector <double> output;
+    output.push_back(modulus);
+    output.push_back(sign);
+    return output;
+}
+
+
+double
+RFactorizationRCond(MPCRFactorization *aFactor, const std::string &aNorm) {
+    return aFactor->ReciprocalCondition(aNorm);
+}
+
+
+void
+RFactorizationGetType(MPCRFactorization *aFactor) {
+    std::stringstream ss;
+    std::string type;
+
+    if (aFactor->GetFactorizationType() == FactorizationType::LU) {
+        type = "LU";
+    } else if (aFactor->GetFactorizationType() ==
+               FactorizationType::CHOLESKY) {
+        type = "Cholesky";
+    } else {
+        type = "QR";
+    }
+
+    ss << "MPCR " << type << " Factorization Object : " << aFactor->GetNRow()
+       << " x " << aFactor->GetNCol() << " in "
+       << GetPrecisionAsString(aFactor->GetPrecision()) << " precision";
+    if (aFactor->IsSingular()) {
+        ss << " (singular)";
+    }
+    ss << std::endl;
+    Rcpp::Rcout << ss.str();
+}
@@ -37,6 +37,48 @@ RTrsm(DataType *aInputA, DataType *aInputB, const bool &aUpperTri,
 }
 
 
+DataType *
+RTrmm(DataType *aInputA, DataType *aInputB, const bool &aUpperTri,
+      const bool &aTranspose, const char &aSide, const double &aAlpha) {
+
+    Promoter pr(2);
+    pr.Insert(*aInputA);
+    pr.Insert(*aInputB);
+    pr.Promote();
+
+    auto precision = aInputA->GetPrecision();
+    auto pOutput = new DataType(precision);
+
+    SIMPLE_DISPATCH(precision, linear::TriangularMultiply, *aInputA, *aInputB,
+                    *pOutput, aUpperTri, aTranspose, aSide, aAlpha)
+
+    pr.DePromote();
+
+    return pOutput;
+}
+
+
+DataType *
+RSymm(DataType *aInputA, DataType *aInputB, const bool &aUpperTri,
+      const char &aSide, const double &aAlpha) {
+
+    Promoter pr(2);
+    pr.Insert(*aInputA);
+    pr.Insert(*aInputB);
+    pr.Promote();
+
+    auto precision = aInputA->GetPrecision();
+    auto pOutput = new DataType(precision);
+
+    SIMPLE_DISPATCH(precision, linear::SymmetricMultiply, *aInputA, *aInputB,
+                    *pOutput, aUpperTri, aSide, aAlpha)
+
+    pr.DePromote();
+
+    return pOutput;
+}
+
+
 void
 RGemm(DataType *aInputA, SEXP aInputB, DataType *aInputC,
       const bool &aTransposeA, const bool &aTransposeB, const double &aAlpha,
@@ -45,9 +87,10 @@ RGemm(DataType *aInputA, SEXP aInputB, DataType *aInputC,
     bool aSingle = ((SEXP) aInputB == R_NilValue );
     Promoter pr(3);
     DataType *temp_b = nullptr;
+    /* An empty B selects the Syrk path, it must outlive the dispatch */
+    DataType dump(0, aInputA->GetPrecision());
 
     if (aSingle) {
-        DataType dump(0, aInputA->GetPrecision());
         temp_b = &dump;
     } else {
         temp_b = (DataType *) Rcpp::internal::as_module_object_internal(
@@ -78,6 +121,59 @@ RGemm(DataType *aInputA, SEXP aInputB, DataType *aInputC,
 }
 
 
+void
+RGemv(DataType *aInputA, DataType *aInputX, DataType *aInputY,
+      const bool &aTranspose, const double &aAlpha, const double &aBeta) {
+
+    if (!aInputA->IsMatrix()) {
+        MPCR_API_EXCEPTION("Gemv expects A to be an MPCR Matrix", -1);
+    }
+
+    auto row = aTranspose ? aInputA->GetNCol() : aInputA->GetNRow();
+    auto col = aTranspose ? aInputA->GetNRow() : aInputA->GetNCol();
+
+    if (aInputX->GetSize() != col ||
+        ( aInputX->IsMatrix() && aInputX->GetNCol() != 1 )) {
+        MPCR_API_EXCEPTION("Wrong Dimensions of Vector x", -1);
+    }
+    if (aInputY->GetSize() != 0 && ( aInputY->GetSize() != row ||
+                                     ( aInputY->IsMatrix() &&
+                                       aInputY->GetNCol() != 1 ))) {
+        MPCR_API_EXCEPTION("Wrong Dimensions of Vector y", -1);
+    }
+
+    /* Vectors are viewed as single columns for the dispatch, y is returned
+     * as a vector unless it was given as a one column matrix */
+    auto flag_conv_x = !aInputX->IsMatrix();
+    auto flag_conv_y = !aInputY->IsMatrix();
+    if (flag_conv_x) {
+        aInputX->SetDimensions(col, 1);
+    }
+    if (flag_conv_y && aInputY->GetSize() != 0) {
+        aInputY->SetDimensions(row, 1);
+    }
+
+    Promoter pr(3);
+    pr.Insert(*aInputA);
+    pr.Insert(*aInputX);
+    pr.Insert(*aInputY);
+    pr.Promote(FLOAT);
+
+    auto precision = aInputA->GetPrecision();
+    SIMPLE_DISPATCH(precision, linear::CrossProduct, *aInputA, *aInputX,
+                    *aInputY, aTranspose, false, false, aAlpha, aBeta)
+
+    pr.DePromote();
+
+    if (flag_conv_x) {
+        aInputX->ToVector();
+    }
+    if (flag_conv_y) {
+        aInputY->ToVector();
+    }
+}
+
+
 DataType *
 RCrossProduct(DataType *aInputA, SEXP aInputB) {
 
@@ -88,9 +184,10 @@ RCrossProduct(DataType *aInputA, SEXP aInputB) {
     Promoter pr(2);
     auto transpose = false;
     DataType *temp_b = nullptr;
+    /* An empty B selects the Syrk path, it must outlive the dispatch */
+    DataType dump(0, aInputA->GetPrecision());
 
     if (aSingle) {
-        DataType dump(0, aInputA->GetPrecision());
         temp_b = &dump;
         transpose = true;
     } else {
@@ -135,9 +232,10 @@ RTCrossProduct(DataType *aInputA, SEXP aInputB) {
     bool aSingle = ((SEXP) aInputB == R_NilValue );
     Promoter pr(2);
     DataType *temp_b = nullptr;
+    /* An empty B selects the Syrk path, it must outlive the dispatch */
+    DataType dump(0, aInputA->GetPrecision());
 
     if (aSingle) {
-        DataType dump(0, aInputA->GetPrecision());
         temp_b = &dump;
     } else {
         temp_b = (DataType *) Rcpp::internal::as_module_object_internal(
@@ -174,11 +272,11 @@ RTCrossProduct(DataType *aInputA, SEXP aInputB) {
 
 
 bool
-RIsSymmetric(DataType *aInputA) {
+RIsSymmetric(DataType *aInputA, const double &aTolerance) {
 
     bool output = false;
     SIMPLE_DISPATCH(aInputA->GetPrecision(), linear::IsSymmetric, *aInputA,
-                    output)
+                    output, aTolerance)
     return output;
 
 }
@@ -209,27 +307,90 @@ RBackSolve(DataType *aInputA, DataType *aInputB, const long &aCol,
 
 
 DataType *
-RCholesky(DataType *aInputA, const bool &aUpperTriangle) {
+RCholesky(DataType *aInputA, const bool &aUpperTriangle,
+          const bool &aOverwrite) {
     auto precision = aInputA->GetPrecision();
     auto pOutput = new DataType(precision);
     SIMPLE_DISPATCH(precision, linear::Cholesky, *aInputA, *pOutput,
-                    aUpperTriangle)
+                    aUpperTriangle, aOverwrite)
     return pOutput;
 
 }
 
 
+std::vector <DataType>
+RCholeskyAdaptive(DataType *aInputA, const bool &aUpperTriangle,
+                  const double &aTolerance, const size_t &aTileSize) {
+    auto precision = aInputA->GetPrecision();
+    DataType factor(precision);
+    double accuracy = 0;
+    std::vector <double> flop_share;
+
+    SIMPLE_DISPATCH(precision, linear::Cholesky, *aInputA, factor,
+                    aUpperTriangle, aTolerance, aTileSize, accuracy,
+                    flop_share)
+
+    std::vector <double> info = {accuracy};
+    info.insert(info.end(), flop_share.begin(), flop_share.end());
+
+    std::vector <DataType> output;
+    output.push_back(factor);
+    output.push_back(DataType(info, DOUBLE));
+
+    return output;
+}
+
+
+DataType *
+RCholeskyInv(DataType *aInputA, const size_t &aSize,
+             const std::string &aInternalPrecision) {
+    auto precision = aInputA->GetPrecision();
+    auto pOutput = new DataType(precision);
+    SIMPLE_DISPATCH(precision, linear::CholeskyInv, *aInputA, *pOutput, aSize,
+                    aInternalPrecision)
+    return pOutput;
+}
+
+
 DataType *
-RCholeskyInv(DataType *aInputA, const size_t &aSize) {
+RCholeskySolve(DataType *aInputA, SEXP aInputB,
+               const std::string &aInternalPrecision) {
+
+    bool aSingle = ((SEXP) aInputB == R_NilValue );
+    Promoter pr(2);
+    DataType dump(0, aInputA->GetPrecision());
+    DataType *temp_b = &dump;
+
+    if (!aSingle) {
+        temp_b = (DataType *) Rcpp::internal::as_module_object_internal(
+            aInputB);
+        if (!temp_b->IsDataType()) {
+            MPCR_API_EXCEPTION(
+                "Undefined Object . Make Sure You're Using MMPR Object",
+                -1);
+        }
+        pr.Insert(*aInputA);
+        pr.Insert(*temp_b);
+        pr.Promote();
+    }
+
     auto precision = aInputA->GetPrecision();
+
     auto pOutput = new DataType(precision);
-    SIMPLE_DISPATCH(precision, linear::CholeskyInv, *aInputA, *pOutput, aSize)
+    SIMPLE_DISPATCH(precision, linear::CholeskySolve, *aInputA, *temp_b,
+                    *pOutput, aSingle, aInternalPrecision)
+
+    if (!aSingle) {
+        pr.DePromote();
+    }
+
     return pOutput;
 }
 
 
 DataType *
-RSolve(DataType *aInputA, SEXP aInputB, const std::string &aInternalPrecision) {
+RSolve(DataType *aInputA, SEXP aInputB, const std::string &aInternalPrecision,
+       const bool &aOverwrite) {
 
     bool aSingle = ((SEXP) aInputB == R_NilValue );
     Promoter pr(2);
@@ -255,7 +416,7 @@ RSolve(DataType *aInputA, SEXP aInputB, const std::string &aInternalPrecision) {
 
     auto pOutput = new DataType(precision);
     SIMPLE_DISPATCH(precision, linear::Solve, *aInputA, *temp_b,
-                    *pOutput, aSingle, aInternalPrecision)
+                    *pOutput, aSingle, aInternalPrecision, aOverwrite)
 
     if (!aSingle) {
         pr.DePromote();
@@ -268,12 +429,55 @@ RSolve(DataType *aInputA, SEXP aInputB, const std::string &aInternalPrecision) {
 
 std::vector <DataType>
 RSVD(DataType *aInputA, const long &aNu, const long &aNv,
-     const bool &aTranspose) {
+     const bool &aTranspose, const long &aRank, const std::string &aMethod,
+     const size_t &aOversampling, const size_t &aPowerIterations,
+     const std::string &aInternalPrecision, const size_t &aSeed,
+     const bool &aOverwrite) {
 
     auto row = aInputA->GetNRow();
     auto col = aInputA->GetNCol();
     auto nv = aNv;
     auto nu = aNu;
+    auto reduced_precision = mpcr::precision::IsReducedPrecision(
+        aInternalPrecision);
+
+    if (aMethod == "randomized") {
+        if (aRank <= 0) {
+            MPCR_API_EXCEPTION("k must be given for the randomized SVD", -1);
+        }
+
+        auto precision = aInputA->GetPrecision();
+        auto working_precision = precision;
+        if (reduced_precision) {
+            working_precision = FLOAT;
+        }
+
+        std::vector <DataType> output;
+        output.reserve(3);
+        output.emplace_back(working_precision);
+        output.emplace_back(working_precision);
+        output.emplace_back(working_precision);
+
+        if (working_precision != precision) {
+            DataType input(*aInputA, working_precision);
+            SIMPLE_DISPATCH(working_precision, linear::RandomizedSVD, input,
+                            output[ 0 ], output[ 1 ], output[ 2 ], aRank,
+                            aOversampling, aPowerIterations, aTranspose,
+                            nullptr, aSeed)
+            for (auto &out: output) {
+                out.ConvertPrecision(precision);
+            }
+        } else {
+            SIMPLE_DISPATCH(precision, linear::RandomizedSVD, *aInputA,
+                            output[ 0 ], output[ 1 ], output[ 2 ], aRank,
+                            aOversampling, aPowerIterations, aTranspose,
+                            nullptr, aSeed)
+        }
+        return output;
+
+    } else if (aMethod != "exact") {
+        MPCR_API_EXCEPTION("Method must be either exact or randomized", -1);
+    }
 
     if (aNv < 0) {
         nv = std::min(row, col);
@@ -282,6 +486,12 @@ RSVD(DataType *aInputA, const long &aNu, const long &aNv,
         nu = std::min(row, col);
     }
 
+    /* k overrides nu and nv, including their defaults */
+    if (aRank > 0) {
+        nu = aRank;
+        nv = aRank;
+    }
+
 
     auto precision = aInputA->GetPrecision();
 
@@ -291,7 +501,7 @@ RSVD(DataType *aInputA, const long &aNu, const long &aNv,
 
 
     SIMPLE_DISPATCH(precision, linear::SVD, *aInputA, *d, *u, *v, nu, nv,
-                    aTranspose)
+                    aTranspose, aOverwrite)
 
     std::vector <DataType> output;
 
@@ -304,10 +514,87 @@ RSVD(DataType *aInputA, const long &aNu, const long &aNv,
 }
 
 
+std::vector <DataType>
+RPartialEigen(DataType *aInput, const size_t &aNumValues,
+              const std::string &aWhich, const bool &aOnlyValues,
+              const std::string &aMethod, const double &aTolerance,
+              const size_t &aMaxRestarts, const size_t &aSeed) {
+
+    if (aWhich != "largest" && aWhich != "smallest") {
+        MPCR_API_EXCEPTION("which must be either largest or smallest", -1);
+    }
+
+    auto precision = aInput->GetPrecision();
+    auto largest = ( aWhich == "largest" );
+    std::vector <DataType> output;
+    output.reserve(2);
+    output.emplace_back(precision);
+    output.emplace_back(precision);
+    auto pVectors = aOnlyValues ? nullptr : &output[ 1 ];
+
+    if (aMethod == "lanczos") {
+        SIMPLE_DISPATCH(precision, linear::Lanczos, *aInput, output[ 0 ],
+                        pVectors, aNumValues, largest, aTolerance,
+                        aMaxRestarts, aSeed)
+    } else if (aMethod == "syevr") {
+        auto size = aInput->GetNCol();
+        if (aNumValues == 0 || aNumValues > size) {
+            MPCR_API_EXCEPTION(
+                "Number of eigen values must be between 1 and ncol", -1);
+        }
+        size_t first = largest ? 1 : size - aNumValues + 1;
+        size_t last = largest ? aNumValues : size;
+        SIMPLE_DISPATCH(precision, linear::EigenRange, *aInput, output[ 0 ],
+                        pVectors, first, last)
+    } else {
+        MPCR_API_EXCEPTION("Method must be either syevr or lanczos", -1);
+    }
+
+    if (aOnlyValues) {
+        output.pop_back();
+    }
+    return output;
+}
+
+
+std::vector <DataType>
+RPrincipalComponents(DataType *aInput, const size_t &aRank,
+                     const bool &aCenter, const size_t &aOversampling,
+                     const size_t &aPowerIterations, const size_t &aSeed) {
+
+    auto precision = aInput->GetPrecision();
+    std::vector <DataType> output;
+    output.reserve(4);
+    for (auto i = 0; i < 4; i++) {
+        output.emplace_back(precision);
+    }
+
+    SIMPLE_DISPATCH(precision, linear::PrincipalComponents, *aInput,
+                    output[ 0 ], output[ 1 ], output[ 3 ], output[ 2 ], aRank,
+                    aCenter, aOversampling, aPowerIterations, aSeed)
+
+    if (!aCenter) {
+        output.pop_back();
+    }
+    return output;
+}
+
+
 DataType *
 RTranspose(DataType *aInputA) {
     auto pOutput = new DataType(*aInputA);
-    pOutput->Transpose();
+    pOutput->LazyTranspose();
+    return pOutput;
+}
+
+
+DataType *
+RPackedCrossProduct(DataType *aInputA, const bool &aUpperTriangle,
+                    const bool &aTranspose) {
+    auto precision = aInputA->GetPrecision();
+    auto pOutput = new DataType(precision);
+    SIMPLE_DISPATCH(precision, linear::PackedCrossProduct, *aInputA, *pOutput,
+                    aTranspose, aUpperTriangle)
     return pOutput;
 }
 
@@ -322,8 +609,24 @@ RNorm(DataType *aInputA, const std::string &aType) {
 }
 
 
+
+std::vector <double>
+RDeterminant(DataType *aInputA, const bool &aLogarithm) {
+    auto precision = aInputA->GetPrecision();
+    double modulus = 0;
+    int sign = 1;
+
+    SIMPLE_DISPATCH(precision, linear::Determinant, *aInputA, modulus, sign,
+                    aLogarithm)
+
+    std::vector <double> output;
+    output.push_back(modulus);
+    output.push_back(sign);
+    return output;
+}
+
 std::vector <DataType>
-RQRDecomposition(DataType *aInputA) {
+RQRDecomposition(DataType *aInputA, const bool &aOverwrite) {
 
     auto precision = aInputA->GetPrecision();
 
@@ -333,7 +636,7 @@ RQRDecomposition(DataType *aInputA) {
     auto rank = new DataType(precision);
 
     SIMPLE_DISPATCH(precision, linear::QRDecomposition, *aInputA, *qr, *qraux,
-                    *pivot, *rank)
+                    *pivot, *rank, aOverwrite)
 
     std::vector <DataType> output;
     output.push_back(*qr);
@@ -423,8 +726,20 @@ RQRDecompositionQ(DataType *aInputA, DataType *aInputB, const bool &aComplete,
                 "Undefined Object . Make Sure You're Using MMPR Object",
                 -1);
         }
+        /* Q %*% diag(Dvec), applying the reflectors to the diagonal */
+        auto row = aInputA->GetNRow();
+        auto ncol = aComplete ? row : std::min(row, aInputA->GetNCol());
+        if (temp_dvec->GetSize() != ncol) {
+            MPCR_API_EXCEPTION("Dvec length must match the columns of Q", -1);
+        }
+        std::vector <double> diagonal(row * ncol, 0);
+        for (auto i = 0; i < ncol; i++) {
+            diagonal[ i + ( i * row ) ] = temp_dvec->GetVal(i);
+        }
+        DataType dvec_matrix(diagonal, precision);
+        dvec_matrix.ToMatrix(row, ncol);
         SIMPLE_DISPATCH(precision, linear::QRDecompositionQY, *aInputA,
-                        *aInputB, *temp_dvec, *pOutput, aComplete)
+                        *aInputB, dvec_matrix, *pOutput, false)
     }
 
     return pOutput;
@@ -457,7 +772,78 @@ RQRDecompositionQty(DataType *aInputA, DataType *aInputB, DataType *aDvec) {
 
 
 std::vector <DataType>
-REigen(DataType *aInputA, const bool &aOnlyValues) {
+RLeastSquares(DataType *aInputX, DataType *aInputY, SEXP aWeights,
+              const double &aLambda, const std::string &aMethod,
+              const std::string &aInternalPrecision, const double &aTolerance) {
+
+    DataType *pWeights = nullptr;
+    if (aWeights != R_NilValue) {
+        pWeights = (DataType *) Rcpp::internal::as_module_object_internal(
+            aWeights);
+        if (!pWeights->IsDataType()) {
+            MPCR_API_EXCEPTION(
+                "Undefined Object . Make Sure You're Using MMPR Object",
+                -1);
+        }
+    }
+
+    auto precision = aInputX->GetPrecision();
+    std::vector <DataType> output;
+    output.reserve(3);
+    output.emplace_back(precision);
+    output.emplace_back(precision);
+    size_t rank = 0;
+
+    SIMPLE_DISPATCH(precision, linear::LeastSquares, *aInputX, *aInputY,
+                    pWeights, output[ 0 ], output[ 1 ], rank, aLambda, aMethod,
+                    aInternalPrecision, aTolerance)
+
+    std::vector <double> rank_value = {(double) rank};
+    output.emplace_back(rank_value, precision);
+
+    return output;
+}
+
+
+std::vector <DataType>
+RTSQR(DataType *aInput, SEXP aInputY, const bool &aComputeQ,
+      const size_t &aBlockRows) {
+
+    DataType *pInput_y = nullptr;
+    if (aInputY != R_NilValue) {
+        pInput_y = (DataType *) Rcpp::internal::as_module_object_internal(
+            aInputY);
+        if (!pInput_y->IsDataType()) {
+            MPCR_API_EXCEPTION(
+                "Undefined Object . Make Sure You're Using MMPR Object",
+                -1);
+        }
+    }
+
+    auto precision = aInput->GetPrecision();
+    std::vector <DataType> output;
+    output.reserve(3);
+    output.emplace_back(precision);
+    output.emplace_back(precision);
+    output.emplace_back(precision);
+
+    SIMPLE_DISPATCH(precision, linear::TSQR, *aInput, output[ 0 ],
+                    aComputeQ ? &output[ 1 ] : nullptr,
+                    pInput_y, pInput_y ? &output[ 2 ] : nullptr, aBlockRows)
+
+    if (!pInput_y) {
+        output.pop_back();
+    }
+    if (!aComputeQ) {
+        output.erase(output.begin() + 1);
+    }
+
+    return output;
+}
+
+
+std::vector <DataType>
+REigen(DataType *aInputA, const bool &aOnlyValues, const bool &aOverwrite) {
 
     /**
      * This if condition is added since MKL eigen routine has a bug with float
@@ -480,7 +866,8 @@ REigen(DataType *aInputA, const bool &aOnlyValues) {
         pVector = new DataType(precision);
     }
 
-    SIMPLE_DISPATCH(precision, linear::Eigen, *aInputA, *pValues, pVector)
+    SIMPLE_DISPATCH(precision, linear::Eigen, *aInputA, *pValues, pVector,
+                    aOverwrite)
 
     output.push_back(*pValues);
     if (!aOnlyValues) {
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <adapters/RSparse.hpp>
+#include <utilities/MPCRDispatcher.hpp>
+#include <algorithm>
+#include <sstream>
+
+
+using namespace mpcr::operations;
+using namespace mpcr::precision;
+
+
+/**
+ * @brief
+ * Parse the compressed layout given from R
+ *
+ * @param[in] aFormat
+ * "CSR" or "CSC" (case insensitive)
+ * @returns
+ * SparseFormat enum
+ *
+ */
+SparseFormat
+GetInputSparseFormat(std::string aFormat) {
+    std::transform(aFormat.begin(), aFormat.end(), aFormat.begin(), ::toupper);
+    if (aFormat == "CSR") {
+        return SparseFormat::CSR;
+    } else if (aFormat == "CSC") {
+        return SparseFormat::CSC;
+    }
+    MPCR_API_EXCEPTION("Unknown sparse format, CSR or CSC are supported", -1);
+    return SparseFormat::CSR;
+}
+
+
+/**
+ * @brief
+ * Run a sparse-dense multiplication, the dense operand is computed in the
+ * precision of the sparse one.
+ *
+ */
+DataType *
+SparseMultiplyHelper(SparseDataType *aInputA, DataType *aInputB,
+                     const bool &aTransposeA, const bool &aTransposeB) {
+
+    auto precision = aInputA->GetPrecision();
+    auto pOutput = new DataType(precision);
+
+    if (aInputB->GetPrecision() != precision) {
+        DataType temp(*aInputB, precision);
+        SIMPLE_DISPATCH(precision, linear::CrossProduct, *aInputA, temp,
+                        *pOutput, aTransposeA, aTransposeB)
+    } else {
+        SIMPLE_DISPATCH(precision, linear::CrossProduct, *aInputA, *aInputB,
+                        *pOutput, aTransposeA, aTransposeB)
+    }
+    return pOutput;
+}
+
+
+SparseDataType *
+RSparseFromTriplets(std::vector <double> &aRowIdx,
+                    std::vector <double> &aColIdx,
+                    std::vector <double> &aValues, const size_t &aNumRow,
+                    const size_t &aNumCol, const std::string &aPrecision,
+                    const std::string &aFormat) {
+
+    if (aRowIdx.size() != aValues.size() || aColIdx.size() != aValues.size()) {
+        MPCR_API_EXCEPTION("i, j and x must have the same length", -1);
+    }
+
+    std::vector <size_t> row_idx(aRowIdx.size());
+    std::vector <size_t> col_idx(aColIdx.size());
+
+    for (auto i = 0; i < aValues.size(); i++) {
+        if (aRowIdx[ i ] < 1 || aColIdx[ i ] < 1) {
+            MPCR_API_EXCEPTION("Indices must be positive (one based)", -1);
+        }
+        row_idx[ i ] = (size_t) aRowIdx[ i ] - 1;
+        col_idx[ i ] = (size_t) aColIdx[ i ] - 1;
+    }
+
+    return new SparseDataType(row_idx, col_idx, aValues, aNumRow, aNumCol,
+                              GetInputPrecision(aPrecision),
+                              GetInputSparseFormat(aFormat));
+}
+
+
+DataType *
+RSparseMultiply(SparseDataType *aInputA, DataType *aInputB) {
+    return SparseMultiplyHelper(aInputA, aInputB, false, false);
+}
+
+
+DataType *
+RDenseSparseMultiply(DataType *aInputA, SparseDataType *aInputB) {
+
+    auto precision = aInputB->GetPrecision();
+    auto pOutput = new DataType(precision);
+
+    if (aInputA->GetPrecision() != precision) {
+        DataType temp(*aInputA, precision);
+        SIMPLE_DISPATCH(precision, linear::CrossProduct, temp, *aInputB,
+                        *pOutput, false, false)
+    } else {
+        SIMPLE_DISPATCH(precision, linear::CrossProduct, *aInputA, *aInputB,
+                        *pOutput, false, false)
+    }
+    return pOutput;
+}
+
+
+DataType *
+RSparseCrossProduct(SparseDataType *aInputA, DataType *aInputB) {
+    return SparseMultiplyHelper(aInputA, aInputB, true, false);
+}
+
+
+DataType *
+RSparseTCrossProduct(SparseDataType *aInputA, DataType *aInputB) {
+    return SparseMultiplyHelper(aInputA, aInputB, false, true);
+}
+
+
+SparseDataType *
+RSparseTranspose(SparseDataType *aInput) {
+    auto pOutput = new SparseDataType(*aInput);
+    pOutput->Transpose();
+    return pOutput;
+}
+
+
+DataType *
+RSparseToDense(SparseDataType *aInput) {
+    auto pOutput = new DataType(aInput->GetPrecision());
+    aInput->ToDense(*pOutput);
+    return pOutput;
+}
+
+
+void
+RSparseConvertFormat(SparseDataType *aInput, const std::string &aFormat) {
+    aInput->ConvertFormat(GetInputSparseFormat(aFormat));
+}
+
+
+std::string
+RSparseGetFormat(SparseDataType *aInput) {
+    return ( aInput->GetFormat() == SparseFormat::CSR ) ? "CSR" : "CSC";
+}
+
+
+void
+RSparseGetType(SparseDataType *aInput) {
+    std::stringstream ss;
+    ss << "MPCR Sparse Object : "
+       << GetPrecisionAsString(aInput->GetPrecision()) << " Precision "
+       << RSparseGetFormat(aInput) << " " << aInput->GetNRow() << " x "
+       << aInput->GetNCol() << " with " << aInput->GetNnz() << " non-zeros"
+       << std::endl;
+    Rcpp::Rcout << ss.str();
+}
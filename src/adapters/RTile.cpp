@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <adapters/RTile.hpp>
+#include <sstream>
+
+
+using namespace mpcr::operations;
+using namespace mpcr::precision;
+
+
+void
+RTileGemm(MPCRTile *aInputA, MPCRTile *aInputB, MPCRTile *aInputC,
+          const bool &aTransposeA, const bool &aTransposeB,
+          const double &aAlpha, const double &aBeta) {
+    tile::TileGemm(*aInputA, *aInputB, *aInputC, aTransposeA, aTransposeB,
+                   aAlpha, aBeta);
+}
+
+
+void
+RTileTrsm(MPCRTile *aInputA, MPCRTile *aInputB, const bool &aUpperTri,
+          const bool &aTranspose, const char &aSide, const double &aAlpha) {
+    auto left_side = ( aSide == 'L' || aSide == 'l' );
+    if (!left_side && aSide != 'R' && aSide != 'r') {
+        MPCR_API_EXCEPTION("Side must be 'L' or 'R'", -1);
+    }
+    tile::TileTrsm(*aInputA, *aInputB, left_side, aUpperTri, aTranspose,
+                   aAlpha);
+}
+
+
+void
+RTileSyrk(MPCRTile *aInputA, MPCRTile *aInputC, const bool &aTranspose,
+          const double &aAlpha, const double &aBeta) {
+    tile::TileSyrk(*aInputA, *aInputC, aTranspose, aAlpha, aBeta);
+}
+
+
+DataType *
+RTileGetMatrix(MPCRTile *aInput) {
+    auto pOutput = new DataType(DOUBLE);
+    aInput->GetMatrix(*pOutput, DOUBLE);
+    return pOutput;
+}
+
+
+DataType *
+RTileGetTile(MPCRTile *aInput, const size_t &aTileRowIdx,
+             const size_t &aTileColIdx) {
+    if (aTileRowIdx < 1 || aTileColIdx < 1) {
+        MPCR_API_EXCEPTION("Tile Index Out Of Bound", -1);
+    }
+    return new DataType(*aInput->GetTile(aTileRowIdx - 1, aTileColIdx - 1));
+}
+
+
+void
+RTileInsertTile(MPCRTile *aInput, DataType *aTile, const size_t &aTileRowIdx,
+                const size_t &aTileColIdx) {
+    if (aTileRowIdx < 1 || aTileColIdx < 1) {
+        MPCR_API_EXCEPTION("Tile Index Out Of Bound", -1);
+    }
+    aInput->InsertTile(*aTile, aTileRowIdx - 1, aTileColIdx - 1);
+}
+
+
+void
+RTileChangePrecision(MPCRTile *aInput, const size_t &aTileRowIdx,
+                     const size_t &aTileColIdx,
+                     const std::string &aPrecision) {
+    if (aTileRowIdx < 1 || aTileColIdx < 1) {
+        MPCR_API_EXCEPTION("Tile Index Out Of Bound", -1);
+    }
+    aInput->ChangeTilePrecision(aTileRowIdx - 1, aTileColIdx - 1,
+                                GetInputPrecision(aPrecision));
+}
+
+
+void
+RTileGetType(MPCRTile *aInput) {
+    std::stringstream ss;
+    ss << "MPCR Tile Object : " << aInput->GetNRow() << " x "
+       << aInput->GetNCol() << " split into " << aInput->GetGridNRow()
+       << " x " << aInput->GetGridNCol() << " tiles of size "
+       << aInput->GetTileNRow() << " x " << aInput->GetTileNCol()
+       << std::endl;
+    Rcpp::Rcout << ss.str();
+}
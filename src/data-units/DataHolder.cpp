@@ -8,6 +8,7 @@
 
 #include <data-units/DataHolder.hpp>
 #include <utilities/MPCRDispatcher.hpp>
+#include <cstring>
 
 
 #ifdef USE_CUDA
@@ -248,6 +249,32 @@ DataHolder::Sync(const OperationPlacement &aPlacement) {
 }
 
 
+void
+DataHolder::ResizeHostBuffer(const size_t &aSizeInBytes) {
+
+    if (mBufferState == BufferState::EMPTY) {
+        return;
+    }
+
+    auto context = ContextManager::GetOperationContext();
+    this->GetDataPointer(CPU);
+
+    if (this->mpDeviceData != nullptr) {
+        auto gpu_context = context;
+        if (gpu_context->GetOperationPlacement() != GPU) {
+            gpu_context = ContextManager::GetGPUContext();
+        }
+        memory::DestroyArray(this->mpDeviceData, GPU, gpu_context);
+    }
+
+    memory::ReallocateArray(this->mpHostData, this->mSize, aSizeInBytes, CPU,
+                            context);
+
+    this->mSize = aSizeInBytes;
+    this->mBufferState = BufferState::NO_DEVICE;
+}
+
+
 void
 DataHolder::ClearUp() {
 
@@ -266,6 +293,25 @@ DataHolder::ClearUp() {
 }
 
 
+char *
+DataHolder::ReleaseDataPointer(const OperationPlacement &aPlacement) {
+
+    auto pData = this->GetDataPointer(aPlacement);
+    if (pData == nullptr) {
+        return nullptr;
+    }
+
+    if (aPlacement == CPU) {
+        this->mpHostData = nullptr;
+    } else {
+        this->mpDeviceData = nullptr;
+    }
+
+    this->ClearUp();
+    return pData;
+}
+
+
 void
 DataHolder::SetDataPointer(char *apHostPointer, char *apDevicePointer,
                            const size_t &aSizeInBytes) {
@@ -355,11 +401,51 @@ template <typename T, typename X>
 void
 DataHolder::PromoteOnHost() {
     auto size = this->mSize / sizeof(T);
-    auto pData = (T *) this->mpHostData;
-    auto pData_new = (X *) memory::AllocateArray(sizeof(X) * size, CPU,
-                                                 ContextManager::GetOperationContext());
-    std::copy(pData, pData + size, pData_new);
-    this->SetDataPointer((char *) pData_new, size * sizeof(X), CPU);
+    auto context = ContextManager::GetOperationContext();
+    auto size_new = size * sizeof(X);
+
+    /* The device copy is stale after the conversion, same as SetDataPointer
+     * would do when replacing the host buffer. */
+    if (this->mpDeviceData != nullptr) {
+        auto gpu_context = context;
+        if (gpu_context->GetOperationPlacement() != GPU) {
+            gpu_context = ContextManager::GetGPUContext();
+        }
+        memory::DestroyArray(this->mpDeviceData, GPU, gpu_context);
+    }
+
+    /* Elements are converted one at a time through temporaries, since the
+     * source and destination types share the same bytes. */
+    T value;
+    X value_new;
+
+    if (sizeof(X) <= sizeof(T)) {
+        /* Narrowing: element i is written at offset i*sizeof(X), which never
+         * passes the unread part of the buffer, so a forward sweep is safe.
+         * The tail is released afterwards. */
+        for (size_t i = 0; i < size; i++) {
+            memcpy(&value, this->mpHostData + i * sizeof(T), sizeof(T));
+            value_new = (X) value;
+            memcpy(this->mpHostData + i * sizeof(X), &value_new, sizeof(X));
+        }
+        memory::ReallocateArray(this->mpHostData, this->mSize, size_new, CPU,
+                                context);
+    } else {
+        /* Widening: grow the buffer first, then sweep backwards so every
+         * element is read before its bytes get overwritten. */
+        memory::ReallocateArray(this->mpHostData, this->mSize, size_new, CPU,
+                                context);
+        for (size_t i = size; i > 0; i--) {
+            memcpy(&value, this->mpHostData + ( i - 1 ) * sizeof(T),
+                   sizeof(T));
+            value_new = (X) value;
+            memcpy(this->mpHostData + ( i - 1 ) * sizeof(X), &value_new,
+                   sizeof(X));
+        }
+    }
+
+    this->mSize = size_new;
+    this->mBufferState = BufferState::NO_DEVICE;
 }
 
 
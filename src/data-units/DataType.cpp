@@ -8,11 +8,32 @@
 
 #include <data-units/DataType.hpp>
 #include <adapters/RBinaryOperations.hpp>
+#include <operations/LinearAlgebra.hpp>
 
 
 using namespace mpcr::precision;
 
 
+/**
+ * @brief
+ * Structural properties of the transpose of a Matrix, the upper and lower
+ * triangular flags are swapped.
+ *
+ */
+int
+TransposeProperties(const int &aProperties) {
+    auto triangles = MATRIX_UPPER_TRIANGULAR | MATRIX_LOWER_TRIANGULAR;
+    auto properties = aProperties & ~triangles;
+    if (aProperties & MATRIX_UPPER_TRIANGULAR) {
+        properties |= MATRIX_LOWER_TRIANGULAR;
+    }
+    if (aProperties & MATRIX_LOWER_TRIANGULAR) {
+        properties |= MATRIX_UPPER_TRIANGULAR;
+    }
+    return properties;
+}
+
+
 /** ------------------------- Constructors ---------------------------------- **/
 
 void DataType::InitializeObject(size_t aSize, const Precision &aPrecision,
@@ -23,6 +44,10 @@ void DataType::InitializeObject(size_t aSize, const Precision &aPrecision,
     mData.ClearUp();
     this->mSize = aSize;
     this->mMatrix = false;
+    this->mTransposed = false;
+    this->mPacked = false;
+    this->mPackedUpper = false;
+    this->mPackedTriangular = false;
 }
 
 
@@ -128,6 +153,11 @@ DataType::DataType(const DataType &aDataType) {
     this->mSize = aDataType.mSize;
     this->mPrecision = aDataType.mPrecision;
     this->mMatrix = aDataType.mMatrix;
+    this->mTransposed = aDataType.mTransposed;
+    this->mPacked = aDataType.mPacked;
+    this->mPackedUpper = aDataType.mPackedUpper;
+    this->mPackedTriangular = aDataType.mPackedTriangular;
+    this->mProperties = aDataType.mProperties;
     this->mData = aDataType.mData;
 
     if (this->mMatrix) {
@@ -143,6 +173,11 @@ DataType::DataType(DataType &aDataType,
     this->mSize = aDataType.mSize;
     this->mPrecision = aPrecision;
     this->mMatrix = aDataType.mMatrix;
+    this->mTransposed = aDataType.mTransposed;
+    this->mPacked = aDataType.mPacked;
+    this->mPackedUpper = aDataType.mPackedUpper;
+    this->mPackedTriangular = aDataType.mPackedTriangular;
+    this->mProperties = aDataType.mProperties;
     this->mData = aDataType.mData;
     if (this->mMatrix) {
         this->mpDimensions = new Dimensions(*aDataType.GetDimensions());
@@ -194,10 +229,31 @@ DataType::GetPrecision() {
 char *
 DataType::GetData(const OperationPlacement &aOperationPlacement) {
     this->CheckHalfCompatibility(aOperationPlacement);
+    this->Unpack();
+    if (this->mTransposed) {
+        this->MaterializeTranspose();
+    }
     return mData.GetDataPointer(aOperationPlacement);
 }
 
 
+char *
+DataType::GetStoredData(const OperationPlacement &aOperationPlacement) {
+    this->CheckHalfCompatibility(aOperationPlacement);
+    this->Unpack();
+    return mData.GetDataPointer(aOperationPlacement);
+}
+
+
+char *
+DataType::ReleaseData(const OperationPlacement &aOperationPlacement) {
+    this->CheckHalfCompatibility(aOperationPlacement);
+    auto pData = mData.ReleaseDataPointer(aOperationPlacement);
+    this->ClearUp();
+    return pData;
+}
+
+
 void
 DataType::Allocate(std::vector <double> &aValues,
                    const OperationPlacement &aPlacement) {
@@ -256,6 +312,9 @@ DataType::SetPrecision(mpcr::definitions::Precision aPrecision,
 
 void
 DataType::ToMatrix(size_t aRow, size_t aCol) {
+    this->Unpack();
+    this->MaterializeTranspose();
+    this->ClearProperties();
     this->mpDimensions = new Dimensions(aRow, aCol);
     this->mSize = aRow * aCol;
     this->mMatrix = true;
@@ -270,6 +329,9 @@ DataType::IsMatrix() const {
 
 void
 DataType::ToVector() {
+    this->Unpack();
+    this->MaterializeTranspose();
+    this->ClearProperties();
     if (this->mpDimensions != nullptr) {
         delete this->mpDimensions;
         this->mpDimensions = nullptr;
@@ -298,6 +360,8 @@ DataType::SetData(char *aData, const OperationPlacement &aOperationPlacement) {
     if (this->mPrecision == HALF && aOperationPlacement == CPU) {
         MPCR_API_EXCEPTION("Cannot allocate 16-bit precision on CPU", -1);
     }
+    this->mTransposed = false;
+    this->ClearProperties();
     this->mData.SetDataPointer(aData, this->GetSizeInBytes(),
                                op_placement);
 }
@@ -336,6 +400,9 @@ DataType::GetNCol() const {
 void
 DataType::SetDimensions(size_t aRow, size_t aCol) {
 
+    this->Unpack();
+    this->MaterializeTranspose();
+    this->ClearProperties();
     size_t size = aRow * aCol;
     if (size != this->mSize) {
         MPCR_API_EXCEPTION("Segmentation Fault Matrix Out Of Bound", -1);
@@ -363,6 +430,11 @@ DataType::operator =(const DataType &aDataType) {
     this->mSize = aDataType.mSize;
     this->mPrecision = aDataType.mPrecision;
     this->mMatrix = aDataType.mMatrix;
+    this->mTransposed = aDataType.mTransposed;
+    this->mPacked = aDataType.mPacked;
+    this->mPackedUpper = aDataType.mPackedUpper;
+    this->mPackedTriangular = aDataType.mPackedTriangular;
+    this->mProperties = aDataType.mProperties;
     mData = aDataType.mData;
     if (this->mMatrix) {
         this->mpDimensions = new Dimensions(*aDataType.GetDimensions());
@@ -485,8 +557,119 @@ DataType::Transpose() {
     if (!this->mMatrix) {
         MPCR_API_EXCEPTION("Cannot Transpose a Vector", -1);
     }
+    /* The stored data is already the transpose of the reported matrix. */
+    if (this->mTransposed) {
+        this->LazyTranspose();
+        return;
+    }
+    /* A packed symmetric matrix is its own transpose. */
+    if (this->mPacked && !this->mPackedTriangular) {
+        return;
+    }
     this->CheckHalfCompatibility();
+    auto properties = this->mProperties;
     SIMPLE_DISPATCH(this->mPrecision, DataType::TransposeDispatcher)
+    this->mProperties = TransposeProperties(properties);
+}
+
+
+void
+DataType::Transpose(DataType &aOutput) {
+    if (!this->mMatrix) {
+        MPCR_API_EXCEPTION("Cannot Transpose a Vector", -1);
+    }
+    this->CheckHalfCompatibility();
+    aOutput.ConvertPrecision(this->mPrecision);
+    SIMPLE_DISPATCH(this->mPrecision, DataType::TransposeOutOfPlaceDispatcher,
+                    aOutput)
+}
+
+
+void
+DataType::LazyTranspose() {
+    if (!this->mMatrix) {
+        MPCR_API_EXCEPTION("Cannot Transpose a Vector", -1);
+    }
+    if (this->mPacked) {
+        if (!this->mPackedTriangular) {
+            return;
+        }
+        this->Unpack();
+    }
+    auto row = this->mpDimensions->GetNRow();
+    auto col = this->mpDimensions->GetNCol();
+    this->mpDimensions->SetNRow(col);
+    this->mpDimensions->SetNCol(row);
+    this->mTransposed = !this->mTransposed;
+    this->mProperties = TransposeProperties(this->mProperties);
+}
+
+
+void
+DataType::MaterializeTranspose() {
+    if (!this->mTransposed) {
+        return;
+    }
+    this->mTransposed = false;
+    this->CheckHalfCompatibility();
+    /* The reported matrix does not change, only its storage */
+    auto properties = this->mProperties;
+    SIMPLE_DISPATCH(this->mPrecision, DataType::MaterializeTransposeDispatcher)
+    this->mProperties = properties;
+}
+
+
+void
+DataType::ToPacked(const bool &aUpperTriangle, const bool &aTriangular) {
+    if (!this->mMatrix || this->GetNRow() != this->GetNCol()) {
+        MPCR_API_EXCEPTION("Only square matrices can be packed", -1);
+    }
+    if (this->mPacked) {
+        if (this->mPackedUpper == aUpperTriangle) {
+            this->mPackedTriangular = aTriangular;
+            return;
+        }
+        this->Unpack();
+    }
+    this->CheckHalfCompatibility();
+    this->MaterializeTranspose();
+    this->mPackedUpper = aUpperTriangle;
+    this->mPackedTriangular = aTriangular;
+    SIMPLE_DISPATCH(this->mPrecision, DataType::PackDispatcher)
+    this->mPacked = true;
+}
+
+
+void
+DataType::Unpack() {
+    if (!this->mPacked) {
+        return;
+    }
+    this->CheckHalfCompatibility();
+    SIMPLE_DISPATCH(this->mPrecision, DataType::UnpackDispatcher)
+    this->mPacked = false;
+}
+
+
+void
+DataType::SetPackedLayout(const bool &aUpperTriangle,
+                          const bool &aTriangular) {
+    if (!this->mMatrix || this->GetNRow() != this->GetNCol()) {
+        MPCR_API_EXCEPTION("Only square matrices can be packed", -1);
+    }
+    this->mPacked = true;
+    this->mPackedUpper = aUpperTriangle;
+    this->mPackedTriangular = aTriangular;
+}
+
+
+char *
+DataType::GetPackedData(const OperationPlacement &aOperationPlacement) {
+    if (!this->mPacked) {
+        MPCR_API_EXCEPTION("MPCR Matrix is not packed", -1);
+    }
+    this->CheckHalfCompatibility(aOperationPlacement);
+    return mData.GetDataPointer(aOperationPlacement);
 }
 
 
@@ -722,6 +905,10 @@ DataType::RDeSerialize(Rcpp::RawVector aInput) {
 size_t
 DataType::GetSizeInBytes() {
     size_t size = this->mSize;
+    if (this->mPacked) {
+        auto side_len = this->mpDimensions->GetNRow();
+        size = side_len * ( side_len + 1 ) / 2;
+    }
     switch (this->mPrecision) {
         case HALF:
             return size * sizeof(float16);
@@ -1084,47 +1271,10 @@ template <typename T>
 void
 DataType::DeterminantDispatcher(double &aResult) {
 
-    double det = 1.0;
-    auto data = (T *) this->GetData(CPU);
-    auto size = this->GetNCol();
-    std::vector <double> pData;
-
-    if (size == 2) {
-        aResult = data[ 0 ] * data[ 3 ] - data[ 1 ] * data[ 2 ];
-        return;
-    }
-
-    pData.resize(this->mSize);
-    std::copy(data, data + this->mSize, pData.begin());
-
-
-    for (int i = 0; i < size; i++) {
-        int max_row = i;
-        for (int j = i + 1; j < size; j++) {
-            if (std::abs(pData[ j * size + i ]) >
-                std::abs(pData[ max_row * size + i ])) {
-                max_row = j;
-            }
-        }
-        if (max_row != i) {
-            swap_ranges(pData.begin() + i * size,
-                        pData.begin() + ( i + 1 ) * size,
-                        pData.begin() + max_row * size);
-            det = -det;
-        }
-        det *= pData[ i * size + i ];
-        if (pData[ i * size + i ] == 0) {
-            aResult = 0;
-            return;
-        }
-        for (int j = i + 1; j < size; j++) {
-            double factor = pData[ j * size + i ] / pData[ i * size + i ];
-            for (int k = i + 1; k < size; k++) {
-                pData[ j * size + k ] -= factor * pData[ i * size + k ];
-            }
-        }
-    }
-    aResult = det;
+    double modulus = 0;
+    auto sign = 1;
+    mpcr::operations::linear::Determinant <T>(*this, modulus, sign, true);
+    aResult = sign * std::exp(modulus);
 }
 
 
@@ -1154,30 +1304,206 @@ void DataType::FillTriangleDispatcher(const double &aValue,
 }
 
 
+template <typename T>
+void
+TransposeSquareInPlace(T *apData, const size_t &aSideLength) {
+
+    /* Every off-diagonal block pair (i,j)/(j,i) is swapped by exactly one
+     * iteration, diagonal blocks are transposed around their own diagonal. */
+#pragma omp parallel for schedule(dynamic)
+    for (size_t j = 0; j < aSideLength; j += MPCR_CPU_BLOCK_SIZE) {
+        auto col_end = std::min(j + MPCR_CPU_BLOCK_SIZE, aSideLength);
+        for (auto i = j; i < aSideLength; i += MPCR_CPU_BLOCK_SIZE) {
+            auto row_end = std::min(i + MPCR_CPU_BLOCK_SIZE, aSideLength);
+            for (auto col_idx = j; col_idx < col_end; col_idx++) {
+                auto row_start = ( i == j ) ? col_idx + 1 : i;
+                for (auto row_idx = row_start; row_idx < row_end; row_idx++) {
+                    std::swap(apData[ col_idx * aSideLength + row_idx ],
+                              apData[ row_idx * aSideLength + col_idx ]);
+                }
+            }
+        }
+    }
+
+}
+
+
+template <typename T>
+void
+TransposeRectangularInPlace(T *apData, const size_t &aNumRow,
+                            const size_t &aNumCol) {
+
+    /* Element k of the column-major row x col matrix moves to
+     * (k * col) mod (size - 1). Permutation cycles are followed one by one,
+     * a bitmap of one bit per element marks the visited positions. */
+    auto size = aNumRow * aNumCol;
+    auto last = size - 1;
+    std::vector <bool> visited(size, false);
+
+    for (size_t start = 1; start < last; start++) {
+        if (visited[ start ]) {
+            continue;
+        }
+
+        auto current = start;
+        auto value = apData[ start ];
+        do {
+            auto next = ( current * aNumCol ) % last;
+            std::swap(apData[ next ], value);
+            visited[ next ] = true;
+            current = next;
+        } while (current != start);
+    }
+
+}
+
+
+template <typename T>
+void
+TransposeInPlace(T *apData, const size_t &aNumRow, const size_t &aNumCol) {
+
+    /* A single row or a single column has the same layout both ways. */
+    if (aNumRow < 2 || aNumCol < 2) {
+        return;
+    }
+
+    if (aNumRow == aNumCol) {
+        TransposeSquareInPlace <T>(apData, aNumRow);
+    } else {
+        TransposeRectangularInPlace <T>(apData, aNumRow, aNumCol);
+    }
+}
+
+
 template <typename T>
 void
 DataType::TransposeDispatcher() {
 
     auto pData = (T *) this->GetData(CPU);
-    auto pOutput = (T *) mpcr::memory::AllocateArray(this->GetSizeInBytes(),
-                                                     CPU,
-                                                     nullptr);
-    auto col = this->GetNCol();
-    auto row = this->GetNRow();
+    size_t col = this->GetNCol();
+    size_t row = this->GetNRow();
 
-    size_t counter = 0;
-    size_t idx;
+    TransposeInPlace <T>(pData, row, col);
 
-    for (auto i = 0; i < row; i++) {
-        for (auto j = 0; j < col; j++) {
-            idx = ( j * row ) + i;
-            pOutput[ counter ] = pData[ idx ];
-            counter++;
+    this->SetData((char *) pData, CPU);
+    this->SetDimensions(col, row);
+
+}
+
+
+template <typename T>
+void
+DataType::MaterializeTransposeDispatcher() {
+
+    /* Stored layout is col x row of the reported dimensions. */
+    auto pData = (T *) this->GetData(CPU);
+    TransposeInPlace <T>(pData, this->GetNCol(), this->GetNRow());
+    this->SetData((char *) pData, CPU);
+
+}
+
+
+template <typename T>
+void
+DataType::PackDispatcher() {
+
+    /* Packed index of (i,j) never exceeds its full index and grows with it,
+     * so a forward column sweep packs in place. */
+    auto pData = (T *) this->mData.GetDataPointer(CPU);
+    size_t side_len = this->GetNRow();
+    size_t idx = 0;
+
+    for (size_t j = 0; j < side_len; j++) {
+        auto start = this->mPackedUpper ? 0 : j;
+        auto end = this->mPackedUpper ? j + 1 : side_len;
+        for (auto i = start; i < end; i++) {
+            pData[ idx ] = pData[ i + ( j * side_len ) ];
+            idx++;
         }
     }
 
-    this->SetData((char *) pOutput, CPU);
-    this->SetDimensions(col, row);
+    this->mData.ResizeHostBuffer(idx * sizeof(T));
+
+}
+
+
+template <typename T>
+void
+DataType::UnpackDispatcher() {
+
+    size_t side_len = this->GetNRow();
+    this->mData.ResizeHostBuffer(side_len * side_len * sizeof(T));
+    auto pData = (T *) this->mData.GetDataPointer(CPU);
+    size_t idx = side_len * ( side_len + 1 ) / 2;
+
+    /* Backward sweep, each element is moved before its slot gets reused. */
+    for (size_t j = side_len; j > 0; j--) {
+        auto start = this->mPackedUpper ? 0 : j - 1;
+        auto end = this->mPackedUpper ? j : side_len;
+        for (auto i = end; i > start; i--) {
+            idx--;
+            pData[ ( i - 1 ) + (( j - 1 ) * side_len ) ] = pData[ idx ];
+        }
+    }
+
+#pragma omp parallel for schedule(static)
+    for (size_t j = 0; j < side_len; j++) {
+        auto start = this->mPackedUpper ? j + 1 : 0;
+        auto end = this->mPackedUpper ? side_len : j;
+        for (auto i = start; i < end; i++) {
+            pData[ i + ( j * side_len ) ] = this->mPackedTriangular ? 0 :
+                                            pData[ j + ( i * side_len ) ];
+        }
+    }
+
+}
+
+
+template <typename T>
+void
+DataType::TransposeOutOfPlaceDispatcher(DataType &aOutput) {
+
+    auto pData = (T *) this->GetStoredData(CPU);
+    size_t col = this->GetNCol();
+    size_t row = this->GetNRow();
+
+    auto pOutput = (T *) mpcr::memory::AllocateArray(this->GetSizeInBytes(),
+                                                     CPU, nullptr);
+
+    /* The stored data is already laid out as the requested output. */
+    if (this->mTransposed) {
+        mpcr::memory::MemCpy((char *) pOutput, (char *) pData,
+                             this->GetSizeInBytes(), nullptr,
+                             mpcr::memory::MemoryTransfer::HOST_TO_HOST);
+
+        aOutput.ClearUp();
+        aOutput.SetSize(this->mSize);
+        aOutput.SetDimensions(col, row);
+        aOutput.SetData((char *) pOutput, CPU);
+        return;
+    }
+
+    /* Each block reads MPCR_CPU_BLOCK_SIZE columns and writes
+     * MPCR_CPU_BLOCK_SIZE rows, keeping both sides cache-line friendly. */
+#pragma omp parallel for collapse(2) schedule(static)
+    for (size_t j = 0; j < col; j += MPCR_CPU_BLOCK_SIZE) {
+        for (size_t i = 0; i < row; i += MPCR_CPU_BLOCK_SIZE) {
+            auto col_end = std::min(j + MPCR_CPU_BLOCK_SIZE, col);
+            auto row_end = std::min(i + MPCR_CPU_BLOCK_SIZE, row);
+            for (auto col_idx = j; col_idx < col_end; col_idx++) {
+#pragma omp simd
+                for (auto row_idx = i; row_idx < row_end; row_idx++) {
+                    pOutput[ row_idx * col + col_idx ] = pData[ col_idx * row +
+                                                                row_idx ];
+                }
+            }
+        }
+    }
+
+    aOutput.ClearUp();
+    aOutput.SetSize(this->mSize);
+    aOutput.SetDimensions(col, row);
+    aOutput.SetData((char *) pOutput, CPU);
 
 }
 
@@ -1484,6 +1810,15 @@ SIMPLE_INSTANTIATE(void, DataType::ConvertToRMatrixDispatcher,
 
 SIMPLE_INSTANTIATE(void, DataType::TransposeDispatcher)
 
+SIMPLE_INSTANTIATE(void, DataType::TransposeOutOfPlaceDispatcher,
+                   DataType &aOutput)
+
+SIMPLE_INSTANTIATE(void, DataType::MaterializeTransposeDispatcher)
+
+SIMPLE_INSTANTIATE(void, DataType::PackDispatcher)
+
+SIMPLE_INSTANTIATE(void, DataType::UnpackDispatcher)
+
 SIMPLE_INSTANTIATE(void, DataType::PrintRowsDispatcher, const size_t &aRowIdx,
                    std::stringstream &aRowAsString)
 
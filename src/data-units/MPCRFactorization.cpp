@@ -0,0 +1,502 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <data-units/MPCRFactorization.hpp>
+#include <operations/concrete/BackendFactory.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+using namespace mpcr;
+using namespace mpcr::precision;
+using namespace mpcr::kernels;
+using namespace mpcr::operations;
+
+
+/** ------------------------- Constructors ---------------------------------- **/
+
+
+MPCRFactorization::MPCRFactorization(DataType &aInput,
+                                     const std::string &aType) {
+
+    auto type = aType;
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+
+    if (type == "lu") {
+        this->mType = FactorizationType::LU;
+    } else if (type == "chol" || type == "cholesky") {
+        this->mType = FactorizationType::CHOLESKY;
+    } else if (type == "qr") {
+        this->mType = FactorizationType::QR;
+    } else {
+        MPCR_API_EXCEPTION(
+            "Unknown factorization type, lu, chol or qr are supported", -1);
+    }
+
+    if (!aInput.IsMatrix() || aInput.GetSize() == 0) {
+        MPCR_API_EXCEPTION("Factorization can only be applied on an MPCR Matrix",
+                           -1);
+    }
+
+    auto row = aInput.GetNRow();
+    auto col = aInput.GetNCol();
+
+    if (this->mType == FactorizationType::QR) {
+        if (row < col) {
+            MPCR_API_EXCEPTION(
+                "QR factorization needs at least as many rows as cols", -1);
+        }
+    } else if (row != col) {
+        MPCR_API_EXCEPTION("Cannot factorize this matrix, must be a square "
+                           "matrix", -1);
+    }
+
+    this->mNormOne = 0;
+    this->mNormInf = 0;
+    this->mReflectors = 0;
+    this->mSingular = false;
+    this->mMagicNumber = 914;
+
+    SIMPLE_DISPATCH(aInput.GetPrecision(),
+                    MPCRFactorization::FactorizeDispatcher, aInput)
+}
+
+
+/** ---------------------------- Methods ------------------------------- **/
+
+
+FactorizationType
+MPCRFactorization::GetFactorizationType() const {
+    return this->mType;
+}
+
+
+size_t
+MPCRFactorization::GetNRow() const {
+    return this->mFactor.GetNRow();
+}
+
+
+size_t
+MPCRFactorization::GetNCol() const {
+    return this->mFactor.GetNCol();
+}
+
+
+Precision
+MPCRFactorization::GetPrecision() {
+    return this->mFactor.GetPrecision();
+}
+
+
+bool
+MPCRFactorization::IsSingular() const {
+    return this->mSingular;
+}
+
+
+void
+MPCRFactorization::Solve(DataType &aInputB, DataType &aOutput) {
+
+    this->CheckSingular();
+
+    auto flag_to_matrix = false;
+    if (!aInputB.IsMatrix()) {
+        flag_to_matrix = true;
+        aInputB.SetDimensions(aInputB.GetNCol(), 1);
+    }
+
+    auto rows_b = aInputB.GetNRow();
+
+    if (rows_b != this->GetNRow()) {
+        if (flag_to_matrix) {
+            aInputB.ToVector();
+        }
+        MPCR_API_EXCEPTION("Dimensions must be compatible", -1);
+    }
+
+    auto precision = this->GetPrecision();
+    aOutput.ClearUp();
+
+    if (aInputB.GetPrecision() != precision) {
+        DataType temp(aInputB, precision);
+        aOutput = temp;
+    } else {
+        aOutput = aInputB;
+    }
+
+    if (flag_to_matrix) {
+        aInputB.ToVector();
+    }
+
+    SIMPLE_DISPATCH(precision, MPCRFactorization::SolveDispatcher, aOutput)
+}
+
+
+void
+MPCRFactorization::Inverse(DataType &aOutput) {
+    this->CheckSquare();
+    this->CheckSingular();
+    SIMPLE_DISPATCH(this->GetPrecision(), MPCRFactorization::InverseDispatcher,
+                    aOutput)
+}
+
+
+void
+MPCRFactorization::Determinant(double &aModulus, int &aSign,
+                               const bool &aLogarithm) {
+    this->CheckSquare();
+    aSign = 1;
+
+    if (this->mSingular) {
+        aModulus = aLogarithm ? -std::numeric_limits <double>::infinity() : 0;
+        return;
+    }
+
+    double log_modulus = 0;
+    SIMPLE_DISPATCH(this->GetPrecision(),
+                    MPCRFactorization::DeterminantDispatcher, log_modulus,
+                    aSign)
+
+    aModulus = aLogarithm ? log_modulus : std::exp(log_modulus);
+}
+
+
+double
+MPCRFactorization::ReciprocalCondition(const std::string &aNorm) {
+    this->CheckSquare();
+
+    if (this->mSingular) {
+        return 0;
+    }
+
+    double rcond = 0;
+    SIMPLE_DISPATCH(this->GetPrecision(),
+                    MPCRFactorization::ReciprocalConditionDispatcher, aNorm,
+                    rcond)
+    return rcond;
+}
+
+
+void
+MPCRFactorization::Print() {
+    std::stringstream ss;
+    std::string type;
+
+    if (this->mType == FactorizationType::LU) {
+        type = "LU";
+    } else if (this->mType == FactorizationType::CHOLESKY) {
+        type = "Cholesky";
+    } else {
+        type = "QR";
+    }
+
+    ss << "MPCR " << type << " Factorization" << std::endl;
+    ss << "Number of Rows : " << this->GetNRow() << std::endl;
+    ss << "Number of Columns : " << this->GetNCol() << std::endl;
+    ss << "Precision : " << GetPrecisionAsString(this->GetPrecision())
+       << std::endl;
+    if (this->mSingular) {
+        ss << "The matrix is singular" << std::endl;
+    }
+
+    MPCR_PRINTER(std::string(ss.str()))
+}
+
+
+template <typename T>
+void
+MPCRFactorization::FactorizeDispatcher(DataType &aInput) {
+
+    auto row = aInput.GetNRow();
+    auto col = aInput.GetNCol();
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto helper = BackendFactory <T>::CreateHelpersBackend(CPU);
+
+    /** Norms of A are kept for the condition number estimates **/
+    T norm_one = 0;
+    T norm_inf = 0;
+    helper->NormMACS(aInput, norm_one, nullptr);
+    helper->NormMARS(aInput, norm_inf, nullptr);
+    this->mNormOne = norm_one;
+    this->mNormInf = norm_inf;
+
+    this->mFactor = aInput;
+    auto pFactor = (T *) this->mFactor.GetData(CPU);
+    auto rc = 0;
+
+    if (this->mType == FactorizationType::LU) {
+        this->mPivots.resize(row);
+        rc = solver->Getrf(row, col, pFactor, row, this->mPivots.data());
+
+        if (rc < 0) {
+            MPCR_API_EXCEPTION("Error While Performing LU Decomposition", rc);
+        }
+        /** Exactly zero pivot, the factors are kept for the determinant **/
+        this->mSingular = ( rc > 0 );
+
+    } else if (this->mType == FactorizationType::CHOLESKY) {
+        rc = solver->Potrf(true, row, pFactor, row);
+
+        if (rc != 0) {
+            MPCR_API_EXCEPTION("Error While Applying Cholesky Decomposition",
+                               rc);
+        }
+
+    } else {
+        std::vector <T> tau(col);
+        this->mPivots.assign(col, 0);
+
+        rc = solver->Geqp3(row, col, pFactor, row, this->mPivots.data(),
+                           tau.data());
+        if (rc != 0) {
+            MPCR_API_EXCEPTION("Error While Performing QR Decomposition", rc);
+        }
+
+        for (auto i = 0; i < col; i++) {
+            if (tau[ i ] != 0) {
+                this->mReflectors++;
+            }
+            if (pFactor[ i + ( i * row ) ] == 0) {
+                this->mSingular = true;
+            }
+        }
+
+        /** Q is formed once, so each solve is a Gemm and a Trsm **/
+        this->mQ = this->mFactor;
+        auto pQ = (T *) this->mQ.GetData(CPU);
+        rc = solver->Orgqr(row, col, col, pQ, row, tau.data());
+
+        if (rc != 0) {
+            MPCR_API_EXCEPTION("Error While Performing QR Decomposition", rc);
+        }
+        this->mQ.SetData((char *) pQ, CPU);
+    }
+
+    this->mFactor.SetData((char *) pFactor, CPU);
+}
+
+
+template <typename T>
+void
+MPCRFactorization::SolveDispatcher(DataType &aOutput) {
+
+    auto row = this->GetNRow();
+    auto col = this->GetNCol();
+    auto nrhs = aOutput.GetNCol();
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto pFactor = (T *) this->mFactor.GetData(CPU);
+    auto pData_in_out = (T *) aOutput.GetData(CPU);
+
+    if (this->mType == FactorizationType::LU) {
+        auto rc = solver->Getrs(false, col, nrhs, pFactor, row,
+                                this->mPivots.data(), pData_in_out, row);
+        if (rc != 0) {
+            MPCR_API_EXCEPTION("Error While Solving", rc);
+        }
+        aOutput.SetData((char *) pData_in_out, CPU);
+
+    } else if (this->mType == FactorizationType::CHOLESKY) {
+        /** t(R) R X = B **/
+        solver->Trsm(true, true, true, col, nrhs, 1, pFactor, row,
+                     pData_in_out, row);
+        solver->Trsm(true, true, false, col, nrhs, 1, pFactor, row,
+                     pData_in_out, row);
+        aOutput.SetData((char *) pData_in_out, CPU);
+
+    } else {
+        /** X = P R^-1 t(Q) B **/
+        auto pQ = (T *) this->mQ.GetData(CPU);
+        auto pTemp = (T *) memory::AllocateArray(col * nrhs * sizeof(T), CPU,
+                                                 nullptr);
+        solver->Gemm(true, false, col, nrhs, row, 1, pQ, row, pData_in_out,
+                     row, 0, pTemp, col);
+        solver->Trsm(true, true, false, col, nrhs, 1, pFactor, row, pTemp,
+                     col);
+
+        auto pOutput = (T *) memory::AllocateArray(col * nrhs * sizeof(T),
+                                                   CPU, nullptr);
+        for (auto j = 0; j < nrhs; j++) {
+            for (auto i = 0; i < col; i++) {
+                pOutput[ this->mPivots[ i ] - 1 + ( j * col ) ] =
+                    pTemp[ i + ( j * col ) ];
+            }
+        }
+        memory::DestroyArray((char *&) pTemp, CPU, nullptr);
+
+        aOutput.SetSize(col * nrhs);
+        aOutput.SetData((char *) pOutput, CPU);
+    }
+
+    aOutput.SetDimensions(col, nrhs);
+}
+
+
+template <typename T>
+void
+MPCRFactorization::InverseDispatcher(DataType &aOutput) {
+
+    auto side_len = this->GetNCol();
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto helper = BackendFactory <T>::CreateHelpersBackend(CPU);
+
+    if (this->mType == FactorizationType::QR) {
+        auto pIdentity = (T *) memory::AllocateArray(
+            side_len * side_len * sizeof(T), CPU, nullptr);
+        helper->CreateIdentityMatrix(pIdentity, side_len, nullptr);
+
+        aOutput.ClearUp();
+        aOutput.ConvertPrecision(this->GetPrecision());
+        aOutput.SetSize(side_len * side_len);
+        aOutput.SetDimensions(side_len, side_len);
+        aOutput.SetData((char *) pIdentity, CPU);
+        this->SolveDispatcher <T>(aOutput);
+        return;
+    }
+
+    aOutput = this->mFactor;
+    auto pData_in_out = (T *) aOutput.GetData(CPU);
+    auto rc = 0;
+
+    if (this->mType == FactorizationType::LU) {
+        rc = solver->Getri(side_len, pData_in_out, side_len,
+                           this->mPivots.data());
+    } else {
+        rc = solver->Potri(true, side_len, pData_in_out, side_len);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Computing Inverse", rc);
+    }
+
+    aOutput.SetData((char *) pData_in_out, CPU);
+
+    if (this->mType == FactorizationType::CHOLESKY) {
+        helper->Symmetrize(aOutput, false, nullptr);
+    }
+}
+
+
+template <typename T>
+void
+MPCRFactorization::DeterminantDispatcher(double &aModulus, int &aSign) {
+
+    auto side_len = this->GetNCol();
+    auto pFactor = (T *) this->mFactor.GetData(CPU);
+
+    /** Accumulate in log space to avoid overflow of the plain product **/
+    double log_modulus = 0;
+    size_t negative_count = 0;
+
+    for (auto i = 0; i < side_len; i++) {
+        auto val = (double) pFactor[ i + ( i * side_len ) ];
+        if (val < 0) {
+            negative_count++;
+        }
+        log_modulus += std::log(std::abs(val));
+    }
+
+    if (this->mType == FactorizationType::LU) {
+        for (auto i = 0; i < side_len; i++) {
+            if (this->mPivots[ i ] != i + 1) {
+                negative_count++;
+            }
+        }
+    } else if (this->mType == FactorizationType::CHOLESKY) {
+        /** det(A) = prod(diag(R)) ^ 2 **/
+        log_modulus *= 2;
+        negative_count = 0;
+    } else {
+        /** det(Q) = (-1) ^ reflectors, det(P) from the cycles of jpvt **/
+        negative_count += this->mReflectors;
+        std::vector <bool> visited(side_len, false);
+        for (auto i = 0; i < side_len; i++) {
+            if (visited[ i ]) {
+                continue;
+            }
+            size_t cycle_len = 0;
+            for (auto j = i; !visited[ j ]; j = this->mPivots[ j ] - 1) {
+                visited[ j ] = true;
+                cycle_len++;
+            }
+            negative_count += cycle_len - 1;
+        }
+    }
+
+    aSign = ( negative_count % 2 == 0 ) ? 1 : -1;
+    aModulus = log_modulus;
+}
+
+
+template <typename T>
+void
+MPCRFactorization::ReciprocalConditionDispatcher(const std::string &aNorm,
+                                                 double &aOutput) {
+
+    auto side_len = this->GetNCol();
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto pFactor = (T *) this->mFactor.GetData(CPU);
+    T rcond = 0;
+    auto rc = 0;
+
+    if (this->mType == FactorizationType::LU) {
+        T norm = aNorm == "I" ? this->mNormInf : this->mNormOne;
+        rc = solver->Gecon(aNorm, side_len, pFactor, side_len, norm, &rcond);
+    } else if (this->mType == FactorizationType::CHOLESKY) {
+        /** A is symmetric, both norms are the same **/
+        rc = solver->Pocon(true, side_len, pFactor, side_len,
+                           (T) this->mNormOne, &rcond);
+    } else {
+        rc = solver->Trcon(aNorm, true, false, side_len, pFactor, side_len,
+                           &rcond);
+    }
+
+    if (rc < 0) {
+        MPCR_API_EXCEPTION("Error While Performing rcond", rc);
+    }
+
+    aOutput = rcond;
+}
+
+
+void
+MPCRFactorization::CheckSquare() const {
+    if (this->GetNRow() != this->GetNCol()) {
+        MPCR_API_EXCEPTION("Operation is only defined for a square matrix",
+                           -1);
+    }
+}
+
+
+void
+MPCRFactorization::CheckSingular() const {
+    if (this->mSingular) {
+        MPCR_API_EXCEPTION("Matrix is singular, exactly zero pivot met while "
+                           "factorizing", -1);
+    }
+}
+
+
+SIMPLE_INSTANTIATE(void, MPCRFactorization::FactorizeDispatcher,
+                   DataType &aInput)
+
+SIMPLE_INSTANTIATE(void, MPCRFactorization::SolveDispatcher,
+                   DataType &aOutput)
+
+SIMPLE_INSTANTIATE(void, MPCRFactorization::InverseDispatcher,
+                   DataType &aOutput)
+
+SIMPLE_INSTANTIATE(void, MPCRFactorization::DeterminantDispatcher,
+                   double &aModulus, int &aSign)
+
+SIMPLE_INSTANTIATE(void, MPCRFactorization::ReciprocalConditionDispatcher,
+                   const std::string &aNorm, double &aOutput)
@@ -0,0 +1,333 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <data-units/MPCRTile.hpp>
+#include <cstring>
+#include <sstream>
+
+
+using namespace mpcr;
+using namespace mpcr::precision;
+using namespace mpcr::kernels;
+
+
+/** ------------------------- Constructors ---------------------------------- **/
+
+
+MPCRTile::MPCRTile(const size_t &aRow, const size_t &aCol,
+                   const size_t &aTileRow, const size_t &aTileCol,
+                   const Precision &aPrecision) {
+
+    if (aTileRow == 0 || aTileCol == 0 || aTileRow > aRow ||
+        aTileCol > aCol) {
+        MPCR_API_EXCEPTION("Tile dimensions must be in [1, matrix dimensions]",
+                           -1);
+    }
+
+    this->mRow = aRow;
+    this->mCol = aCol;
+    this->mTileRow = aTileRow;
+    this->mTileCol = aTileCol;
+    this->mGridRow = ( aRow + aTileRow - 1 ) / aTileRow;
+    this->mGridCol = ( aCol + aTileCol - 1 ) / aTileCol;
+    this->mMagicNumber = 913;
+
+    std::vector <Precision> precisions(this->mGridRow * this->mGridCol,
+                                       aPrecision);
+    this->InitializeTiles(precisions, nullptr);
+}
+
+
+MPCRTile::MPCRTile(const size_t &aRow, const size_t &aCol,
+                   const size_t &aTileRow, const size_t &aTileCol,
+                   const std::vector <double> &aValues,
+                   const std::vector <std::string> &aPrecisions) {
+
+    if (aTileRow == 0 || aTileCol == 0 || aTileRow > aRow ||
+        aTileCol > aCol) {
+        MPCR_API_EXCEPTION("Tile dimensions must be in [1, matrix dimensions]",
+                           -1);
+    }
+
+    if (aValues.size() != aRow * aCol) {
+        MPCR_API_EXCEPTION("Values size doesn't match the matrix dimensions",
+                           -1);
+    }
+
+    this->mRow = aRow;
+    this->mCol = aCol;
+    this->mTileRow = aTileRow;
+    this->mTileCol = aTileCol;
+    this->mGridRow = ( aRow + aTileRow - 1 ) / aTileRow;
+    this->mGridCol = ( aCol + aTileCol - 1 ) / aTileCol;
+    this->mMagicNumber = 913;
+
+    auto num_tiles = this->mGridRow * this->mGridCol;
+    if (aPrecisions.size() != 1 && aPrecisions.size() != num_tiles) {
+        MPCR_API_EXCEPTION(
+            "Precisions must be one value or one value per tile", -1);
+    }
+
+    std::vector <Precision> precisions(num_tiles);
+    for (auto i = 0; i < num_tiles; i++) {
+        precisions[ i ] = GetInputPrecision(
+            aPrecisions.size() == 1 ? aPrecisions[ 0 ] : aPrecisions[ i ]);
+    }
+
+    this->InitializeTiles(precisions, &aValues);
+}
+
+
+MPCRTile::MPCRTile(const MPCRTile &aTile) {
+    *this = aTile;
+}
+
+
+MPCRTile &
+MPCRTile::operator =(const MPCRTile &aTile) {
+    if (this == &aTile) {
+        return *this;
+    }
+    this->ClearUp();
+    this->mRow = aTile.mRow;
+    this->mCol = aTile.mCol;
+    this->mTileRow = aTile.mTileRow;
+    this->mTileCol = aTile.mTileCol;
+    this->mGridRow = aTile.mGridRow;
+    this->mGridCol = aTile.mGridCol;
+    this->mMagicNumber = 913;
+
+    this->mTiles.resize(aTile.mTiles.size());
+    for (auto i = 0; i < aTile.mTiles.size(); i++) {
+        this->mTiles[ i ] = new DataType(*aTile.mTiles[ i ]);
+    }
+    return *this;
+}
+
+
+MPCRTile::~MPCRTile() {
+    this->ClearUp();
+}
+
+
+/** ---------------------------- Methods ------------------------------- **/
+
+
+size_t
+MPCRTile::GetNRow() const {
+    return this->mRow;
+}
+
+
+size_t
+MPCRTile::GetNCol() const {
+    return this->mCol;
+}
+
+
+size_t
+MPCRTile::GetTileNRow() const {
+    return this->mTileRow;
+}
+
+
+size_t
+MPCRTile::GetTileNCol() const {
+    return this->mTileCol;
+}
+
+
+size_t
+MPCRTile::GetGridNRow() const {
+    return this->mGridRow;
+}
+
+
+size_t
+MPCRTile::GetGridNCol() const {
+    return this->mGridCol;
+}
+
+
+DataType *
+MPCRTile::GetTile(const size_t &aTileRowIdx, const size_t &aTileColIdx) {
+    this->CheckTileIndex(aTileRowIdx, aTileColIdx);
+    return this->mTiles[ aTileRowIdx + ( aTileColIdx * this->mGridRow ) ];
+}
+
+
+void
+MPCRTile::InsertTile(DataType &aTile, const size_t &aTileRowIdx,
+                     const size_t &aTileColIdx) {
+
+    auto pTile = this->GetTile(aTileRowIdx, aTileColIdx);
+
+    if (!aTile.IsMatrix() || aTile.GetNRow() != pTile->GetNRow() ||
+        aTile.GetNCol() != pTile->GetNCol()) {
+        MPCR_API_EXCEPTION("Tile dimensions don't match the replaced tile",
+                           -1);
+    }
+
+    *pTile = aTile;
+}
+
+
+void
+MPCRTile::ChangeTilePrecision(const size_t &aTileRowIdx,
+                              const size_t &aTileColIdx,
+                              const Precision &aPrecision) {
+    this->GetTile(aTileRowIdx, aTileColIdx)->ConvertPrecision(aPrecision);
+}
+
+
+double
+MPCRTile::GetVal(const size_t &aRow, const size_t &aCol) {
+    if (aRow >= this->mRow || aCol >= this->mCol) {
+        MPCR_API_EXCEPTION("Segmentation Fault Index Out Of Bound", -1);
+    }
+    auto pTile = this->GetTile(aRow / this->mTileRow, aCol / this->mTileCol);
+    return pTile->GetValMatrix(aRow % this->mTileRow, aCol % this->mTileCol);
+}
+
+
+void
+MPCRTile::SetVal(const size_t &aRow, const size_t &aCol, const double &aVal) {
+    if (aRow >= this->mRow || aCol >= this->mCol) {
+        MPCR_API_EXCEPTION("Segmentation Fault Index Out Of Bound", -1);
+    }
+    auto pTile = this->GetTile(aRow / this->mTileRow, aCol / this->mTileCol);
+    pTile->SetValMatrix(aRow % this->mTileRow, aCol % this->mTileCol, aVal);
+}
+
+
+void
+MPCRTile::GetMatrix(DataType &aOutput, const Precision &aPrecision) {
+    aOutput.ClearUp();
+    aOutput.ConvertPrecision(aPrecision);
+    SIMPLE_DISPATCH(aPrecision, MPCRTile::GetMatrixDispatcher, aOutput)
+}
+
+
+void
+MPCRTile::Print() {
+    std::stringstream ss;
+    auto print_rows = ( this->mRow > 100 ) ? 100 : this->mRow;
+
+    ss << "MPCR Tile Matrix" << std::endl;
+    ss << "Number of Rows : " << this->mRow << std::endl;
+    ss << "Number of Columns : " << this->mCol << std::endl;
+    ss << "Tile Size : " << this->mTileRow << " x " << this->mTileCol
+       << std::endl;
+    ss << "---------------------" << std::endl;
+
+    for (auto i = 0; i < print_rows; i++) {
+        ss << " [\t";
+        for (auto j = 0; j < this->mGridCol; j++) {
+            auto pTile = this->GetTile(i / this->mTileRow, j);
+            ss << pTile->PrintRow(i % this->mTileRow);
+        }
+        ss << std::setfill(' ') << std::setw(14) << "]" << std::endl;
+    }
+
+    if (print_rows != this->mRow) {
+        ss << "Note Only the first 100 rows are printed" << std::endl;
+    }
+
+    MPCR_PRINTER(std::string(ss.str()))
+}
+
+
+void
+MPCRTile::InitializeTiles(const std::vector <Precision> &aPrecisions,
+                          const std::vector <double> *apValues) {
+
+    this->mTiles.resize(this->mGridRow * this->mGridCol, nullptr);
+
+    for (auto j = 0; j < this->mGridCol; j++) {
+        auto col_offset = j * this->mTileCol;
+        auto tile_col = std::min(this->mTileCol, this->mCol - col_offset);
+
+        for (auto i = 0; i < this->mGridRow; i++) {
+            auto row_offset = i * this->mTileRow;
+            auto tile_row = std::min(this->mTileRow, this->mRow - row_offset);
+            auto idx = i + ( j * this->mGridRow );
+
+            std::vector <double> values(tile_row * tile_col, 0);
+            if (apValues != nullptr) {
+                for (auto col = 0; col < tile_col; col++) {
+                    auto pStart = apValues->data() + row_offset +
+                                  ( ( col_offset + col ) * this->mRow );
+                    std::copy(pStart, pStart + tile_row,
+                              values.begin() + ( col * tile_row ));
+                }
+            }
+
+            this->mTiles[ idx ] = new DataType(values, aPrecisions[ idx ]);
+            this->mTiles[ idx ]->ToMatrix(tile_row, tile_col);
+        }
+    }
+}
+
+
+template <typename T>
+void
+MPCRTile::GetMatrixDispatcher(DataType &aOutput) {
+
+    auto precision = aOutput.GetPrecision();
+    auto pOutput = (T *) memory::AllocateArray(
+        this->mRow * this->mCol * sizeof(T), CPU, nullptr);
+    auto num_tiles = this->mTiles.size();
+
+#pragma omp parallel for
+    for (auto idx = 0; idx < num_tiles; idx++) {
+        auto pTile = this->mTiles[ idx ];
+        auto row_offset = ( idx % this->mGridRow ) * this->mTileRow;
+        auto col_offset = ( idx / this->mGridRow ) * this->mTileCol;
+        auto tile_row = pTile->GetNRow();
+        auto tile_col = pTile->GetNCol();
+
+        DataType *pTemp = nullptr;
+        if (pTile->GetPrecision() != precision) {
+            pTemp = new DataType(*pTile, precision);
+            pTile = pTemp;
+        }
+
+        auto pData = (T *) pTile->GetData(CPU);
+        for (auto col = 0; col < tile_col; col++) {
+            memcpy(pOutput + row_offset + ( ( col_offset + col ) * this->mRow ),
+                   pData + ( col * tile_row ), tile_row * sizeof(T));
+        }
+        delete pTemp;
+    }
+
+    aOutput.SetSize(this->mRow * this->mCol);
+    aOutput.SetDimensions(this->mRow, this->mCol);
+    aOutput.SetData((char *) pOutput, CPU);
+}
+
+
+void
+MPCRTile::ClearUp() {
+    for (auto &pTile: this->mTiles) {
+        delete pTile;
+        pTile = nullptr;
+    }
+    this->mTiles.clear();
+}
+
+
+void
+MPCRTile::CheckTileIndex(const size_t &aTileRowIdx,
+                         const size_t &aTileColIdx) const {
+    if (aTileRowIdx >= this->mGridRow || aTileColIdx >= this->mGridCol) {
+        MPCR_API_EXCEPTION("Tile Index Out Of Bound", -1);
+    }
+}
+
+
+SIMPLE_INSTANTIATE(void, MPCRTile::GetMatrixDispatcher, DataType &aOutput)
@@ -0,0 +1,437 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <data-units/SparseDataType.hpp>
+#include <algorithm>
+#include <numeric>
+#include <iomanip>
+#include <sstream>
+
+
+using namespace mpcr;
+using namespace mpcr::precision;
+using namespace mpcr::kernels;
+
+
+/** ------------------------- Constructors ---------------------------------- **/
+
+
+SparseDataType::SparseDataType(const Precision &aPrecision,
+                               const SparseFormat &aFormat) {
+    if (aPrecision != FLOAT && aPrecision != DOUBLE) {
+        MPCR_API_EXCEPTION(
+            "Sparse matrices support single and double precision only", -1);
+    }
+    this->mPrecision = aPrecision;
+    this->mFormat = aFormat;
+    this->mNumRow = 0;
+    this->mNumCol = 0;
+    this->mNnz = 0;
+    this->mMagicNumber = 912;
+}
+
+
+SparseDataType::SparseDataType(const std::vector <size_t> &aRowIdx,
+                               const std::vector <size_t> &aColIdx,
+                               const std::vector <double> &aValues,
+                               const size_t &aNumRow, const size_t &aNumCol,
+                               const Precision &aPrecision,
+                               const SparseFormat &aFormat)
+    : SparseDataType(aPrecision, aFormat) {
+
+    if (aRowIdx.size() != aValues.size() || aColIdx.size() != aValues.size()) {
+        MPCR_API_EXCEPTION(
+            "Row indices, col indices and values must have the same length",
+            -1);
+    }
+
+    for (auto i = 0; i < aValues.size(); i++) {
+        if (aRowIdx[ i ] >= aNumRow || aColIdx[ i ] >= aNumCol) {
+            MPCR_API_EXCEPTION("Segmentation Fault Index Out Of Bound", -1);
+        }
+    }
+
+    this->mNumRow = aNumRow;
+    this->mNumCol = aNumCol;
+
+    SIMPLE_DISPATCH(this->mPrecision, SparseDataType::FromTripletsDispatcher,
+                    aRowIdx, aColIdx, aValues)
+}
+
+
+SparseDataType::SparseDataType(const SparseDataType &aSparseDataType) {
+    *this = aSparseDataType;
+}
+
+
+SparseDataType &
+SparseDataType::operator =(const SparseDataType &aSparseDataType) {
+    this->mValues = aSparseDataType.mValues;
+    this->mIndices = aSparseDataType.mIndices;
+    this->mPointers = aSparseDataType.mPointers;
+    this->mNumRow = aSparseDataType.mNumRow;
+    this->mNumCol = aSparseDataType.mNumCol;
+    this->mNnz = aSparseDataType.mNnz;
+    this->mPrecision = aSparseDataType.mPrecision;
+    this->mFormat = aSparseDataType.mFormat;
+    this->mMagicNumber = 912;
+    return *this;
+}
+
+
+/** ---------------------------- Methods ------------------------------- **/
+
+
+size_t
+SparseDataType::GetNRow() const {
+    return this->mNumRow;
+}
+
+
+size_t
+SparseDataType::GetNCol() const {
+    return this->mNumCol;
+}
+
+
+size_t
+SparseDataType::GetNnz() const {
+    return this->mNnz;
+}
+
+
+Precision &
+SparseDataType::GetPrecision() {
+    return this->mPrecision;
+}
+
+
+SparseFormat
+SparseDataType::GetFormat() const {
+    return this->mFormat;
+}
+
+
+char *
+SparseDataType::GetValues(const OperationPlacement &aOperationPlacement) {
+    return this->mValues.GetDataPointer(aOperationPlacement);
+}
+
+
+int64_t *
+SparseDataType::GetIndices(const OperationPlacement &aOperationPlacement) {
+    return (int64_t *) this->mIndices.GetDataPointer(aOperationPlacement);
+}
+
+
+int64_t *
+SparseDataType::GetPointers(const OperationPlacement &aOperationPlacement) {
+    return (int64_t *) this->mPointers.GetDataPointer(aOperationPlacement);
+}
+
+
+void
+SparseDataType::Transpose() {
+    std::swap(this->mNumRow, this->mNumCol);
+    this->mFormat = ( this->mFormat == SparseFormat::CSR ) ? SparseFormat::CSC
+                                                           : SparseFormat::CSR;
+}
+
+
+void
+SparseDataType::ConvertFormat(const SparseFormat &aFormat) {
+    if (this->mFormat == aFormat) {
+        return;
+    }
+    SIMPLE_DISPATCH(this->mPrecision, SparseDataType::ConvertFormatDispatcher)
+}
+
+
+void
+SparseDataType::ToDense(DataType &aOutput) {
+    SIMPLE_DISPATCH(this->mPrecision, SparseDataType::ToDenseDispatcher,
+                    aOutput)
+}
+
+
+double
+SparseDataType::GetVal(const size_t &aRow, const size_t &aCol) {
+    if (aRow >= this->mNumRow || aCol >= this->mNumCol) {
+        MPCR_API_EXCEPTION("Segmentation Fault Index Out Of Bound", -1);
+    }
+    double output = 0;
+    SIMPLE_DISPATCH(this->mPrecision, SparseDataType::GetValueDispatcher,
+                    aRow, aCol, output)
+    return output;
+}
+
+
+void
+SparseDataType::Print() {
+    SIMPLE_DISPATCH(this->mPrecision, SparseDataType::PrintDispatcher)
+}
+
+
+template <typename T>
+void
+SparseDataType::FromTripletsDispatcher(const std::vector <size_t> &aRowIdx,
+                                       const std::vector <size_t> &aColIdx,
+                                       const std::vector <double> &aValues) {
+
+    auto is_csr = this->mFormat == SparseFormat::CSR;
+    auto &outer_idx = is_csr ? aRowIdx : aColIdx;
+    auto &inner_idx = is_csr ? aColIdx : aRowIdx;
+    auto outer_size = this->GetOuterSize();
+    auto num_entries = aValues.size();
+
+    /* Sort the entries by (outer, inner) so duplicates end up adjacent. */
+    std::vector <size_t> order(num_entries);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [ & ](size_t aLhs, size_t aRhs) {
+        if (outer_idx[ aLhs ] != outer_idx[ aRhs ]) {
+            return outer_idx[ aLhs ] < outer_idx[ aRhs ];
+        }
+        return inner_idx[ aLhs ] < inner_idx[ aRhs ];
+    });
+
+    auto pPointers = (int64_t *) memory::AllocateArray(
+        ( outer_size + 1 ) * sizeof(int64_t), CPU, nullptr);
+    memory::Memset((char *) pPointers, 0, ( outer_size + 1 ) * sizeof(int64_t),
+                   CPU, nullptr);
+
+    std::vector <int64_t> indices;
+    std::vector <T> values;
+    indices.reserve(num_entries);
+    values.reserve(num_entries);
+
+    for (auto i = 0; i < num_entries; i++) {
+        auto idx = order[ i ];
+        if (!indices.empty() && i > 0 &&
+            outer_idx[ order[ i - 1 ] ] == outer_idx[ idx ] &&
+            indices.back() == inner_idx[ idx ]) {
+            values.back() += (T) aValues[ idx ];
+            continue;
+        }
+        indices.push_back(inner_idx[ idx ]);
+        values.push_back((T) aValues[ idx ]);
+        pPointers[ outer_idx[ idx ] + 1 ]++;
+    }
+
+    for (auto i = 0; i < outer_size; i++) {
+        pPointers[ i + 1 ] += pPointers[ i ];
+    }
+
+    this->mNnz = values.size();
+    this->mPointers.SetDataPointer((char *) pPointers,
+                                   ( outer_size + 1 ) * sizeof(int64_t), CPU);
+
+    if (this->mNnz == 0) {
+        this->mIndices.ClearUp();
+        this->mValues.ClearUp();
+        return;
+    }
+
+    auto pIndices = memory::AllocateArray(this->mNnz * sizeof(int64_t), CPU,
+                                          nullptr);
+    auto pValues = memory::AllocateArray(this->mNnz * sizeof(T), CPU,
+                                         nullptr);
+
+    memory::MemCpy(pIndices, (char *) indices.data(),
+                   this->mNnz * sizeof(int64_t), nullptr,
+                   memory::MemoryTransfer::HOST_TO_HOST);
+    memory::MemCpy(pValues, (char *) values.data(), this->mNnz * sizeof(T),
+                   nullptr, memory::MemoryTransfer::HOST_TO_HOST);
+
+    this->mIndices.SetDataPointer(pIndices, this->mNnz * sizeof(int64_t), CPU);
+    this->mValues.SetDataPointer(pValues, this->mNnz * sizeof(T), CPU);
+
+}
+
+
+template <typename T>
+void
+SparseDataType::ConvertFormatDispatcher() {
+
+    auto outer_size = this->GetOuterSize();
+    auto new_outer_size = ( this->mFormat == SparseFormat::CSR )
+                          ? this->mNumCol : this->mNumRow;
+
+    auto pNew_pointers = (int64_t *) memory::AllocateArray(
+        ( new_outer_size + 1 ) * sizeof(int64_t), CPU, nullptr);
+    memory::Memset((char *) pNew_pointers, 0,
+                   ( new_outer_size + 1 ) * sizeof(int64_t), CPU, nullptr);
+
+    if (this->mNnz == 0) {
+        this->mPointers.SetDataPointer((char *) pNew_pointers,
+                                       ( new_outer_size + 1 ) *
+                                       sizeof(int64_t), CPU);
+        this->mFormat = ( this->mFormat == SparseFormat::CSR )
+                        ? SparseFormat::CSC : SparseFormat::CSR;
+        return;
+    }
+
+    auto pPointers = this->GetPointers(CPU);
+    auto pIndices = this->GetIndices(CPU);
+    auto pValues = (T *) this->GetValues(CPU);
+
+    auto pNew_indices = (int64_t *) memory::AllocateArray(
+        this->mNnz * sizeof(int64_t), CPU, nullptr);
+    auto pNew_values = (T *) memory::AllocateArray(this->mNnz * sizeof(T), CPU,
+                                                   nullptr);
+
+    /* Counting sort on the inner index, scanning the outer dimension in
+     * order keeps the new inner indices sorted. */
+    for (auto i = 0; i < this->mNnz; i++) {
+        pNew_pointers[ pIndices[ i ] + 1 ]++;
+    }
+    for (auto i = 0; i < new_outer_size; i++) {
+        pNew_pointers[ i + 1 ] += pNew_pointers[ i ];
+    }
+
+    std::vector <int64_t> position(pNew_pointers,
+                                   pNew_pointers + new_outer_size);
+
+    for (auto i = 0; i < outer_size; i++) {
+        for (auto k = pPointers[ i ]; k < pPointers[ i + 1 ]; k++) {
+            auto dest = position[ pIndices[ k ]]++;
+            pNew_indices[ dest ] = i;
+            pNew_values[ dest ] = pValues[ k ];
+        }
+    }
+
+    this->mPointers.SetDataPointer((char *) pNew_pointers,
+                                   ( new_outer_size + 1 ) * sizeof(int64_t),
+                                   CPU);
+    this->mIndices.SetDataPointer((char *) pNew_indices,
+                                  this->mNnz * sizeof(int64_t), CPU);
+    this->mValues.SetDataPointer((char *) pNew_values, this->mNnz * sizeof(T),
+                                 CPU);
+
+    this->mFormat = ( this->mFormat == SparseFormat::CSR ) ? SparseFormat::CSC
+                                                           : SparseFormat::CSR;
+}
+
+
+template <typename T>
+void
+SparseDataType::ToDenseDispatcher(DataType &aOutput) {
+
+    auto rows = this->mNumRow;
+    auto cols = this->mNumCol;
+    auto outer_size = this->GetOuterSize();
+    auto is_csr = this->mFormat == SparseFormat::CSR;
+
+    auto pOutput = (T *) memory::AllocateArray(rows * cols * sizeof(T), CPU,
+                                               nullptr);
+    memory::Memset((char *) pOutput, 0, rows * cols * sizeof(T), CPU, nullptr);
+
+    if (this->mNnz > 0) {
+        auto pPointers = this->GetPointers(CPU);
+        auto pIndices = this->GetIndices(CPU);
+        auto pValues = (T *) this->GetValues(CPU);
+
+#pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < outer_size; i++) {
+            for (auto k = pPointers[ i ]; k < pPointers[ i + 1 ]; k++) {
+                auto idx = is_csr ? i + ( pIndices[ k ] * rows )
+                                  : pIndices[ k ] + ( i * rows );
+                pOutput[ idx ] = pValues[ k ];
+            }
+        }
+    }
+
+    aOutput.ClearUp();
+    aOutput.ConvertPrecision(this->mPrecision);
+    aOutput.SetSize(rows * cols);
+    aOutput.SetDimensions(rows, cols);
+    aOutput.SetData((char *) pOutput, CPU);
+
+}
+
+
+template <typename T>
+void
+SparseDataType::GetValueDispatcher(const size_t &aRow, const size_t &aCol,
+                                   double &aOutput) {
+
+    aOutput = 0;
+    if (this->mNnz == 0) {
+        return;
+    }
+
+    auto is_csr = this->mFormat == SparseFormat::CSR;
+    auto outer = is_csr ? aRow : aCol;
+    int64_t inner = is_csr ? aCol : aRow;
+
+    auto pPointers = this->GetPointers(CPU);
+    auto pIndices = this->GetIndices(CPU);
+    auto pValues = (T *) this->GetValues(CPU);
+
+    auto pStart = pIndices + pPointers[ outer ];
+    auto pEnd = pIndices + pPointers[ outer + 1 ];
+    auto pFound = std::lower_bound(pStart, pEnd, inner);
+
+    if (pFound != pEnd && *pFound == inner) {
+        aOutput = pValues[ pFound - pIndices ];
+    }
+}
+
+
+template <typename T>
+void
+SparseDataType::PrintDispatcher() {
+
+    std::stringstream ss;
+    auto is_csr = this->mFormat == SparseFormat::CSR;
+
+    ss << "Precision  : " << GetPrecisionAsString(this->mPrecision)
+       << "  Precision " << std::endl;
+    ss << "Format : " << ( is_csr ? "CSR" : "CSC" ) << std::endl;
+    ss << "Number of Rows : " << this->mNumRow << std::endl;
+    ss << "Number of Columns : " << this->mNumCol << std::endl;
+    ss << "Number of Non-Zeros : " << this->mNnz << std::endl;
+    ss << "---------------------" << std::endl;
+
+    if (this->mNnz > 0) {
+        auto pPointers = this->GetPointers(CPU);
+        auto pIndices = this->GetIndices(CPU);
+        auto pValues = (T *) this->GetValues(CPU);
+        size_t print_count = 0;
+
+        for (auto i = 0; i < this->GetOuterSize() && print_count < 100; i++) {
+            for (auto k = pPointers[ i ];
+                 k < pPointers[ i + 1 ] && print_count < 100; k++) {
+                auto row = is_csr ? i : pIndices[ k ];
+                auto col = is_csr ? pIndices[ k ] : i;
+                ss << " [" << row + 1 << ", " << col + 1 << "]\t"
+                   << std::setprecision(7) << pValues[ k ] << std::endl;
+                print_count++;
+            }
+        }
+        if (print_count != this->mNnz) {
+            ss << "Note Only Matrix with size 100 is printed" << std::endl;
+        }
+    }
+
+    MPCR_PRINTER(ss.str())
+}
+
+
+SIMPLE_INSTANTIATE(void, SparseDataType::FromTripletsDispatcher,
+                   const std::vector <size_t> &aRowIdx,
+                   const std::vector <size_t> &aColIdx,
+                   const std::vector <double> &aValues)
+
+SIMPLE_INSTANTIATE(void, SparseDataType::ConvertFormatDispatcher)
+
+SIMPLE_INSTANTIATE(void, SparseDataType::ToDenseDispatcher, DataType &aOutput)
+
+SIMPLE_INSTANTIATE(void, SparseDataType::GetValueDispatcher,
+                   const size_t &aRow, const size_t &aCol, double &aOutput)
+
+SIMPLE_INSTANTIATE(void, SparseDataType::PrintDispatcher)
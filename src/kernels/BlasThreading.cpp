@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <kernels/BlasThreading.hpp>
+#include <cstdint>
+
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+
+using namespace mpcr::kernels;
+
+
+/**
+ * @brief
+ * Look up a symbol of the loaded BLAS library, the package doesn't know at
+ * build time which implementation it runs against.
+ *
+ */
+template <typename FUNCTION>
+FUNCTION
+GetBlasSymbol(const char *apName) {
+#ifndef _WIN32
+    return (FUNCTION) dlsym(RTLD_DEFAULT, apName);
+#else
+    return nullptr;
+#endif
+}
+
+
+typedef int (*GetThreadsFunction)();
+typedef void (*SetThreadsFunction)(int);
+typedef int64_t (*GetBlisThreadsFunction)();
+typedef void (*SetBlisThreadsFunction)(int64_t);
+
+
+int
+mpcr::kernels::GetMaxThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+
+SequentialBlasScope::SequentialBlasScope() {
+    this->mMaxActiveLevels = 0;
+    this->mOpenBlasThreads = -1;
+    this->mMklThreads = -1;
+    this->mBlisThreads = -1;
+
+#ifdef _OPENMP
+    this->mMaxActiveLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(1);
+#endif
+
+    auto openblas_get = GetBlasSymbol <GetThreadsFunction>(
+        "openblas_get_num_threads");
+    auto openblas_set = GetBlasSymbol <SetThreadsFunction>(
+        "openblas_set_num_threads");
+    if (openblas_get != nullptr && openblas_set != nullptr) {
+        this->mOpenBlasThreads = openblas_get();
+        openblas_set(1);
+    }
+
+    auto mkl_get = GetBlasSymbol <GetThreadsFunction>("MKL_Get_Max_Threads");
+    auto mkl_set = GetBlasSymbol <SetThreadsFunction>("MKL_Set_Num_Threads");
+    if (mkl_get != nullptr && mkl_set != nullptr) {
+        this->mMklThreads = mkl_get();
+        mkl_set(1);
+    }
+
+    auto blis_get = GetBlasSymbol <GetBlisThreadsFunction>(
+        "bli_thread_get_num_threads");
+    auto blis_set = GetBlasSymbol <SetBlisThreadsFunction>(
+        "bli_thread_set_num_threads");
+    if (blis_get != nullptr && blis_set != nullptr) {
+        /* Negative when BLIS threading is left unset, BLIS is then
+         * single threaded already */
+        this->mBlisThreads = (int) blis_get();
+        if (this->mBlisThreads > 0) {
+            blis_set(1);
+        }
+    }
+}
+
+
+SequentialBlasScope::~SequentialBlasScope() {
+#ifdef _OPENMP
+    omp_set_max_active_levels(this->mMaxActiveLevels);
+#endif
+
+    if (this->mOpenBlasThreads > 0) {
+        GetBlasSymbol <SetThreadsFunction>("openblas_set_num_threads")(
+            this->mOpenBlasThreads);
+    }
+    if (this->mMklThreads > 0) {
+        GetBlasSymbol <SetThreadsFunction>("MKL_Set_Num_Threads")(
+            this->mMklThreads);
+    }
+    if (this->mBlisThreads > 0) {
+        GetBlasSymbol <SetBlisThreadsFunction>("bli_thread_set_num_threads")(
+            this->mBlisThreads);
+    }
+}
@@ -9,6 +9,8 @@
 
 #include <kernels/MemoryHandler.hpp>
 #include <utilities/MPCRDispatcher.hpp>
+#include <cstdlib>
+#include <algorithm>
 
 #ifdef USE_CUDA
 #include <kernels/cuda/CudaMemoryKernels.hpp>
@@ -36,13 +38,55 @@ memory::AllocateArray(const size_t &aSizeInBytes,
     }
 #endif
     if (aPlacement == definitions::CPU) {
-        pdata = new char[aSizeInBytes];
+        pdata = (char *) std::malloc(aSizeInBytes);
+        if (pdata == nullptr) {
+            MPCR_API_EXCEPTION("Failed to allocate host memory", -1);
+        }
     }
 
     return pdata;
 }
 
 
+void
+memory::ReallocateArray(char *&apArray, const size_t &aOldSizeInBytes,
+                        const size_t &aNewSizeInBytes,
+                        const OperationPlacement &aPlacement,
+                        const kernels::RunContext *aContext) {
+
+    if (aNewSizeInBytes == 0) {
+        memory::DestroyArray(apArray, aPlacement, aContext);
+        return;
+    }
+
+    if (apArray == nullptr) {
+        apArray = memory::AllocateArray(aNewSizeInBytes, aPlacement, aContext);
+        return;
+    }
+
+    if (aPlacement == definitions::CPU) {
+        auto pdata = (char *) std::realloc(apArray, aNewSizeInBytes);
+        if (pdata == nullptr) {
+            MPCR_API_EXCEPTION("Failed to reallocate host memory", -1);
+        }
+        apArray = pdata;
+        return;
+    }
+
+#ifdef USE_CUDA
+    auto pdata = memory::AllocateArray(aNewSizeInBytes, aPlacement, aContext);
+    memory::MemCpy(pdata, apArray, std::min(aOldSizeInBytes, aNewSizeInBytes),
+                   aContext, MemoryTransfer::DEVICE_TO_DEVICE);
+    memory::DestroyArray(apArray, aPlacement, aContext);
+    apArray = pdata;
+#else
+    MPCR_API_EXCEPTION(
+        "Package is compiled with no GPU support, check Operation Placement",
+        -1);
+#endif
+}
+
+
 void
 memory::DestroyArray(char *&apArray, const OperationPlacement &aPlacement,
                      const kernels::RunContext *aContext) {
@@ -54,7 +98,7 @@ memory::DestroyArray(char *&apArray, const OperationPlacement &aPlacement,
         }
 #endif
         if (aPlacement == definitions::CPU) {
-            delete[]apArray;
+            std::free(apArray);
         }
     }
     apArray = nullptr;
@@ -62,6 +106,38 @@ memory::DestroyArray(char *&apArray, const OperationPlacement &aPlacement,
 }
 
 
+char *
+memory::RequestScratchArray(const size_t &aSizeInBytes,
+                            const OperationPlacement &aPlacement,
+                            const kernels::RunContext *aContext,
+                            const size_t &aSlot) {
+
+    if (aPlacement == definitions::CPU && aContext != nullptr) {
+        auto pScratch = (char *) aContext->RequestScratchBufferHost(
+            aSizeInBytes, aSlot);
+        if (pScratch != nullptr || aSizeInBytes == 0) {
+            return pScratch;
+        }
+        /* Above the scratch limit, the array is a plain allocation */
+    }
+    return AllocateArray(aSizeInBytes, aPlacement, aContext);
+}
+
+
+void
+memory::ReleaseScratchArray(char *&apArray,
+                            const OperationPlacement &aPlacement,
+                            const kernels::RunContext *aContext) {
+
+    if (aPlacement == definitions::CPU && aContext != nullptr &&
+        aContext->IsScratchBufferHost(apArray)) {
+        apArray = nullptr;
+        return;
+    }
+    DestroyArray(apArray, aPlacement, aContext);
+}
+
+
 void
 memory::MemCpy(char *apDestination, const char *apSrcDataArray,
                const size_t &aSizeInBytes, const kernels::RunContext *aContext,
@@ -8,11 +8,15 @@
 
 
 #include <kernels/RunContext.hpp>
+#include <kernels/MemoryHandler.hpp>
 
 
 using namespace mpcr::kernels;
 using namespace mpcr;
 
+/** Largest host scratch request kept by the arena, 64 MiB **/
+#define MPCR_SCRATCH_HOST_LIMIT ( (size_t) 64 << 20 )
+
 
 RunContext::RunContext(
     const definitions::OperationPlacement &aOperationPlacement,
@@ -79,6 +83,7 @@ RunContext::RunContext(const RunContext &aContext) {
 
 
 RunContext::~RunContext() {
+    this->FreeScratchBuffersHost();
 #ifdef USE_CUDA
     int rc = 0;
     this->Sync();
@@ -171,6 +176,69 @@ RunContext::SetRunMode(const RunMode &aRunMode) {
     this->mRunMode = aRunMode;
 }
 
+
+void *
+RunContext::RequestScratchBufferHost(const size_t &aBufferSize,
+                                     const size_t &aSlot) const {
+
+    if (aBufferSize == 0 || aBufferSize > this->GetScratchLimitHost()) {
+        return nullptr;
+    }
+
+    if (aSlot >= this->mScratchBuffersHost.size()) {
+        this->mScratchBuffersHost.resize(aSlot + 1, {nullptr, 0});
+    }
+
+    auto &buffer = this->mScratchBuffersHost[ aSlot ];
+    if (aBufferSize > buffer.second) {
+        memory::DestroyArray(buffer.first, definitions::CPU, nullptr);
+        buffer.second = 0;
+        buffer.first = memory::AllocateArray(aBufferSize, definitions::CPU,
+                                             nullptr);
+        buffer.second = aBufferSize;
+    }
+    return buffer.first;
+}
+
+
+size_t
+RunContext::GetScratchLimitHost() const {
+    return MPCR_SCRATCH_HOST_LIMIT;
+}
+
+
+bool
+RunContext::IsScratchBufferHost(const void *apBuffer) const {
+    if (apBuffer == nullptr) {
+        return false;
+    }
+    for (auto &buffer: this->mScratchBuffersHost) {
+        if (buffer.first == apBuffer) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+size_t
+RunContext::GetScratchBufferSizeHost() const {
+    size_t size = 0;
+    for (auto &buffer: this->mScratchBuffersHost) {
+        size += buffer.second;
+    }
+    return size;
+}
+
+
+void
+RunContext::FreeScratchBuffersHost() const {
+    for (auto &buffer: this->mScratchBuffersHost) {
+        memory::DestroyArray(buffer.first, definitions::CPU, nullptr);
+    }
+    this->mScratchBuffersHost.clear();
+}
+
 /** -------------------------- CUDA code -------------------------- **/
 
 #ifdef USE_CUDA
@@ -0,0 +1,496 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <operations/BatchLinearAlgebra.hpp>
+#include <operations/concrete/BackendFactory.hpp>
+#include <kernels/BlasThreading.hpp>
+#include <map>
+#include <memory>
+#include <tuple>
+
+
+using namespace mpcr;
+using namespace mpcr::operations;
+using namespace mpcr::precision;
+using namespace std;
+
+
+/** Problems sharing a key are run by the same dispatched group **/
+typedef tuple <int, size_t, size_t, size_t, size_t> BatchKey;
+
+
+/**
+ * @brief
+ * Get the dimensions of an operand, vectors are seen as one column matrices.
+ *
+ */
+void
+GetBatchDimensions(DataType *apInput, size_t &aRow, size_t &aCol) {
+    if (apInput->IsMatrix()) {
+        aRow = apInput->GetNRow();
+        aCol = apInput->GetNCol();
+    } else {
+        aRow = apInput->GetSize();
+        aCol = 1;
+    }
+}
+
+
+/**
+ * @brief
+ * Validate the batch and prepare the operands of every problem, operands
+ * are converted to the precision of the first operand (copies are kept in
+ * aHolders) and host buffers are made valid once, so concurrent problems
+ * only read them. Output objects are cleared and set to the problem
+ * precision. Problems are grouped by precision and operand dimensions.
+ *
+ */
+map <BatchKey, vector <size_t>>
+PrepareBatch(vector <DataType *> &aFirst, vector <DataType *> *apSecond,
+             vector <vector <DataType *> *> aOutputs,
+             vector <unique_ptr <DataType>> &aHolders,
+             const bool &aClearOutputs = true) {
+
+    auto batch_size = aFirst.size();
+    if (batch_size == 0) {
+        MPCR_API_EXCEPTION("Batch must contain at least one problem", -1);
+    }
+    if (apSecond != nullptr && apSecond->size() != batch_size) {
+        MPCR_API_EXCEPTION("Batch operands must have the same length", -1);
+    }
+    for (auto &pOutput: aOutputs) {
+        if (pOutput->size() != batch_size) {
+            MPCR_API_EXCEPTION("Batch outputs must have the same length as "
+                               "the operands", -1);
+        }
+    }
+
+    map <BatchKey, vector <size_t>> groups;
+
+    for (size_t i = 0; i < batch_size; i++) {
+        auto pFirst = aFirst[ i ];
+        auto precision = pFirst->GetPrecision();
+        if (precision != FLOAT && precision != DOUBLE) {
+            MPCR_API_EXCEPTION("Batched operations support single and double "
+                               "precision only", -1);
+        }
+        if (!pFirst->IsMatrix()) {
+            MPCR_API_EXCEPTION("Batched operations need MPCR Matrices", -1);
+        }
+        pFirst->GetData(CPU);
+
+        size_t row_a, col_a, row_b = 0, col_b = 0;
+        GetBatchDimensions(pFirst, row_a, col_a);
+
+        if (apSecond != nullptr) {
+            auto pSecond = ( *apSecond )[ i ];
+            if (pSecond->GetPrecision() != precision) {
+                aHolders.push_back(make_unique <DataType>(*pSecond, precision));
+                pSecond = aHolders.back().get();
+                ( *apSecond )[ i ] = pSecond;
+            }
+            pSecond->GetData(CPU);
+            GetBatchDimensions(pSecond, row_b, col_b);
+        }
+
+        for (auto &pOutput: aOutputs) {
+            if (aClearOutputs) {
+                ( *pOutput )[ i ]->ClearUp();
+                ( *pOutput )[ i ]->ConvertPrecision(precision);
+            }
+        }
+
+        groups[ BatchKey(precision, row_a, col_a, row_b, col_b) ].push_back(i);
+    }
+
+    return groups;
+}
+
+
+/**
+ * @brief
+ * Schedule the problems of one group across the cores, BLAS / LAPACK run
+ * single threaded inside the region so problems don't oversubscribe the
+ * cores. A failing problem can't throw inside the parallel region, the
+ * first failure is reported once all the problems are done.
+ *
+ */
+template <typename FUNCTION>
+void
+RunBatch(const vector <size_t> &aIndices, FUNCTION aKernel,
+         const string &aError) {
+
+    int64_t failed_idx = -1;
+    auto failed_rc = 0;
+    auto num_problems = aIndices.size();
+    kernels::SequentialBlasScope sequential_blas;
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t k = 0; k < num_problems; k++) {
+        auto rc = aKernel(aIndices[ k ]);
+        if (rc != 0) {
+#pragma omp critical
+            {
+                if (failed_idx < 0 || aIndices[ k ] < failed_idx) {
+                    failed_idx = aIndices[ k ];
+                    failed_rc = rc;
+                }
+            }
+        }
+    }
+
+    if (failed_idx >= 0) {
+        auto message = aError + " , problem " + to_string(failed_idx + 1);
+        MPCR_API_EXCEPTION(message.c_str(), failed_rc);
+    }
+}
+
+
+/**
+ * @brief
+ * Set the buffer and dimensions of a batch output
+ *
+ */
+void
+SetBatchOutput(DataType *apOutput, char *apData, const size_t &aRow,
+               const size_t &aCol) {
+    apOutput->SetSize(aRow * aCol);
+    apOutput->SetDimensions(aRow, aCol);
+    apOutput->SetData(apData, CPU);
+}
+
+
+template <typename T>
+void
+BatchGemmGroup(const vector <size_t> &aIndices, vector <DataType *> &aInputA,
+               vector <DataType *> &aInputB, vector <DataType *> &aInputC,
+               const bool &aTransposeA, const bool &aTransposeB,
+               const double &aAlpha, const double &aBeta) {
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+
+    RunBatch(aIndices, [ & ](const size_t &aIdx) {
+        auto pA = aInputA[ aIdx ];
+        auto pB = aInputB[ aIdx ];
+        auto pC = aInputC[ aIdx ];
+        size_t row_a, col_a, row_b, col_b;
+        GetBatchDimensions(pA, row_a, col_a);
+        GetBatchDimensions(pB, row_b, col_b);
+
+        auto row = aTransposeA ? col_a : row_a;
+        auto inner = aTransposeA ? row_a : col_a;
+        auto col = aTransposeB ? row_b : col_b;
+
+        T *pOutput;
+        if (aBeta == 0) {
+            pOutput = (T *) memory::AllocateArray(row * col * sizeof(T), CPU,
+                                                  nullptr);
+        } else {
+            pOutput = (T *) pC->GetData(CPU);
+        }
+
+        solver->Gemm(aTransposeA, aTransposeB, row, col, inner, (T) aAlpha,
+                     (T *) pA->GetData(CPU), row_a, (T *) pB->GetData(CPU),
+                     row_b, (T) aBeta, pOutput, row);
+
+        SetBatchOutput(pC, (char *) pOutput, row, col);
+        return 0;
+    }, "Error While Performing Batched Gemm");
+}
+
+
+template <typename T>
+void
+BatchCholeskyGroup(const vector <size_t> &aIndices,
+                   vector <DataType *> &aInputs, vector <DataType *> &aOutputs,
+                   const bool &aUpperTriangle) {
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto helper = BackendFactory <T>::CreateHelpersBackend(CPU);
+
+    RunBatch(aIndices, [ & ](const size_t &aIdx) {
+        auto pInput = aInputs[ aIdx ];
+        auto side_len = pInput->GetNRow();
+        auto pOutput = (T *) memory::AllocateArray(
+            side_len * side_len * sizeof(T), CPU, nullptr);
+        memory::MemCpy((char *) pOutput, pInput->GetData(CPU),
+                       side_len * side_len * sizeof(T), nullptr,
+                       memory::MemoryTransfer::HOST_TO_HOST);
+
+        auto rc = solver->Potrf(aUpperTriangle, side_len, pOutput, side_len);
+
+        SetBatchOutput(aOutputs[ aIdx ], (char *) pOutput, side_len,
+                       side_len);
+        if (rc == 0) {
+            helper->FillTriangle(*aOutputs[ aIdx ], 0, !aUpperTriangle,
+                                 nullptr);
+        }
+        return rc;
+    }, "Error While Applying Batched Cholesky Decomposition");
+}
+
+
+template <typename T>
+void
+BatchTrsmGroup(const vector <size_t> &aIndices, vector <DataType *> &aInputA,
+               vector <DataType *> &aInputB, vector <DataType *> &aOutputs,
+               const bool &aLeftSide, const bool &aUpperTriangle,
+               const bool &aTranspose, const double &aAlpha) {
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+
+    RunBatch(aIndices, [ & ](const size_t &aIdx) {
+        auto pA = aInputA[ aIdx ];
+        size_t row_b, col_b;
+        GetBatchDimensions(aInputB[ aIdx ], row_b, col_b);
+
+        auto pOutput = (T *) memory::AllocateArray(row_b * col_b * sizeof(T),
+                                                   CPU, nullptr);
+        memory::MemCpy((char *) pOutput, aInputB[ aIdx ]->GetData(CPU),
+                       row_b * col_b * sizeof(T), nullptr,
+                       memory::MemoryTransfer::HOST_TO_HOST);
+
+        solver->Trsm(aLeftSide, aUpperTriangle, aTranspose, row_b, col_b,
+                     (T) aAlpha, (T *) pA->GetData(CPU), pA->GetNRow(),
+                     pOutput, row_b);
+
+        SetBatchOutput(aOutputs[ aIdx ], (char *) pOutput, row_b, col_b);
+        return 0;
+    }, "Error While Performing Batched Trsm");
+}
+
+
+template <typename T>
+void
+BatchSolveGroup(const vector <size_t> &aIndices, vector <DataType *> &aInputA,
+                vector <DataType *> &aInputB, vector <DataType *> &aOutputs) {
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+
+    RunBatch(aIndices, [ & ](const size_t &aIdx) {
+        auto side_len = aInputA[ aIdx ]->GetNRow();
+        size_t row_b, col_b;
+        GetBatchDimensions(aInputB[ aIdx ], row_b, col_b);
+
+        vector <T> factor(side_len * side_len);
+        vector <int64_t> pivots(side_len);
+        memory::MemCpy((char *) factor.data(), aInputA[ aIdx ]->GetData(CPU),
+                       side_len * side_len * sizeof(T), nullptr,
+                       memory::MemoryTransfer::HOST_TO_HOST);
+
+        auto pOutput = (T *) memory::AllocateArray(row_b * col_b * sizeof(T),
+                                                   CPU, nullptr);
+        memory::MemCpy((char *) pOutput, aInputB[ aIdx ]->GetData(CPU),
+                       row_b * col_b * sizeof(T), nullptr,
+                       memory::MemoryTransfer::HOST_TO_HOST);
+
+        auto rc = solver->Gesv(side_len, col_b, factor.data(), side_len,
+                               (void *) pivots.data(), nullptr, row_b,
+                               pOutput, row_b);
+
+        SetBatchOutput(aOutputs[ aIdx ], (char *) pOutput, row_b, col_b);
+        return rc;
+    }, "Error While Solving Batch");
+}
+
+
+template <typename T>
+void
+BatchEigenGroup(const vector <size_t> &aIndices, vector <DataType *> &aInputs,
+                vector <DataType *> &aOutputValues,
+                vector <DataType *> *apOutputVectors) {
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto helper = BackendFactory <T>::CreateHelpersBackend(CPU);
+    auto jobz_no_vec = ( apOutputVectors == nullptr );
+
+    RunBatch(aIndices, [ & ](const size_t &aIdx) {
+        auto side_len = aInputs[ aIdx ]->GetNRow();
+        auto pValues = (T *) memory::AllocateArray(side_len * sizeof(T), CPU,
+                                                   nullptr);
+        auto pVectors = (T *) memory::AllocateArray(
+            side_len * side_len * sizeof(T), CPU, nullptr);
+        memory::MemCpy((char *) pVectors, aInputs[ aIdx ]->GetData(CPU),
+                       side_len * side_len * sizeof(T), nullptr,
+                       memory::MemoryTransfer::HOST_TO_HOST);
+
+        auto rc = solver->Syevd(jobz_no_vec, true, side_len, pVectors,
+                                side_len, pValues);
+
+        auto pOutput_values = aOutputValues[ aIdx ];
+        pOutput_values->SetSize(side_len);
+        pOutput_values->SetData((char *) pValues, CPU);
+
+        if (apOutputVectors != nullptr) {
+            auto pOutput_vectors = ( *apOutputVectors )[ aIdx ];
+            SetBatchOutput(pOutput_vectors, (char *) pVectors, side_len,
+                           side_len);
+            if (rc == 0) {
+                helper->Reverse(*pOutput_vectors, nullptr);
+            }
+        } else {
+            memory::DestroyArray((char *&) pVectors, CPU, nullptr);
+        }
+
+        if (rc == 0) {
+            helper->Reverse(*pOutput_values, nullptr);
+        }
+        return rc;
+    }, "Error While Performing Batched Eigen");
+}
+
+
+void
+batch::BatchGemm(vector <DataType *> &aInputA, vector <DataType *> &aInputB,
+                 vector <DataType *> &aInputC, const bool &aTransposeA,
+                 const bool &aTransposeB, const double &aAlpha,
+                 const double &aBeta) {
+
+    vector <unique_ptr <DataType>> holders;
+    auto operand_b = aInputB;
+    auto groups = PrepareBatch(aInputA, &operand_b, {&aInputC}, holders,
+                               aBeta == 0);
+
+    for (auto &group: groups) {
+        size_t row_a, col_a, row_b, col_b;
+        int precision;
+        tie(precision, row_a, col_a, row_b, col_b) = group.first;
+
+        for (auto &idx: group.second) {
+            if (!operand_b[ idx ]->IsMatrix()) {
+                MPCR_API_EXCEPTION("Batched Gemm operands must be matrices",
+                                   -1);
+            }
+        }
+
+        auto inner_a = aTransposeA ? row_a : col_a;
+        auto inner_b = aTransposeB ? col_b : row_b;
+        if (inner_a != inner_b) {
+            MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
+        }
+
+        if (aBeta != 0) {
+            auto row = aTransposeA ? col_a : row_a;
+            auto col = aTransposeB ? row_b : col_b;
+            for (auto &idx: group.second) {
+                auto pC = aInputC[ idx ];
+                if (pC->GetPrecision() != precision || pC->GetNRow() != row ||
+                    pC->GetNCol() != col) {
+                    MPCR_API_EXCEPTION("Batched Gemm C must match op(A) "
+                                       "op(B) in dimensions and precision",
+                                       -1);
+                }
+                pC->GetData(CPU);
+            }
+        }
+
+        SIMPLE_DISPATCH((Precision) precision, BatchGemmGroup, group.second,
+                        aInputA, operand_b, aInputC, aTransposeA, aTransposeB,
+                        aAlpha, aBeta)
+    }
+}
+
+
+void
+batch::BatchCholesky(vector <DataType *> &aInputs,
+                     vector <DataType *> &aOutputs,
+                     const bool &aUpperTriangle) {
+
+    vector <unique_ptr <DataType>> holders;
+    auto groups = PrepareBatch(aInputs, nullptr, {&aOutputs}, holders);
+
+    for (auto &group: groups) {
+        auto precision = get <0>(group.first);
+        if (get <1>(group.first) != get <2>(group.first)) {
+            MPCR_API_EXCEPTION(
+                "Cannot Apply Cholesky Decomposition on non-square Matrix", -1);
+        }
+        SIMPLE_DISPATCH((Precision) precision, BatchCholeskyGroup,
+                        group.second, aInputs, aOutputs, aUpperTriangle)
+    }
+}
+
+
+void
+batch::BatchTrsm(vector <DataType *> &aInputA, vector <DataType *> &aInputB,
+                 vector <DataType *> &aOutputs, const bool &aLeftSide,
+                 const bool &aUpperTriangle, const bool &aTranspose,
+                 const double &aAlpha) {
+
+    vector <unique_ptr <DataType>> holders;
+    auto operand_b = aInputB;
+    auto groups = PrepareBatch(aInputA, &operand_b, {&aOutputs}, holders);
+
+    for (auto &group: groups) {
+        size_t row_a, col_a, row_b, col_b;
+        int precision;
+        tie(precision, row_a, col_a, row_b, col_b) = group.first;
+
+        if (row_a != col_a) {
+            MPCR_API_EXCEPTION("Triangular Matrix must be square", -1);
+        }
+        if (( aLeftSide ? row_b : col_b ) != row_a) {
+            MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
+        }
+
+        SIMPLE_DISPATCH((Precision) precision, BatchTrsmGroup, group.second,
+                        aInputA, operand_b, aOutputs, aLeftSide,
+                        aUpperTriangle, aTranspose, aAlpha)
+    }
+}
+
+
+void
+batch::BatchSolve(vector <DataType *> &aInputA, vector <DataType *> &aInputB,
+                  vector <DataType *> &aOutputs) {
+
+    vector <unique_ptr <DataType>> holders;
+    auto operand_b = aInputB;
+    auto groups = PrepareBatch(aInputA, &operand_b, {&aOutputs}, holders);
+
+    for (auto &group: groups) {
+        size_t row_a, col_a, row_b, col_b;
+        int precision;
+        tie(precision, row_a, col_a, row_b, col_b) = group.first;
+
+        if (row_a != col_a) {
+            MPCR_API_EXCEPTION(
+                "Cannot Solve This Matrix , Must be a Square Matrix", -1);
+        }
+        if (row_b != col_a) {
+            MPCR_API_EXCEPTION("Dimensions must be compatible", -1);
+        }
+
+        SIMPLE_DISPATCH((Precision) precision, BatchSolveGroup, group.second,
+                        aInputA, operand_b, aOutputs)
+    }
+}
+
+
+void
+batch::BatchEigen(vector <DataType *> &aInputs,
+                  vector <DataType *> &aOutputValues,
+                  vector <DataType *> *apOutputVectors) {
+
+    vector <unique_ptr <DataType>> holders;
+    vector <vector <DataType *> *> outputs = {&aOutputValues};
+    if (apOutputVectors != nullptr) {
+        outputs.push_back(apOutputVectors);
+    }
+    auto groups = PrepareBatch(aInputs, nullptr, outputs, holders);
+
+    for (auto &group: groups) {
+        auto precision = get <0>(group.first);
+        if (get <1>(group.first) != get <2>(group.first)) {
+            MPCR_API_EXCEPTION("Cannot Perform Eigen on non square Matrix",
+                               -1);
+        }
+        SIMPLE_DISPATCH((Precision) precision, BatchEigenGroup, group.second,
+                        aInputs, aOutputValues, apOutputVectors)
+    }
+}
@@ -9,12 +9,55 @@
 #include <operations/LinearAlgebra.hpp>
 #include <utilities/TypeChecker.hpp>
 #include <operations/concrete/BackendFactory.hpp>
+#include <operations/TileLinearAlgebra.hpp>
+#include <kernels/BlasThreading.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
 
 
+using namespace mpcr;
 using namespace mpcr::operations;
 using namespace mpcr::kernels;
 using namespace std;
 
+
+/** Scratch slots of the operation context used by the linear routines **/
+#define MPCR_SCRATCH_PIVOTS 0
+#define MPCR_SCRATCH_DATA 1
+/** Maximum Krylov dimension of the spectral norm estimator **/
+#define MPCR_NORM_MAX_STEPS 64
+/** Random probes estimating the backward error of the adaptive Cholesky **/
+#define MPCR_CHOLESKY_PROBES 4
+
+
+/**
+ * @brief
+ * Get the buffer a destructive LAPACK routine works on. In overwrite mode
+ * this is the data of aInput itself, to be taken over with ReleaseData()
+ * once the routine returns, otherwise a new copy owned by the caller.
+ *
+ */
+char *
+RequestWorkArray(DataType &aInput, const size_t &aSizeInBytes,
+                 const bool &aOverwrite, const OperationPlacement &aPlacement,
+                 RunContext *aContext) {
+
+    auto pData = aInput.GetData(aPlacement);
+    if (aOverwrite) {
+        return pData;
+    }
+
+    auto mem_transfer = ( aPlacement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    auto pWork = memory::AllocateArray(aSizeInBytes, aPlacement, aContext);
+    memory::MemCpy(pWork, pData, aSizeInBytes, aContext, mem_transfer);
+    return pWork;
+}
+
 #ifdef USING_HALF
 
 
@@ -146,6 +189,7 @@ linear::CrossProduct(DataType &aInputA, DataType &aInputB, DataType &aOutput,
 
     auto is_one_input = aInputB.GetSize() == 0;
     auto flag_conv = false;
+    auto flag_conv_a = false;
 
     if (!aInputB.IsMatrix() && !is_one_input) {
         if (aInputA.IsMatrix()) {
@@ -160,13 +204,38 @@ linear::CrossProduct(DataType &aInputA, DataType &aInputB, DataType &aOutput,
         if (aInputB.IsMatrix()) {
             if (aInputA.GetNCol() != aInputB.GetNRow()) {
                 aInputA.SetDimensions(aInputA.GetNCol(), 1);
-                flag_conv = true;
+                flag_conv_a = true;
             }
         }
     }
 
+    /* A single vector is a column, as in R, so crossprod(x) is 1 x 1 and
+     * tcrossprod(x) is the outer product */
+    if (!aInputA.IsMatrix() && is_one_input) {
+        aInputA.SetDimensions(aInputA.GetNCol(), 1);
+        flag_conv_a = true;
+    }
+
+    auto restore_vectors = [ & ]() {
+        if (flag_conv) {
+            aInputB.ToVector();
+        }
+        if (flag_conv_a) {
+            aInputA.ToVector();
+        }
+    };
+
+    /* A pending lazy transpose is folded into the BLAS transpose flags,
+     * dimensions below describe the stored buffers. */
+    auto transpose_a = aTransposeA != aInputA.IsTransposed();
+    auto transpose_b = aTransposeB != ( is_one_input ? aInputA.IsTransposed()
+                                                     : aInputB.IsTransposed());
+
     auto row_a = aInputA.GetNRow();
     auto col_a = aInputA.GetNCol();
+    if (aInputA.IsTransposed()) {
+        std::swap(row_a, col_a);
+    }
 
     size_t row_b;
     size_t col_b;
@@ -183,19 +252,25 @@ linear::CrossProduct(DataType &aInputA, DataType &aInputB, DataType &aOutput,
     } else {
         row_b = aInputB.GetNRow();
         col_b = aInputB.GetNCol();
+        if (aInputB.IsTransposed()) {
+            std::swap(row_b, col_b);
+        }
     }
 
     size_t lda = row_a;
     size_t ldb = row_b;
+    size_t stored_col_a = col_a;
+    size_t stored_col_b = col_b;
 
-    if (aTransposeA) {
+    if (transpose_a) {
         std::swap(row_a, col_a);
     }
-    if (aTransposeB) {
+    if (transpose_b) {
         std::swap(row_b, col_b);
     }
 
     if (col_a != row_b) {
+        restore_vectors();
         MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
     }
 
@@ -205,6 +280,7 @@ linear::CrossProduct(DataType &aInputA, DataType &aInputB, DataType &aOutput,
     if (aOutput.GetSize() != 0) {
 
         if (aOutput.GetNRow() != row_a || aOutput.GetNCol() != col_b) {
+            restore_vectors();
             MPCR_API_EXCEPTION("Wrong Output Matrix Dimensions", -1);
         }
 
@@ -222,17 +298,41 @@ linear::CrossProduct(DataType &aInputA, DataType &aInputB, DataType &aOutput,
         aOutput.SetDimensions(row_a, col_b);
     }
 
-    auto pData_a = (T *) aInputA.GetData(operation_placement);
-    auto pData_b = (T *) aInputB.GetData(operation_placement);
+    auto pData_a = (T *) aInputA.GetStoredData(operation_placement);
+    auto pData_b = (T *) aInputB.GetStoredData(operation_placement);
 
     auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
         operation_placement);
 
+    /* Vector operands go through level 1 / 2 BLAS, a single row or column
+     * is contiguous whether it is stored transposed or not, so every vector
+     * below has a unit stride. */
     if (!is_one_input) {
-        solver->Gemm(aTransposeA, aTransposeB, row_a, col_b, col_a, aAlpha,
-                     pData_a, lda, pData_b, ldb, aBeta, pData_out, row_a);
+        if (row_a == 1 && col_b == 1 && operation_placement == CPU) {
+            auto dot = solver->Dot(col_a, pData_a, 1, pData_b, 1);
+            auto beta_term = aBeta == 0 ? 0 : aBeta * pData_out[ 0 ];
+            pData_out[ 0 ] = (T) ( aAlpha * dot + beta_term );
+        } else if (col_b == 1) {
+            solver->Gemv(transpose_a, lda, stored_col_a, aAlpha, pData_a, lda,
+                         pData_b, 1, aBeta, pData_out, 1);
+        } else if (row_a == 1) {
+            solver->Gemv(!transpose_b, ldb, stored_col_b, aAlpha, pData_b,
+                         ldb, pData_a, 1, aBeta, pData_out, 1);
+        } else if (col_a == 1 && ( aBeta == 0 || aBeta == 1 )) {
+            if (aBeta == 0) {
+                memory::Memset((char *) pData_out, 0,
+                               sizeof(T) * row_a * col_b, operation_placement,
+                               context);
+            }
+            solver->Ger(row_a, col_b, aAlpha, pData_a, 1, pData_b, 1,
+                        pData_out, row_a);
+        } else {
+            solver->Gemm(transpose_a, transpose_b, row_a, col_b, col_a,
+                         aAlpha, pData_a, lda, pData_b, ldb, aBeta, pData_out,
+                         row_a);
+        }
     } else {
-        solver->Syrk(true, aTransposeA, row_a, col_a, aAlpha, pData_a, lda,
+        solver->Syrk(true, transpose_a, row_a, col_a, aAlpha, pData_a, lda,
                      aBeta, pData_out, row_a);
 
     }
@@ -245,16 +345,65 @@ linear::CrossProduct(DataType &aInputA, DataType &aInputB, DataType &aOutput,
         helper->Symmetrize(aOutput, true, context);
     }
 
-    if (flag_conv) {
-        aInputB.ToVector();
+    restore_vectors();
+
+}
+
+
+template <typename T>
+void
+linear::PackedCrossProduct(DataType &aInput, DataType &aOutput,
+                           const bool &aTranspose, const bool &aUpperTriangle) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    if (!aInput.IsMatrix()) {
+        MPCR_API_EXCEPTION("Input Must Be a Matrix", -1);
+    }
+
+    if (operation_placement != CPU) {
+        DataType dump(0, aInput.GetPrecision());
+        linear::CrossProduct <T>(aInput, dump, aOutput, aTranspose,
+                                 !aTranspose, true);
+        aOutput.ToPacked(aUpperTriangle);
+        return;
+    }
+
+    /* Fold a pending lazy transpose, dimensions describe the stored buffer. */
+    auto transpose = aTranspose != aInput.IsTransposed();
+    auto row = aInput.GetNRow();
+    auto col = aInput.GetNCol();
+    if (aInput.IsTransposed()) {
+        std::swap(row, col);
     }
 
+    auto lda = row;
+    auto side_len = transpose ? col : row;
+    auto inner_dim = transpose ? row : col;
+    auto packed_size = side_len * ( side_len + 1 ) / 2;
+
+    auto pData = (T *) aInput.GetStoredData(CPU);
+    auto pOutput = (T *) memory::AllocateArray(packed_size * sizeof(T), CPU,
+                                               context);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    solver->PackedSyrk(!aUpperTriangle, transpose, side_len, inner_dim, 1,
+                       pData, lda, 0, pOutput);
+
+    aOutput.ClearUp();
+    aOutput.SetSize(side_len * side_len);
+    aOutput.SetDimensions(side_len, side_len);
+    aOutput.SetPackedLayout(aUpperTriangle, false);
+    aOutput.SetData((char *) pOutput, CPU);
+
 }
 
 
 template <typename T>
 void
-linear::IsSymmetric(DataType &aInput, bool &aOutput) {
+linear::IsSymmetric(DataType &aInput, bool &aOutput,
+                    const double &aTolerance) {
 
     auto context = ContextManager::GetOperationContext();
     auto operation_placement = context->GetOperationPlacement();
@@ -267,11 +416,53 @@ linear::IsSymmetric(DataType &aInput, bool &aOutput) {
         return;
     }
 
+    if (aInput.IsPacked() && !aInput.IsPackedTriangular()) {
+        aOutput = true;
+        return;
+    }
+
+    double epsilon = std::numeric_limits <T>::epsilon();
+    auto tolerance = ( aTolerance < 0 ) ? epsilon : aTolerance;
+
+    /* Known structure skips the scan, an exactly symmetric matrix passes
+     * any tolerance, one symmetric at the default tolerance stays so for
+     * looser ones, and an asymmetric one for tighter ones. */
+    if (aInput.HasProperty(MATRIX_SYMMETRIC) ||
+        ( aInput.HasProperty(MATRIX_NEARLY_SYMMETRIC) &&
+          tolerance >= epsilon )) {
+        aOutput = true;
+        return;
+    }
+    if (( aInput.HasProperty(MATRIX_NOT_SYMMETRIC) && tolerance <= epsilon ) ||
+        ( aInput.HasProperty(MATRIX_PROBED) &&
+          !aInput.HasProperty(MATRIX_SYMMETRIC) && tolerance == 0 )) {
+        return;
+    }
+
     auto helper = BackendFactory <T>::CreateHelpersBackend(
         operation_placement);
 
-    helper->IsSymmetric(aInput, aOutput, context);
+    /* Symmetry does not depend on a pending lazy transpose, check the stored
+     * data as is. */
+    auto is_transposed = aInput.IsTransposed();
+    if (is_transposed) {
+        aInput.LazyTranspose();
+    }
+
+    helper->IsSymmetric(aInput, aOutput, tolerance, context);
+
+    if (is_transposed) {
+        aInput.LazyTranspose();
+    }
 
+    /* Only the exact comparison may tell the solvers to use one triangle */
+    if (aOutput && tolerance == 0) {
+        aInput.SetProperty(MATRIX_SYMMETRIC);
+    } else if (aOutput && tolerance <= epsilon) {
+        aInput.SetProperty(MATRIX_NEARLY_SYMMETRIC);
+    } else if (!aOutput && tolerance >= epsilon) {
+        aInput.SetProperty(MATRIX_NOT_SYMMETRIC);
+    }
 
 }
 
@@ -279,7 +470,7 @@ linear::IsSymmetric(DataType &aInput, bool &aOutput) {
 template <typename T>
 void
 linear::Cholesky(DataType &aInputA, DataType &aOutput,
-                 const bool &aUpperTriangle) {
+                 const bool &aUpperTriangle, const bool &aOverwrite) {
 
     auto context = ContextManager::GetOperationContext();
     auto operation_placement = context->GetOperationPlacement();
@@ -293,41 +484,258 @@ linear::Cholesky(DataType &aInputA, DataType &aOutput,
             "Cannot Apply Cholesky Decomposition on non-square Matrix", -1);
     }
 
-    auto pData = (T *) aInputA.GetData(operation_placement);
-    auto pOutput = memory::AllocateArray(row * col * sizeof(T),
-                                         operation_placement, context);
+    /* A packed input stays packed, the factor overwrites the packed triangle
+     * and the other triangle is never stored. */
+    if (aInputA.IsPacked() && operation_placement == CPU) {
+        auto packed_size = row * ( row + 1 ) / 2;
+        auto spd = !aInputA.IsPackedTriangular();
+        /* The triangle has to be repacked anyway on an orientation mismatch */
+        auto overwrite =
+            aOverwrite && aInputA.IsPackedUpper() == aUpperTriangle;
+        char *pOutput = nullptr;
+
+        if (overwrite) {
+            pOutput = aInputA.GetPackedData(CPU);
+        } else if (aInputA.IsPackedUpper() == aUpperTriangle) {
+            pOutput = memory::AllocateArray(packed_size * sizeof(T), CPU,
+                                            context);
+            memory::MemCpy(pOutput, aInputA.GetPackedData(CPU),
+                           packed_size * sizeof(T), context,
+                           memory::MemoryTransfer::HOST_TO_HOST);
+        } else {
+            pOutput = memory::AllocateArray(packed_size * sizeof(T), CPU,
+                                            context);
+            DataType temp(aInputA);
+            temp.ToPacked(aUpperTriangle);
+            memory::MemCpy(pOutput, temp.GetPackedData(CPU),
+                           packed_size * sizeof(T), context,
+                           memory::MemoryTransfer::HOST_TO_HOST);
+        }
 
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+        auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+        auto rc = solver->Pptrf(aUpperTriangle, row, (T *) pOutput);
+
+        if (overwrite) {
+            aInputA.ReleaseData(CPU);
+        } else if (aOverwrite) {
+            aInputA.ClearUp();
+        }
+
+        if (rc != 0) {
+            memory::DestroyArray(pOutput, CPU, context);
+            MPCR_API_EXCEPTION(
+                "Error While Applying Cholesky Decomposition", rc);
+        }
 
-    memory::MemCpy(pOutput, (char *) pData, row * col * sizeof(T), context,
-                   mem_transfer);
+        aOutput.ClearUp();
+        aOutput.SetSize(row * col);
+        aOutput.SetDimensions(row, col);
+        aOutput.SetPackedLayout(aUpperTriangle, true);
+        aOutput.SetData(pOutput, CPU);
+        aOutput.SetProperty(aUpperTriangle ? MATRIX_UPPER_TRIANGULAR
+                                           : MATRIX_LOWER_TRIANGULAR);
+        if (spd && !aOverwrite) {
+            aInputA.SetProperty(MATRIX_SPD);
+        }
+        return;
+    }
 
+    auto pOutput = RequestWorkArray(aInputA, row * col * sizeof(T),
+                                    aOverwrite, operation_placement, context);
 
     auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
         operation_placement);
 
     auto rc = solver->Potrf(aUpperTriangle, row, (T *) pOutput, row);
+    /* Potrf only reads one triangle, A is known SPD only if it is known to
+     * be symmetric */
+    auto spd = aInputA.HasProperty(MATRIX_SYMMETRIC);
+
+    if (aOverwrite) {
+        aInputA.ReleaseData(operation_placement);
+    }
 
     if (rc != 0) {
+        memory::DestroyArray(pOutput, operation_placement, context);
         MPCR_API_EXCEPTION(
             "Error While Applying Cholesky Decomposition", rc);
     }
 
     aOutput.ClearUp();
-    aOutput.SetDimensions(aInputA);
+    aOutput.SetSize(row * col);
+    aOutput.SetDimensions(row, col);
     aOutput.SetData((char *) pOutput, operation_placement);
 
     auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
     helper->FillTriangle(aOutput, 0, !aUpperTriangle, context);
 
+    aOutput.SetProperty(aUpperTriangle ? MATRIX_UPPER_TRIANGULAR
+                                       : MATRIX_LOWER_TRIANGULAR);
+    if (spd && !aOverwrite) {
+        aInputA.SetProperty(MATRIX_SPD);
+    }
+
+}
+
+
+template <typename T>
+void
+linear::Cholesky(DataType &aInputA, DataType &aOutput,
+                 const bool &aUpperTriangle, const double &aTolerance,
+                 const size_t &aTileSize, double &aAccuracy,
+                 std::vector <double> &aFlopShare) {
+
+    auto row = aInputA.GetNRow();
+    auto col = aInputA.GetNCol();
+
+    if (row != col) {
+        MPCR_API_EXCEPTION(
+            "Cannot Apply Cholesky Decomposition on non-square Matrix", -1);
+    }
+
+    if (aTileSize == 0 || aTolerance < 0) {
+        MPCR_API_EXCEPTION(
+            "Tile size must be positive and tolerance non-negative", -1);
+    }
+
+    auto tile_size = std::min(aTileSize, row);
+    auto pData = (T *) aInputA.GetData(CPU);
+    std::vector <double> values(pData, pData + ( row * col ));
+
+    /* The tiles are released once the factor is gathered, so at most three
+     * dense copies of A are alive at a time. */
+    DataType factor(DOUBLE);
+    double norm_a = 0;
+    {
+        MPCRTile tiles(row, col, tile_size, tile_size, values, {"double"});
+        std::vector <double>().swap(values);
+        auto grid = tiles.GetGridNRow();
+
+        std::vector <double> norms(grid * grid);
+        for (auto idx = 0; idx < grid * grid; idx++) {
+            norms[ idx ] = tiles.GetTile(idx % grid, idx / grid)->SquareSum();
+            norm_a += norms[ idx ];
+        }
+        norm_a = sqrt(norm_a);
+
+        /* Only the lower tiles are referenced by the factorization, diagonal
+         * tiles stay in the caller's precision. */
+        auto threshold = aTolerance * norm_a /
+                         ( grid * std::numeric_limits <float>::epsilon());
+        auto demote_all = aInputA.GetPrecision() != DOUBLE;
+
+        for (auto j = 0; j < grid; j++) {
+            for (auto i = j; i < grid; i++) {
+                if (demote_all || ( i != j &&
+                                    sqrt(norms[ i + ( j * grid ) ]) <=
+                                    threshold )) {
+                    tiles.ChangeTilePrecision(i, j, FLOAT);
+                }
+            }
+        }
+
+        std::vector <double> flops;
+        tile::TileCholesky(tiles, flops);
+
+        auto flops_total = flops[ 0 ] + flops[ 1 ] + flops[ 2 ];
+        aFlopShare.resize(3);
+        for (auto i = 0; i < 3; i++) {
+            aFlopShare[ i ] =
+                ( flops_total > 0 ) ? flops[ i ] / flops_total : 0;
+        }
+
+        tiles.GetMatrix(factor, DOUBLE);
+    }
+
+    auto pFactor = (double *) factor.GetData(CPU);
+    for (auto j = 1; j < col; j++) {
+        std::fill(pFactor + ( j * row ), pFactor + ( j * row ) + j, 0);
+    }
+
+    /* ||A - L t(L)||_F is estimated from a few Gaussian probes v, as the
+     * mean of ||A v - L (t(L) v)||^2 is its square, which keeps the report
+     * O(n^2) instead of another O(n^3) product. */
+    auto solver = BackendFactory <double>::CreateLinearAlgebraBackend(CPU);
+    std::vector <double> probe(row);
+    std::vector <double> projection(row);
+    std::vector <double> product(row);
+    std::mt19937_64 generator(0);
+    std::normal_distribution <double> distribution(0, 1);
+    double residual = 0;
+
+    for (auto k = 0; k < MPCR_CHOLESKY_PROBES; k++) {
+        for (auto &val: probe) {
+            val = distribution(generator);
+        }
+
+        /* A is symmetric, A v is formed from contiguous column dots */
+#pragma omp parallel for schedule(static)
+        for (size_t j = 0; j < col; j++) {
+            auto pColumn = pData + ( j * row );
+            double sum = 0;
+#pragma omp simd reduction(+ : sum)
+            for (size_t i = 0; i < row; i++) {
+                sum += (double) pColumn[ i ] * probe[ i ];
+            }
+            product[ j ] = sum;
+        }
+
+        solver->Gemv(true, row, col, 1, pFactor, row, probe.data(), 1, 0,
+                     projection.data(), 1);
+        solver->Gemv(false, row, col, -1, pFactor, row, projection.data(), 1,
+                     1, product.data(), 1);
+
+        for (auto &val: product) {
+            residual += val * val;
+        }
+    }
+    aAccuracy = ( norm_a > 0 ) ? sqrt(residual / MPCR_CHOLESKY_PROBES) / norm_a
+                               : 0;
+
+    auto pOutput = (T *) memory::AllocateArray(row * col * sizeof(T), CPU,
+                                               nullptr);
+    for (auto j = 0; j < col; j++) {
+        for (auto i = 0; i < row; i++) {
+            pOutput[ i + ( j * row ) ] = aUpperTriangle
+                                         ? (T) pFactor[ j + ( i * row ) ]
+                                         : (T) pFactor[ i + ( j * row ) ];
+        }
+    }
+
+    aOutput.ClearUp();
+    aOutput.SetSize(row * col);
+    aOutput.SetDimensions(row, col);
+    aOutput.SetData((char *) pOutput, CPU);
+}
+
+
+/**
+ * @brief
+ * Check whether a double precision operation is asked to run in a reduced
+ * internal precision. Reduced precisions are only implemented on CPU, a GPU
+ * request is rejected instead of silently running in double precision.
+ *
+ */
+template <typename T>
+bool
+IsReducedInternalPrecision(const std::string &aInternalPrecision,
+                           const OperationPlacement &aPlacement) {
+    if (!precision::IsReducedPrecision(aInternalPrecision) ||
+        !is_double <T>()) {
+        return false;
+    }
+    if (aPlacement != CPU) {
+        MPCR_API_EXCEPTION(
+            "Reduced internal precision is only supported on CPU", -1);
+    }
+    return true;
 }
 
 
 template <typename T>
 void
-linear::CholeskyInv(DataType &aInputA, DataType &aOutput, const size_t &aNCol) {
+linear::CholeskyInv(DataType &aInputA, DataType &aOutput, const size_t &aNCol,
+                    const std::string &aInternalPrecision) {
 
     auto context = ContextManager::GetOperationContext();
     auto operation_placement = context->GetOperationPlacement();
@@ -340,6 +748,53 @@ linear::CholeskyInv(DataType &aInputA, DataType &aOutput, const size_t &aNCol) {
     }
 
     T *pOutput = nullptr;
+    auto reduced_precision = IsReducedInternalPrecision <T>(
+        aInternalPrecision, operation_placement);
+
+    /* Packed factor, the packed inverse overwrites the same triangle. */
+    if (aInputA.IsPacked() && aNCol == col && operation_placement == CPU) {
+        auto packed_size = col * ( col + 1 ) / 2;
+        auto is_upper = aInputA.IsPackedUpper();
+        auto pPacked = (T *) aInputA.GetPackedData(CPU);
+        auto rc = 0;
+        char *pInverse = nullptr;
+
+        if (reduced_precision) {
+            /* Pptri in single precision, returned as a single precision
+             * Matrix like the full storage inverse. */
+            auto pInverse_float = (float *) memory::AllocateArray(
+                packed_size * sizeof(float), CPU, context);
+            std::copy(pPacked, pPacked + packed_size, pInverse_float);
+            auto solver = BackendFactory <float>::CreateLinearAlgebraBackend(
+                CPU);
+            rc = solver->Pptri(is_upper, col, pInverse_float);
+            pInverse = (char *) pInverse_float;
+        } else {
+            pOutput = (T *) memory::AllocateArray(packed_size * sizeof(T), CPU,
+                                                  context);
+            std::copy(pPacked, pPacked + packed_size, pOutput);
+            auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+            rc = solver->Pptri(is_upper, col, pOutput);
+            pInverse = (char *) pOutput;
+        }
+
+        if (rc != 0) {
+            memory::DestroyArray(pInverse, CPU, context);
+            MPCR_API_EXCEPTION(
+                "Error While Applying Cholesky Decomposition", rc);
+        }
+
+        aOutput.ClearUp();
+        if (reduced_precision) {
+            aOutput.SetPrecision(FLOAT);
+        }
+        aOutput.SetSize(col * col);
+        aOutput.SetDimensions(col, col);
+        aOutput.SetPackedLayout(is_upper, false);
+        aOutput.SetData(pInverse, CPU);
+        aOutput.SetProperty(MATRIX_SPD);
+        return;
+    }
 
     aOutput.ClearUp();
     if (aNCol == col) {
@@ -388,6 +843,35 @@ linear::CholeskyInv(DataType &aInputA, DataType &aOutput, const size_t &aNCol) {
     }
 
 
+    if (reduced_precision) {
+        /* Potri in single precision, the inverse is not refined and is
+         * returned as a single precision Matrix, which is its accuracy. */
+        auto size = aNCol * aNCol;
+        auto pInverse = (float *) memory::AllocateArray(size * sizeof(float),
+                                                        CPU, context);
+        std::copy(pOutput, pOutput + size, pInverse);
+        memory::DestroyArray((char *&) pOutput, CPU, context);
+
+        auto solver = BackendFactory <float>::CreateLinearAlgebraBackend(CPU);
+        auto rc = solver->Potri(true, aNCol, pInverse, aNCol);
+
+        if (rc != 0) {
+            memory::DestroyArray((char *&) pInverse, CPU, context);
+            MPCR_API_EXCEPTION(
+                "Error While Applying Cholesky Decomposition", rc);
+        }
+
+        aOutput.SetPrecision(FLOAT);
+        aOutput.SetSize(size);
+        aOutput.SetDimensions(aNCol, aNCol);
+        aOutput.SetData((char *) pInverse, CPU);
+
+        auto helper = BackendFactory <float>::CreateHelpersBackend(CPU);
+        helper->Symmetrize(aOutput, false, context);
+        aOutput.SetProperty(MATRIX_SPD);
+        return;
+    }
+
     auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
         operation_placement);
     auto rc = solver->Potri(true, aNCol, pOutput, aOutput.GetNRow());
@@ -402,21 +886,22 @@ linear::CholeskyInv(DataType &aInputA, DataType &aOutput, const size_t &aNCol) {
 
     auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
     helper->Symmetrize(aOutput, false, context);
+    aOutput.SetProperty(MATRIX_SPD);
 
 }
 
 
 template <typename T>
-void linear::Solve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
-                   const bool &aSingle, const std::string &aInternalPrecision) {
+void
+linear::CholeskySolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
+                      const bool &aSingle,
+                      const std::string &aInternalPrecision) {
 
     auto context = ContextManager::GetOperationContext();
     auto operation_placement = context->GetOperationPlacement();
 
     auto rows_a = aInputA.GetNRow();
     auto cols_a = aInputA.GetNCol();
-    bool flag_to_matrix = false;
-
 
     if (rows_a != cols_a) {
         MPCR_API_EXCEPTION("Cannot Solve This Matrix , Must be a Square Matrix",
@@ -424,11 +909,10 @@ void linear::Solve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
     }
 
     auto rows_b = rows_a;
-    auto cols_b = rows_b;
+    auto cols_b = rows_a;
 
     if (!aSingle) {
         if (!aInputB.IsMatrix()) {
-            flag_to_matrix = true;
             aInputB.SetDimensions(aInputB.GetNCol(), 1);
         }
         rows_b = aInputB.GetNRow();
@@ -439,109 +923,437 @@ void linear::Solve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
         MPCR_API_EXCEPTION("Dimensions must be compatible", -1);
     }
 
+    /* Only validates the request, Posv refines on its own on CPU while the
+     * GPU backend can only factorize in the precision of A. */
+    IsReducedInternalPrecision <T>(aInternalPrecision, operation_placement);
+
+    DataType dump = aInputA;
+    auto pData_dump = (T *) dump.GetData(operation_placement);
 
-    auto pIpiv = memory::AllocateArray(cols_a * sizeof(int64_t),
-                                       operation_placement,
-                                       context);
     aOutput.ClearUp();
-    auto rc = 0;
+    if (aSingle) {
+        auto pData_identity = (T *) memory::AllocateArray(
+            rows_a * cols_a * sizeof(T), operation_placement, context);
+        auto helper = BackendFactory <T>::CreateHelpersBackend(
+            operation_placement);
+        helper->CreateIdentityMatrix(pData_identity, rows_a, context);
 
+        aOutput.SetSize(rows_a * cols_a);
+        aOutput.SetDimensions(rows_a, cols_a);
+        aOutput.SetData((char *) pData_identity, operation_placement);
+    } else {
+        aOutput = aInputB;
+    }
+
+    auto pData_in_out = (T *) aOutput.GetData(operation_placement);
     auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
         operation_placement);
 
-    if (!aSingle) {
-        DataType dump = aInputA;
-        auto pData_dump = (T *) dump.GetData(operation_placement);
-        T *pData_in_out = nullptr;
-
-        /**
-         * Incase of using CPU backend, lapack will overwrite the pData_in_out.
-         * However, when using GPU, CuBlas will not change pData_in_out and instead
-         * will change the output pointer.
-         * **/
-        if (operation_placement == definitions::CPU) {
-            aOutput = aInputB;
-            pData_in_out = (T *) aOutput.GetData(operation_placement);
-            rc = solver->Gesv(cols_a, cols_b, pData_dump, rows_a,
-                              (void *) pIpiv, nullptr, rows_b, pData_in_out,
-                              rows_b);
-
-        } else {
-            aOutput.SetDimensions(aInputB);
-            pData_in_out = (T *) memory::AllocateArray(
-                aOutput.GetSize() * sizeof(T), GPU, context);
-
-            rc = solver->Gesv(cols_a, cols_b, pData_dump, rows_a,
-                              (void *) pIpiv, (T *) aInputB.GetData(GPU),
-                              rows_b, pData_in_out, rows_b, aInternalPrecision);
-        }
-
-        if (rc != 0) {
-            memory::DestroyArray(pIpiv, operation_placement, context);
-            MPCR_API_EXCEPTION("Error While Solving", rc);
-        }
-        aOutput.SetData((char *) pData_in_out, operation_placement);
+    auto rc = solver->Posv(true, cols_a, cols_b, pData_dump, rows_a,
+                           pData_in_out, rows_b, aInternalPrecision);
 
-    } else {
-        /** This code block should compute the inverse of matrix A **/
-        aOutput = aInputA;
-        auto pData_in_out = (T *) aOutput.GetData(operation_placement);
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Solving", rc);
+    }
+}
 
-        rc = solver->Getrf(rows_a, cols_a, pData_in_out, rows_a,
-                           (int64_t *) pIpiv);
 
-        if (rc != 0) {
-            memory::DestroyArray(pIpiv, operation_placement, context);
-            MPCR_API_EXCEPTION("Error While Solving", rc);
-        }
+/**
+ * @brief
+ * Record the structure of a square Matrix in O(n^2). Both triangles are read
+ * down the columns in parallel, exiting as soon as neither can be zero, and
+ * only a matrix with no zero triangle goes through the exact tiled symmetry
+ * check of IsSymmetric. Matrices with an already known structure are not
+ * scanned again.
+ *
+ */
+template <typename T>
+void
+ProbeStructure(DataType &aInput) {
 
-        if (operation_placement == CPU) {
-            rc = solver->Getri(cols_a, pData_in_out, rows_a, (int64_t *) pIpiv);
+    if (aInput.HasProperty(MATRIX_PROBED) ||
+        aInput.HasProperty(MATRIX_SYMMETRIC) ||
+        aInput.HasProperty(MATRIX_UPPER_TRIANGULAR) ||
+        aInput.HasProperty(MATRIX_LOWER_TRIANGULAR)) {
+        return;
+    }
 
+    if (aInput.IsPacked()) {
+        if (!aInput.IsPackedTriangular()) {
+            aInput.SetProperty(MATRIX_SYMMETRIC);
         } else {
-            auto pData_identity = memory::AllocateArray(
-                rows_a * cols_a * sizeof(T), GPU, context);
-
-            auto helper = BackendFactory <T>::CreateHelpersBackend(
-                operation_placement);
-
-            helper->CreateIdentityMatrix((T *) pData_identity, rows_a, context);
-
-            rc = solver->Getrs(false, rows_a, rows_a, pData_in_out, rows_a,
-                               (int64_t *) pIpiv, (T *) pData_identity, rows_a);
-
-            pData_in_out = (T *) pData_identity;
-
+            aInput.SetProperty(aInput.IsPackedUpper() ? MATRIX_UPPER_TRIANGULAR
+                                                      : MATRIX_LOWER_TRIANGULAR);
         }
+        return;
+    }
 
-        if (rc != 0) {
-            memory::DestroyArray(pIpiv, operation_placement, context);
-            MPCR_API_EXCEPTION("Error While Solving", rc);
+    size_t side_len = aInput.GetNRow();
+    auto pData = (T *) aInput.GetStoredData(CPU);
+    auto upper = true;
+    auto lower = true;
+    auto is_nonzero = [](const T &aValue) {
+        return aValue != 0;
+    };
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (size_t j = 0; j < side_len; j++) {
+        bool check_upper;
+        bool check_lower;
+#pragma omp atomic read
+        check_upper = upper;
+#pragma omp atomic read
+        check_lower = lower;
+
+        auto pColumn = pData + ( j * side_len );
+        if (check_upper &&
+            std::any_of(pColumn + j + 1, pColumn + side_len, is_nonzero)) {
+#pragma omp atomic write
+            upper = false;
+        }
+        if (check_lower && std::any_of(pColumn, pColumn + j, is_nonzero)) {
+#pragma omp atomic write
+            lower = false;
         }
-        aOutput.SetData((char *) pData_in_out, operation_placement);
-
     }
 
-    aOutput.SetSize(cols_a * cols_b);
-    aOutput.SetDimensions(cols_a, cols_b);
-    if (flag_to_matrix) {
-        aInputB.ToVector();
+    /* A pending lazy transpose swaps the triangles of the stored data */
+    if (aInput.IsTransposed()) {
+        std::swap(upper, lower);
     }
 
-    memory::DestroyArray(pIpiv, operation_placement, context);
+    /* A diagonal matrix is symmetric, a matrix with a single zero triangle
+     * is not */
+    auto symmetric = upper && lower;
+    if (!upper && !lower) {
+        linear::IsSymmetric <T>(aInput, symmetric, 0);
+    }
 
+    aInput.SetProperty(MATRIX_PROBED);
+    if (upper) {
+        aInput.SetProperty(MATRIX_UPPER_TRIANGULAR);
+    }
+    if (lower) {
+        aInput.SetProperty(MATRIX_LOWER_TRIANGULAR);
+    }
+    if (symmetric) {
+        aInput.SetProperty(MATRIX_SYMMETRIC);
+    }
 }
 
 
+/**
+ * @brief
+ * Solve A X = B, or invert A if aSingle, using the structure known for A.
+ * Triangular matrices are solved with Trsm on the CPU, symmetric ones with
+ * a Cholesky factorization (Posv, or Potrf and Potri for the inverse).
+ * In overwrite mode A is consumed, and symmetric matrices are only
+ * factorized in place when known to be positive definite, since a failed
+ * factorization leaves nothing to fall back on.
+ *
+ * @returns
+ * false if A has no usable structure, is singular, or is not positive
+ * definite, the caller then falls back to LU and aOutput is left untouched.
+ *
+ */
 template <typename T>
-void
-linear::BackSolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
-                  const size_t &aCol, const bool &aUpperTri,
-                  const bool &aTranspose, const char &aSide,
-                  const double &aAlpha) {
+bool
+SolveStructured(DataType &aInputA, DataType &aInputB, DataType &aOutput,
+                const bool &aSingle, const std::string &aInternalPrecision,
+                const bool &aOverwrite, const OperationPlacement &aPlacement,
+                RunContext *aContext) {
+
+    auto side_len = aInputA.GetNRow();
+    auto cols_b = aSingle ? side_len : aInputB.GetNCol();
+    auto upper = aInputA.HasProperty(MATRIX_UPPER_TRIANGULAR);
+    auto lower = aInputA.HasProperty(MATRIX_LOWER_TRIANGULAR);
+    auto triangular = ( upper || lower ) && aPlacement == CPU;
+    auto symmetric = aInputA.HasProperty(MATRIX_SYMMETRIC) &&
+                     ( !aOverwrite || aInputA.HasProperty(MATRIX_SPD));
+
+    if (!triangular && !symmetric) {
+        return false;
+    }
 
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
+    /* Symmetric data is its own transpose, and the transposed triangle is
+     * solved with the transpose flag of Trsm, so the stored data is used */
+    auto pData = (T *) aInputA.GetStoredData(aPlacement);
+    if (triangular) {
+        for (auto i = 0; i < side_len; i++) {
+            if (pData[ i + ( i * side_len ) ] == 0) {
+                return false;
+            }
+        }
+    }
+
+    auto output_size = side_len * cols_b;
+    auto mem_transfer = ( aPlacement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    auto helper = BackendFactory <T>::CreateHelpersBackend(aPlacement);
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(aPlacement);
+    auto rc = 0;
+    T *pOutput = nullptr;
+
+    if (aSingle && !triangular && aOverwrite) {
+        pOutput = pData;
+    } else {
+        pOutput = (T *) memory::AllocateArray(output_size * sizeof(T),
+                                              aPlacement, aContext);
+    }
+
+    if (triangular) {
+        if (aSingle) {
+            helper->CreateIdentityMatrix(pOutput, side_len, aContext);
+        } else {
+            memory::MemCpy((char *) pOutput, aInputB.GetData(aPlacement),
+                           output_size * sizeof(T), aContext, mem_transfer);
+        }
+        auto is_transposed = aInputA.IsTransposed();
+        solver->Trsm(true, upper != is_transposed, is_transposed, side_len,
+                     cols_b, 1, pData, side_len, pOutput, side_len);
+
+    } else if (aSingle) {
+        if (!aOverwrite) {
+            memory::MemCpy((char *) pOutput, (char *) pData,
+                           output_size * sizeof(T), aContext, mem_transfer);
+        }
+        rc = solver->Potrf(true, side_len, pOutput, side_len);
+        if (rc == 0) {
+            rc = solver->Potri(true, side_len, pOutput, side_len);
+        }
+
+    } else {
+        auto pFactor = pData;
+        if (!aOverwrite) {
+            pFactor = (T *) memory::RequestScratchArray(
+                side_len * side_len * sizeof(T), aPlacement, aContext,
+                MPCR_SCRATCH_DATA);
+            memory::MemCpy((char *) pFactor, (char *) pData,
+                           side_len * side_len * sizeof(T), aContext,
+                           mem_transfer);
+        }
+        memory::MemCpy((char *) pOutput, aInputB.GetData(aPlacement),
+                       output_size * sizeof(T), aContext, mem_transfer);
+        rc = solver->Posv(true, side_len, cols_b, pFactor, side_len, pOutput,
+                          side_len, aInternalPrecision);
+        if (!aOverwrite) {
+            memory::ReleaseScratchArray((char *&) pFactor, aPlacement,
+                                        aContext);
+        }
+    }
+
+    if (aOverwrite) {
+        /* The inverse is computed in the buffer of A, which is kept */
+        if (pOutput == pData) {
+            aInputA.ReleaseData(aPlacement);
+        } else {
+            aInputA.ClearUp();
+        }
+    }
+
+    if (rc != 0) {
+        memory::DestroyArray((char *&) pOutput, aPlacement, aContext);
+        if (aOverwrite) {
+            MPCR_API_EXCEPTION("Error While Solving", rc);
+        }
+        return false;
+    }
+
+    if (!triangular && !aOverwrite) {
+        aInputA.SetProperty(MATRIX_SPD);
+    }
+
+    aOutput.ClearUp();
+    aOutput.SetSize(output_size);
+    aOutput.SetDimensions(side_len, cols_b);
+    aOutput.SetData((char *) pOutput, aPlacement);
+
+    if (triangular) {
+        if (aSingle) {
+            aOutput.SetProperty(upper ? MATRIX_UPPER_TRIANGULAR
+                                      : MATRIX_LOWER_TRIANGULAR);
+        }
+    } else {
+        if (aSingle) {
+            helper->Symmetrize(aOutput, false, aContext);
+            aOutput.SetProperty(MATRIX_SPD);
+        }
+    }
+
+    return true;
+}
+
+
+template <typename T>
+void linear::Solve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
+                   const bool &aSingle, const std::string &aInternalPrecision,
+                   const bool &aOverwrite) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto rows_a = aInputA.GetNRow();
+    auto cols_a = aInputA.GetNCol();
+    bool flag_to_matrix = false;
+
+
+    if (rows_a != cols_a) {
+        MPCR_API_EXCEPTION("Cannot Solve This Matrix , Must be a Square Matrix",
+                           -1);
+    }
+
+    auto rows_b = rows_a;
+    auto cols_b = rows_b;
+
+    if (!aSingle) {
+        if (!aInputB.IsMatrix()) {
+            flag_to_matrix = true;
+            aInputB.SetDimensions(aInputB.GetNCol(), 1);
+        }
+        rows_b = aInputB.GetNRow();
+        cols_b = aInputB.GetNCol();
+    }
+
+    if (cols_a != rows_b) {
+        MPCR_API_EXCEPTION("Dimensions must be compatible", -1);
+    }
+
+    /* Triangular and symmetric positive definite matrices skip LU */
+    if (operation_placement == CPU) {
+        ProbeStructure <T>(aInputA);
+    }
+    if (SolveStructured <T>(aInputA, aInputB, aOutput, aSingle,
+                            aInternalPrecision, aOverwrite,
+                            operation_placement, context)) {
+        if (flag_to_matrix) {
+            aInputB.ToVector();
+        }
+        return;
+    }
+
+    auto pIpiv = memory::RequestScratchArray(cols_a * sizeof(int64_t),
+                                             operation_placement, context,
+                                             MPCR_SCRATCH_PIVOTS);
+    aOutput.ClearUp();
+    auto rc = 0;
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    if (!aSingle) {
+        /* The LU factors overwrite either A or a copy of it */
+        DataType dump(aInputA.GetPrecision());
+        if (!aOverwrite) {
+            dump = aInputA;
+        }
+        auto &factor = aOverwrite ? aInputA : dump;
+        auto pData_dump = (T *) factor.GetData(operation_placement);
+        T *pData_in_out = nullptr;
+
+        /**
+         * Incase of using CPU backend, lapack will overwrite the pData_in_out.
+         * However, when using GPU, CuBlas will not change pData_in_out and instead
+         * will change the output pointer.
+         * **/
+        if (operation_placement == definitions::CPU) {
+            aOutput = aInputB;
+            pData_in_out = (T *) aOutput.GetData(operation_placement);
+            rc = solver->Gesv(cols_a, cols_b, pData_dump, rows_a,
+                              (void *) pIpiv, nullptr, rows_b, pData_in_out,
+                              rows_b, aInternalPrecision);
+
+        } else {
+            aOutput.SetDimensions(aInputB);
+            pData_in_out = (T *) memory::AllocateArray(
+                aOutput.GetSize() * sizeof(T), GPU, context);
+
+            rc = solver->Gesv(cols_a, cols_b, pData_dump, rows_a,
+                              (void *) pIpiv, (T *) aInputB.GetData(GPU),
+                              rows_b, pData_in_out, rows_b, aInternalPrecision);
+        }
+
+        if (aOverwrite) {
+            aInputA.ClearUp();
+        }
+
+        if (rc != 0) {
+            memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+            MPCR_API_EXCEPTION("Error While Solving", rc);
+        }
+        aOutput.SetData((char *) pData_in_out, operation_placement);
+
+    } else {
+        /** This code block should compute the inverse of matrix A **/
+        T *pData_in_out = nullptr;
+        if (aOverwrite) {
+            /* Materialize any lazy layout before taking the buffer */
+            aInputA.GetData(operation_placement);
+            pData_in_out = (T *) aInputA.ReleaseData(operation_placement);
+            aOutput.ClearUp();
+            aOutput.SetSize(cols_a * cols_b);
+            aOutput.SetDimensions(cols_a, cols_b);
+            aOutput.SetData((char *) pData_in_out, operation_placement);
+        } else {
+            aOutput = aInputA;
+            pData_in_out = (T *) aOutput.GetData(operation_placement);
+        }
+
+        rc = solver->Getrf(rows_a, cols_a, pData_in_out, rows_a,
+                           (int64_t *) pIpiv);
+
+        if (rc != 0) {
+            memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+            MPCR_API_EXCEPTION("Error While Solving", rc);
+        }
+
+        if (operation_placement == CPU) {
+            rc = solver->Getri(cols_a, pData_in_out, rows_a, (int64_t *) pIpiv);
+
+        } else {
+            auto pData_identity = memory::AllocateArray(
+                rows_a * cols_a * sizeof(T), GPU, context);
+
+            auto helper = BackendFactory <T>::CreateHelpersBackend(
+                operation_placement);
+
+            helper->CreateIdentityMatrix((T *) pData_identity, rows_a, context);
+
+            rc = solver->Getrs(false, rows_a, rows_a, pData_in_out, rows_a,
+                               (int64_t *) pIpiv, (T *) pData_identity, rows_a);
+
+            pData_in_out = (T *) pData_identity;
+
+        }
+
+        if (rc != 0) {
+            memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+            MPCR_API_EXCEPTION("Error While Solving", rc);
+        }
+        aOutput.SetData((char *) pData_in_out, operation_placement);
+
+    }
+
+    aOutput.SetSize(cols_a * cols_b);
+    aOutput.SetDimensions(cols_a, cols_b);
+    if (flag_to_matrix) {
+        aInputB.ToVector();
+    }
+
+    memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+
+}
+
+
+template <typename T>
+void
+linear::BackSolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
+                  const size_t &aCol, const bool &aUpperTri,
+                  const bool &aTranspose, const char &aSide,
+                  const double &aAlpha) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
 
     bool flag_transform = false;
     if (!aInputA.IsMatrix()) {
@@ -559,6 +1371,17 @@ linear::BackSolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
     auto col_b = aInputB.GetNCol();
     auto left_side = aSide == 'L';
 
+    /* The stored transpose of an upper triangle is a lower triangle, fold a
+     * pending lazy transpose of A into the Trsm arguments. */
+    auto upper_triangle = aUpperTri;
+    auto transpose = aTranspose;
+    auto lda = row_a;
+    if (aInputA.IsTransposed()) {
+        upper_triangle = !upper_triangle;
+        transpose = !transpose;
+        lda = aInputA.GetNCol();
+    }
+
     if (aCol > row_a || std::isnan(aCol) || aCol < 1) {
         MPCR_API_EXCEPTION(
             "Given Number of Columns is Greater than Columns of B", -1);
@@ -568,7 +1391,41 @@ linear::BackSolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
     aOutput.SetSize(col_b * aCol);
     aOutput.SetDimensions(aCol, col_b);
 
-    auto pData = (T *) aInputA.GetData(operation_placement);
+    /* A packed triangle is solved in place with Tptrs, without unpacking. */
+    auto use_packed = aInputA.IsPacked() && operation_placement == CPU &&
+                      aInputA.IsPackedUpper() == aUpperTri && left_side &&
+                      aCol == row_a && aAlpha == 1;
+
+    if (use_packed) {
+        auto pData_b = (T *) aInputB.GetData(CPU);
+        auto pData_in_out = (T *) memory::AllocateArray(
+            col_b * aCol * sizeof(T), CPU, context);
+
+        for (auto i = 0; i < col_b; i++) {
+            memory::MemCpy((char *) ( pData_in_out + ( aCol * i )),
+                           (char *) ( pData_b + ( row_b * i )),
+                           ( sizeof(T) * aCol ), context,
+                           memory::MemoryTransfer::HOST_TO_HOST);
+        }
+
+        auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+        auto rc = solver->Tptrs(aUpperTri, aTranspose, aCol, col_b,
+                                (T *) aInputA.GetPackedData(CPU),
+                                pData_in_out, aCol);
+
+        if (rc != 0) {
+            memory::DestroyArray((char *&) pData_in_out, CPU, context);
+            MPCR_API_EXCEPTION("Error While Performing Packed Backsolve", rc);
+        }
+
+        aOutput.SetData((char *) pData_in_out, CPU);
+        if (flag_transform) {
+            aInputB.ToVector();
+        }
+        return;
+    }
+
+    auto pData = (T *) aInputA.GetStoredData(operation_placement);
     auto pData_b = (T *) aInputB.GetData(operation_placement);
     auto pData_in_out = (T *) memory::AllocateArray(col_b * aCol * sizeof(T),
                                                     operation_placement,
@@ -588,8 +1445,8 @@ linear::BackSolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
     auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
         operation_placement);
 
-    solver->Trsm(left_side, aUpperTri, aTranspose, row_b, col_b, aAlpha, pData,
-                 row_a, pData_in_out, row_b);
+    solver->Trsm(left_side, upper_triangle, transpose, row_b, col_b, aAlpha,
+                 pData, lda, pData_in_out, row_b);
 
 
     aOutput.SetData((char *) pData_in_out, operation_placement);
@@ -601,562 +1458,2332 @@ linear::BackSolve(DataType &aInputA, DataType &aInputB, DataType &aOutput,
 }
 
 
-template <typename T>
-void
-linear::SVD(DataType &aInputA, DataType &aOutputS, DataType &aOutputU,
-            DataType &aOutputV, const size_t &aNu,
-            const size_t &aNv, const bool &aTranspose) {
-
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
-
-    //s ,u ,vt
-    auto row = aInputA.GetNRow();
-    auto col = aInputA.GetNCol();
-    auto pData = (T *) aInputA.GetData(operation_placement);
+/**
+ * @brief
+ * Check the operands of a triangular or symmetric multiplication, a vector B
+ * is viewed as a column for the left side and as a row for the right side.
+ *
+ * @returns
+ * true if B was a vector and has to be restored with ToVector.
+ *
+ */
+bool
+PrepareStructuredMultiply(DataType &aInputA, DataType &aInputB,
+                          const char &aSide) {
 
-    auto min_dim = std::min(row, col);
-    auto pOutput_s = memory::AllocateArray(min_dim * sizeof(T),
-                                           operation_placement, context);
-    T *pOutput_u = nullptr;
-    T *pOutput_vt = nullptr;
+    if (!aInputA.IsMatrix() || aInputA.GetNRow() != aInputA.GetNCol()) {
+        MPCR_API_EXCEPTION("Matrix A must be a square Matrix", -1);
+    }
 
-    aOutputS.ClearUp();
-    aOutputU.ClearUp();
-    aOutputV.ClearUp();
+    if (aSide != 'L' && aSide != 'R') {
+        MPCR_API_EXCEPTION("Side must be either 'L' or 'R'", -1);
+    }
 
-    aOutputS.SetSize(min_dim);
+    auto left_side = aSide == 'L';
+    auto side_len = aInputA.GetNRow();
+    auto flag_transform = false;
 
-    if (aNu) {
-        pOutput_u = (T *) memory::AllocateArray(row * aNu * sizeof(T),
-                                                operation_placement, context);
-        aOutputU.SetSize(row * aNu);
-        aOutputU.SetDimensions(row, aNu);
+    if (!aInputB.IsMatrix()) {
+        auto size = aInputB.GetSize();
+        if (left_side) {
+            aInputB.SetDimensions(size, 1);
+        } else {
+            aInputB.SetDimensions(1, size);
+        }
+        flag_transform = true;
     }
 
-    if (aNv) {
-        pOutput_vt = (T *) memory::AllocateArray(col * aNv * sizeof(T),
-                                                 operation_placement, context);
-        aOutputV.SetSize(col * aNv);
-        /** Will be transposed at the end in case of svd **/
-        aOutputV.SetDimensions(aNv, col);
+    if (( left_side ? aInputB.GetNRow() : aInputB.GetNCol()) != side_len) {
+        if (flag_transform) {
+            aInputB.ToVector();
+        }
+        MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
     }
 
+    return flag_transform;
+}
 
-    auto pTemp_data = memory::AllocateArray(row * col * sizeof(T),
-                                            operation_placement, context);
-
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
 
-    memory::MemCpy((char *) pTemp_data, (char *) pData,
-                   ( row * col ) * sizeof(T), context, mem_transfer);
+template <typename T>
+void
+linear::TriangularMultiply(DataType &aInputA, DataType &aInputB,
+                           DataType &aOutput, const bool &aUpperTri,
+                           const bool &aTranspose, const char &aSide,
+                           const double &aAlpha) {
 
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
 
-    signed char job;
-    int ldvt;
-    if (aNu == 0 && aNv == 0) {
-        job = 'N'; // NoVec
-        ldvt = 1;
-    } else if (aNu <= min_dim && aNv <= min_dim) {
-        job = 'S'; // SomeVec
-        ldvt = min_dim;
-    } else {
-        job = 'A'; //AllVec
-        ldvt = aNv;
+    auto flag_transform = PrepareStructuredMultiply(aInputA, aInputB, aSide);
+    auto row_b = aInputB.GetNRow();
+    auto col_b = aInputB.GetNCol();
+    auto side_len = aInputA.GetNRow();
+
+    /* Fold a pending lazy transpose of A into the Trmm arguments, as in
+     * BackSolve */
+    auto upper_triangle = aUpperTri;
+    auto transpose = aTranspose;
+    if (aInputA.IsTransposed()) {
+        upper_triangle = !upper_triangle;
+        transpose = !transpose;
     }
 
+    auto pData = (T *) aInputA.GetStoredData(operation_placement);
+    auto pData_b = (T *) aInputB.GetData(operation_placement);
+    auto pData_in_out = (T *) memory::AllocateArray(
+        row_b * col_b * sizeof(T), operation_placement, context);
+
+    auto mem_transfer = ( operation_placement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    memory::MemCpy((char *) pData_in_out, (char *) pData_b,
+                   row_b * col_b * sizeof(T), context, mem_transfer);
+
     auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
         operation_placement);
+    solver->Trmm(aSide == 'L', upper_triangle, transpose, row_b, col_b, aAlpha,
+                 pData, side_len, pData_in_out, row_b);
 
-    // Gesdd routine in CPU
-    auto rc = solver->SVD(job, row, col, (T *) pTemp_data, row, (T *) pOutput_s,
-                          pOutput_u,
-                          row, pOutput_vt, ldvt);
+    aOutput.ClearUp();
+    aOutput.SetSize(row_b * col_b);
+    aOutput.SetDimensions(row_b, col_b);
+    aOutput.SetData((char *) pData_in_out, operation_placement);
 
-    if (rc != 0) {
-        auto temp_char_vt = (char *) pOutput_vt;
-        auto temp_char_u = (char *) pOutput_u;
+    if (flag_transform) {
+        aInputB.ToVector();
+    }
+}
+
+
+template <typename T>
+void
+linear::SymmetricMultiply(DataType &aInputA, DataType &aInputB,
+                          DataType &aOutput, const bool &aUpperTri,
+                          const char &aSide, const double &aAlpha) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto flag_transform = PrepareStructuredMultiply(aInputA, aInputB, aSide);
+    auto row_b = aInputB.GetNRow();
+    auto col_b = aInputB.GetNCol();
+    auto side_len = aInputA.GetNRow();
+
+    /* The stored buffer of a lazily transposed symmetric matrix holds the
+     * referenced triangle on the other side */
+    auto upper_triangle = aInputA.IsTransposed() != aUpperTri;
+
+    auto pData = (T *) aInputA.GetStoredData(operation_placement);
+    auto pData_b = (T *) aInputB.GetData(operation_placement);
+    auto pData_out = (T *) memory::AllocateArray(row_b * col_b * sizeof(T),
+                                                 operation_placement, context);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+    solver->Symm(aSide == 'L', upper_triangle, row_b, col_b, aAlpha, pData,
+                 side_len, pData_b, row_b, 0, pData_out, row_b);
+
+    aOutput.ClearUp();
+    aOutput.SetSize(row_b * col_b);
+    aOutput.SetDimensions(row_b, col_b);
+    aOutput.SetData((char *) pData_out, operation_placement);
+
+    if (flag_transform) {
+        aInputB.ToVector();
+    }
+}
+
+
+template <typename T>
+void
+linear::SVD(DataType &aInputA, DataType &aOutputS, DataType &aOutputU,
+            DataType &aOutputV, const size_t &aNu,
+            const size_t &aNv, const bool &aTranspose,
+            const bool &aOverwrite) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    //s ,u ,vt
+    auto row = aInputA.GetNRow();
+    auto col = aInputA.GetNCol();
+    auto pData = (T *) aInputA.GetData(operation_placement);
+
+    auto min_dim = std::min(row, col);
+    auto pOutput_s = memory::AllocateArray(min_dim * sizeof(T),
+                                           operation_placement, context);
+    T *pOutput_u = nullptr;
+    T *pOutput_vt = nullptr;
+
+    aOutputS.ClearUp();
+    aOutputU.ClearUp();
+    aOutputV.ClearUp();
+
+    aOutputS.SetSize(min_dim);
+
+    /* Gesdd returns either min(m, n) or all of the singular vectors on both
+     * sides, the requested ones are copied out of them when fewer */
+    signed char job = 'N';
+    size_t u_cols = 0;
+    size_t vt_rows = 0;
+    if (aNu > 0 || aNv > 0) {
+        auto all_vectors = ( aNu > min_dim || aNv > min_dim );
+        job = all_vectors ? 'A' : 'S'; // AllVec : SomeVec
+        u_cols = all_vectors ? row : min_dim;
+        vt_rows = all_vectors ? col : min_dim;
+    }
+    int ldvt = ( job == 'N' ) ? 1 : vt_rows;
+
+    T *pWork_u = nullptr;
+    T *pWork_vt = nullptr;
+    if (job != 'N') {
+        pWork_u = (T *) memory::AllocateArray(row * u_cols * sizeof(T),
+                                              operation_placement, context);
+        pWork_vt = (T *) memory::AllocateArray(vt_rows * col * sizeof(T),
+                                               operation_placement, context);
+    }
+
+
+    /* Gesdd destroys its input, A itself is used in overwrite mode */
+    auto mem_transfer = ( operation_placement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    auto pTemp_data = (char *) pData;
+    if (!aOverwrite) {
+        pTemp_data = memory::RequestScratchArray(row * col * sizeof(T),
+                                                 operation_placement, context,
+                                                 MPCR_SCRATCH_DATA);
+
+        memory::MemCpy((char *) pTemp_data, (char *) pData,
+                       ( row * col ) * sizeof(T), context, mem_transfer);
+    }
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    // Gesdd routine in CPU
+    auto rc = solver->SVD(job, row, col, (T *) pTemp_data, row, (T *) pOutput_s,
+                          pWork_u, row, pWork_vt, ldvt);
+
+    if (aOverwrite) {
+        aInputA.ClearUp();
+    } else {
+        memory::ReleaseScratchArray(pTemp_data, operation_placement, context);
+    }
 
-        memory::DestroyArray(temp_char_vt, operation_placement, context);
-        memory::DestroyArray(temp_char_u, operation_placement, context);
+    if (rc != 0) {
+        memory::DestroyArray((char *&) pWork_vt, operation_placement, context);
+        memory::DestroyArray((char *&) pWork_u, operation_placement, context);
         memory::DestroyArray(pOutput_s, operation_placement, context);
-        memory::DestroyArray(pTemp_data, operation_placement, context);
 
         MPCR_API_EXCEPTION("Error While Getting SVD", rc);
     }
 
+    /* The first nu columns of U are a prefix of its data, the first nv rows
+     * of t(V) are copied column by column */
+    if (aNu == u_cols) {
+        pOutput_u = pWork_u;
+        pWork_u = nullptr;
+    } else if (aNu) {
+        pOutput_u = (T *) memory::AllocateArray(row * aNu * sizeof(T),
+                                                operation_placement, context);
+        memory::MemCpy((char *) pOutput_u, (char *) pWork_u,
+                       row * aNu * sizeof(T), context, mem_transfer);
+    }
+
+    if (aNv == vt_rows) {
+        pOutput_vt = pWork_vt;
+        pWork_vt = nullptr;
+    } else if (aNv) {
+        pOutput_vt = (T *) memory::AllocateArray(aNv * col * sizeof(T),
+                                                 operation_placement, context);
+        for (auto j = 0; j < col; j++) {
+            memory::MemCpy((char *) ( pOutput_vt + ( j * aNv ) ),
+                           (char *) ( pWork_vt + ( j * vt_rows ) ),
+                           aNv * sizeof(T), context, mem_transfer);
+        }
+    }
+    memory::DestroyArray((char *&) pWork_u, operation_placement, context);
+    memory::DestroyArray((char *&) pWork_vt, operation_placement, context);
+
+    if (aNu) {
+        aOutputU.SetSize(row * aNu);
+        aOutputU.SetDimensions(row, aNu);
+    }
+
+    if (aNv) {
+        aOutputV.SetSize(col * aNv);
+        /** Will be transposed at the end in case of svd **/
+        aOutputV.SetDimensions(aNv, col);
+    }
 
     aOutputS.SetData((char *) pOutput_s, operation_placement);
     aOutputV.SetData((char *) pOutput_vt, operation_placement);
     aOutputU.SetData((char *) pOutput_u, operation_placement);
 
-    if (aTranspose) {
-        auto helper = BackendFactory <T>::CreateHelpersBackend(
-            operation_placement);
-        helper->Transpose(aOutputV, context);
+    if (aTranspose) {
+        auto helper = BackendFactory <T>::CreateHelpersBackend(
+            operation_placement);
+        helper->Transpose(aOutputV, context);
+    }
+
+
+}
+
+
+template <typename T>
+void linear::Eigen(DataType &aInput, DataType &aOutputValues,
+                   DataType *apOutputVectors, const bool &aOverwrite) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto col = aInput.GetNCol();
+    auto row = aInput.GetNRow();
+
+    if (row != col) {
+        MPCR_API_EXCEPTION("Cannot Perform Eigen on non square Matrix", -1);
+    }
+
+
+    auto jobz_no_vec = true;
+    auto fill_upper = true;
+
+    if (apOutputVectors != nullptr) {
+        jobz_no_vec = false;
+    }
+
+    auto pValues = memory::AllocateArray(col * sizeof(T),
+                                         operation_placement, context);
+
+    /* The eigen vectors overwrite A, or a copy of it */
+    auto pVectors = RequestWorkArray(aInput, col * col * sizeof(T), aOverwrite,
+                                     operation_placement, context);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    auto rc = solver->Syevd(jobz_no_vec, fill_upper, col, (T *) pVectors, col,
+                            (T *) pValues);
+
+    if (aOverwrite) {
+        aInput.ReleaseData(operation_placement);
+    }
+
+    if (rc != 0) {
+        memory::DestroyArray(pValues, operation_placement, context);
+        memory::DestroyArray(pVectors, operation_placement, context);
+        MPCR_API_EXCEPTION("Error While Performing Eigen", rc);
+    }
+
+    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
+
+    if (apOutputVectors) {
+        apOutputVectors->ClearUp();
+        apOutputVectors->SetSize(col * col);
+        apOutputVectors->SetDimensions(col, col);
+        apOutputVectors->SetData((char *) pVectors, operation_placement);
+
+        helper->Reverse(*apOutputVectors, context);
+
+    } else {
+        memory::DestroyArray(pVectors, operation_placement, context);
+    }
+
+    aOutputValues.ClearUp();
+    aOutputValues.SetSize(col);
+    aOutputValues.SetData((char *) pValues, operation_placement);
+
+    helper->Reverse(aOutputValues, context);
+
+
+}
+
+
+/**
+ * @brief
+ * Estimate the spectral norm of a matrix with Golub-Kahan-Lanczos
+ * bidiagonalization, fully reorthogonalized with Gemv. The largest singular
+ * value of the projected bidiagonal matrix grows towards ||A||_2 and is
+ * exact once the Krylov space is exhausted, the iteration stops as soon as
+ * it stagnates. The matrix is only touched through Gemv, on the CPU.
+ *
+ */
+template <typename T>
+T
+EstimateSpectralNorm(DataType &aInput) {
+
+    int row = aInput.GetNRow();
+    int col = aInput.GetNCol();
+    int max_steps = std::min(std::min(row, col), MPCR_NORM_MAX_STEPS);
+    auto tolerance = 10 * std::numeric_limits <T>::epsilon();
+
+    auto pData = (T *) aInput.GetData(CPU);
+    auto pV = (T *) memory::AllocateArray(col * ( max_steps + 1 ) * sizeof(T),
+                                          CPU, nullptr);
+    auto pU = (T *) memory::AllocateArray(row * max_steps * sizeof(T), CPU,
+                                          nullptr);
+    auto pBidiagonal = (T *) memory::AllocateArray(
+        max_steps * max_steps * sizeof(T), CPU, nullptr);
+    auto pSingular = (T *) memory::AllocateArray(max_steps * sizeof(T), CPU,
+                                                 nullptr);
+    auto pWork = (T *) memory::AllocateArray(( max_steps + 1 ) * sizeof(T),
+                                             CPU, nullptr);
+    std::vector <T> alpha(max_steps);
+    std::vector <T> beta(max_steps);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+
+    /* Normalize x and returns its norm */
+    auto normalize = [ & ](const int &aSize, T *apVector) {
+        auto norm = std::sqrt(solver->Dot(aSize, apVector, 1, apVector, 1));
+        if (norm > 0) {
+            for (auto i = 0; i < aSize; i++) {
+                apVector[ i ] /= norm;
+            }
+        }
+        return norm;
+    };
+
+    /* Two passes of classical Gram-Schmidt against the first aCount vectors */
+    auto orthogonalize = [ & ](const int &aSize, const int &aCount,
+                               const T *apBasis, T *apVector) {
+        for (auto pass = 0; pass < 2 && aCount > 0; pass++) {
+            solver->Gemv(true, aSize, aCount, 1, apBasis, aSize, apVector, 1, 0,
+                         pWork, 1);
+            solver->Gemv(false, aSize, aCount, -1, apBasis, aSize, pWork, 1, 1,
+                         apVector, 1);
+        }
+    };
+
+    std::mt19937_64 generator(0);
+    std::normal_distribution <double> distribution(0, 1);
+    for (auto i = 0; i < col; i++) {
+        pV[ i ] = (T) distribution(generator);
+    }
+    normalize(col, pV);
+
+    T estimate = 0;
+    for (auto j = 0; j < max_steps; j++) {
+        auto pU_j = pU + ( j * row );
+        auto pV_j = pV + ( j * col );
+        auto pV_next = pV_j + col;
+
+        /* u_j = A v_j - beta_(j-1) u_(j-1) */
+        solver->Gemv(false, row, col, 1, pData, row, pV_j, 1, 0, pU_j, 1);
+        orthogonalize(row, j, pU, pU_j);
+        alpha[ j ] = normalize(row, pU_j);
+
+        /* v_(j+1) = t(A) u_j - alpha_j v_j */
+        solver->Gemv(true, row, col, 1, pData, row, pU_j, 1, 0, pV_next, 1);
+        orthogonalize(col, j + 1, pV, pV_next);
+        beta[ j ] = normalize(col, pV_next);
+
+        /* Largest singular value of the leading upper bidiagonal block */
+        auto size = j + 1;
+        memory::Memset((char *) pBidiagonal, 0, size * size * sizeof(T), CPU,
+                       nullptr);
+        for (auto k = 0; k < size; k++) {
+            pBidiagonal[ k + ( k * size ) ] = alpha[ k ];
+            if (k + 1 < size) {
+                pBidiagonal[ k + ( ( k + 1 ) * size ) ] = beta[ k ];
+            }
+        }
+        solver->SVD('N', size, size, pBidiagonal, size, pSingular, nullptr,
+                    size, nullptr, 1);
+
+        auto previous = estimate;
+        estimate = pSingular[ 0 ];
+        if (estimate - previous <= tolerance * estimate ||
+            beta[ j ] <= tolerance * estimate) {
+            break;
+        }
+    }
+
+    memory::DestroyArray((char *&) pV, CPU, nullptr);
+    memory::DestroyArray((char *&) pU, CPU, nullptr);
+    memory::DestroyArray((char *&) pBidiagonal, CPU, nullptr);
+    memory::DestroyArray((char *&) pSingular, CPU, nullptr);
+    memory::DestroyArray((char *&) pWork, CPU, nullptr);
+
+    return estimate;
+}
+
+
+template <typename T>
+void
+linear::Norm(DataType &aInput, const std::string &aType, double &aOutput) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto col = aInput.GetNCol();
+    auto row = aInput.GetNRow();
+
+    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
+    T val_out_temp = 0;
+
+    /* The one norm of a matrix is the infinity norm of its transpose, so a
+     * pending lazy transpose is folded by swapping the two. */
+    auto is_transposed = aInput.IsTransposed();
+    if (is_transposed) {
+        aInput.LazyTranspose();
+    }
+
+    auto one_norm = ( aType == "O" || aType == "1" );
+    auto inf_norm = ( aType == "I" );
+
+    if (row == 0 || col == 0) {
+        val_out_temp = 0.0f;
+    } else if (one_norm != is_transposed && ( one_norm || inf_norm )) {
+        helper->NormMACS(aInput, val_out_temp, context);
+    } else if (one_norm || inf_norm) {
+        helper->NormMARS(aInput, val_out_temp, context);
+    } else if (aType == "F" || aType == "E") {
+        helper->NormEuclidean(aInput, val_out_temp, context);
+    } else if (aType == "M") {
+        helper->NormMaxMod(aInput, val_out_temp, context);
+    } else if (aType == "2") {
+        /* Invariant under transposition, the stored matrix is used */
+        val_out_temp = EstimateSpectralNorm <T>(aInput);
+    } else {
+        if (is_transposed) {
+            aInput.LazyTranspose();
+        }
+        MPCR_API_EXCEPTION(
+            "Argument must be one of 'M','1','O','I','F','E' or '2' ",
+            -1);
+    }
+
+    if (is_transposed) {
+        aInput.LazyTranspose();
+    }
+    aOutput = val_out_temp;
+}
+
+
+template <typename T>
+void
+linear::QRDecomposition(DataType &aInputA, DataType &aOutputQr,
+                        DataType &aOutputQraux, DataType &aOutputPivot,
+                        DataType &aRank, const bool &aOverwrite) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto col = aInputA.GetNCol();
+    auto row = aInputA.GetNRow();
+    auto min_dim = std::min(col, row);
+
+    /* The compact QR overwrites A, or a copy of it */
+    auto pQr_in_out = RequestWorkArray(aInputA, row * col * sizeof(T),
+                                       aOverwrite, operation_placement,
+                                       context);
+    auto pQraux = memory::AllocateArray(min_dim * sizeof(T),
+                                        operation_placement, context);
+    auto pJpvt = memory::RequestScratchArray(col * sizeof(int64_t),
+                                             operation_placement, context,
+                                             MPCR_SCRATCH_PIVOTS);
+
+
+    memory::Memset((char *) pJpvt, 0, col * sizeof(int64_t),
+                   operation_placement, context);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    auto rc = solver->Geqp3(row, col, (T *) pQr_in_out, row, (int64_t *) pJpvt,
+                            (T *) pQraux);
+
+    if (aOverwrite) {
+        aInputA.ReleaseData(operation_placement);
+    }
+
+    if (rc != 0) {
+        memory::ReleaseScratchArray(pJpvt, operation_placement, context);
+        memory::DestroyArray(pQr_in_out, operation_placement, context);
+        memory::DestroyArray(pQraux, operation_placement, context);
+        MPCR_API_EXCEPTION("Error While Performing QR Decomposition", rc);
+    }
+
+
+    aOutputQr.ClearUp();
+    aOutputPivot.ClearUp();
+    aOutputQraux.ClearUp();
+
+    aOutputQr.SetSize(row * col);
+    aOutputQr.SetDimensions(row, col);
+    aOutputQr.SetData((char *) pQr_in_out, operation_placement);
+
+    aOutputQraux.SetSize(min_dim);
+    aOutputQraux.SetData((char *) pQraux, operation_placement);
+
+    auto pTemp_pvt = (T *) memory::AllocateArray(col * sizeof(T),
+                                                 operation_placement, context);
+
+
+    memory::Copy <int64_t, T>((char *) pJpvt, (char *) pTemp_pvt, col,
+                              operation_placement);
+
+    memory::ReleaseScratchArray(pJpvt, operation_placement, context);
+
+
+    aOutputPivot.SetSize(col);
+    aOutputPivot.SetData((char *) pTemp_pvt, operation_placement);
+
+    auto pRank = (T *) memory::AllocateArray(1 * sizeof(T), CPU, nullptr);
+    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
+
+
+    helper->GetRank(aOutputQr, *pRank, context);
+
+    aRank.ClearUp();
+    aRank.SetSize(1);
+    aRank.SetData((char *) pRank, CPU);
+
+}
+
+
+template <typename T>
+void
+linear::QRDecompositionR(DataType &aInputA, DataType &aOutput,
+                         const bool &aComplete) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto col = aInputA.GetNCol();
+    auto row = aInputA.GetNRow();
+    auto output_nrows = aComplete ? row : std::min(row, col);
+    auto output_size = output_nrows * col;
+
+    auto pOutput_data = (T *) memory::AllocateArray(output_size * sizeof(T),
+                                                    operation_placement,
+                                                    context);
+
+    aOutput.ClearUp();
+    aOutput.SetSize(output_size);
+    aOutput.SetDimensions(output_nrows, col);
+    aOutput.SetData((char *) pOutput_data, operation_placement);
+
+    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
+    helper->CopyUpperTriangle(aInputA, aOutput, context);
+
+
+}
+
+
+template <typename T>
+void linear::QRDecompositionQ(DataType &aInputA, DataType &aInputB,
+                              DataType &aOutput,
+                              const bool &aComplete) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto mem_transfer = ( operation_placement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+
+    auto row = aInputA.GetNRow();
+    auto col = aInputA.GetNCol();
+    auto pQr_data = (T *) aInputA.GetData(operation_placement);
+    auto pQraux = (T *) aInputB.GetData(operation_placement);
+
+    auto output_nrhs = aComplete ? row : std::min(row, col);
+    auto output_size = row * output_nrhs;
+    auto pOutput_data = memory::AllocateArray(output_size * sizeof(T),
+                                              operation_placement,
+                                              context);
+
+
+    memory::MemCpy((char *) pOutput_data, (char *) pQr_data,
+                   ( output_size * sizeof(T)), context, mem_transfer);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    auto rc = solver->Orgqr(row, output_nrhs, col, (T *) pOutput_data, row,
+                            pQraux);
+
+    if (rc != 0) {
+        memory::DestroyArray(pOutput_data, operation_placement, context);
+        MPCR_API_EXCEPTION("Error While Performing QR.Q", rc);
+    }
+
+    aOutput.ClearUp();
+    aOutput.SetSize(output_size);
+    aOutput.SetDimensions(row, output_nrhs);
+    aOutput.SetData((char *) pOutput_data, operation_placement);
+
+}
+
+
+template <typename T>
+void
+linear::ReciprocalCondition(DataType &aInput, double &aOutput,
+                            const std::string &aNorm, const bool &aTriangle) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto mem_transfer = ( operation_placement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+
+    auto row = aInput.GetNRow();
+    auto col = aInput.GetNCol();
+
+    if (row != col) {
+        MPCR_API_EXCEPTION("Wrong Dimensions for rcond", -1);
+    }
+
+    string norm = aNorm == "I" ? "inf" : "one";
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    T out_temp_val = 0.0f;
+    auto pData = (T *) aInput.GetData(operation_placement);
+
+
+    if (aTriangle) {
+        auto upper_triangle = false;
+        auto unit_triangle = false;
+
+        if (operation_placement == CPU) {
+            auto rc = solver->Trcon(aNorm, upper_triangle, unit_triangle, row,
+                                    pData, col, &out_temp_val);
+            if (rc != 0) {
+                MPCR_API_EXCEPTION("Error While Performing rcond Triangle", rc);
+            }
+        } else {
+            T xnorm = 0;
+            T ynorm = 0;
+
+            auto helper = BackendFactory <T>::CreateHelpersBackend(
+                operation_placement);
+
+            if (norm == "one") {
+                helper->NormMACS(aInput, xnorm, context);
+            } else if (norm == "inf") {
+                helper->NormMARS(aInput, xnorm, context);
+            }
+            auto side_len = aInput.GetNRow();
+            auto pInverse = (T *) memory::AllocateArray(
+                side_len * side_len * sizeof(T), GPU, context);
+            memory::MemCpy((char *) pInverse, aInput.GetData(GPU),
+                           side_len * side_len * sizeof(T), context,
+                           memory::MemoryTransfer::DEVICE_TO_DEVICE);
+
+            auto rc = solver->Trtri(side_len, pInverse, side_len, false);
+
+            if (rc != 0) {
+                memory::DestroyArray((char *&) pInverse, GPU, context);
+                MPCR_API_EXCEPTION("Error While Performing rcond Trtri", rc);
+            }
+            auto data_type = is_double <T>() ? DOUBLE : FLOAT;
+            DataType temp(data_type, GPU);
+            temp.SetSize(side_len * side_len);
+            temp.SetDimensions(side_len, side_len);
+            temp.SetData((char *) pInverse, GPU);
+
+            if (norm == "one") {
+                helper->NormMACS(temp, ynorm, context);
+            } else if (norm == "inf") {
+                helper->NormMARS(temp, ynorm, context);
+            }
+
+            out_temp_val = 1 / ( ynorm * xnorm );
+        }
+
+    } else {
+        T xnorm = 0;
+        T ynorm = 0;
+
+        auto helper = BackendFactory <T>::CreateHelpersBackend(
+            operation_placement);
+
+        if (norm == "one") {
+            helper->NormMACS(aInput, xnorm, context);
+        } else if (norm == "inf") {
+            helper->NormMARS(aInput, xnorm, context);
+        }
+
+        if (operation_placement == CPU) {
+            auto pIpiv = memory::RequestScratchArray(
+                row * sizeof(int64_t), operation_placement, context,
+                MPCR_SCRATCH_PIVOTS);
+            auto pTemp_data = memory::RequestScratchArray(
+                col * row * sizeof(T), operation_placement, context,
+                MPCR_SCRATCH_DATA);
+
+            memory::MemCpy((char *) pTemp_data, (char *) pData,
+                           ( row * col ) * sizeof(T), context, mem_transfer);
+
+
+            auto rc = solver->Getrf(row, col, (T *) pTemp_data, col,
+                                    (int64_t *) pIpiv);
+            if (rc != 0) {
+                memory::ReleaseScratchArray(pIpiv, operation_placement,
+                                            context);
+                memory::ReleaseScratchArray(pTemp_data, operation_placement,
+                                            context);
+
+                MPCR_API_EXCEPTION("Error While Performing rcond getrf", rc);
+            }
+            memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+
+
+            rc = solver->Gecon(aNorm, row, (T *) pTemp_data, col, xnorm,
+                               &out_temp_val);
+
+            if (rc != 0) {
+                memory::ReleaseScratchArray(pTemp_data, operation_placement,
+                                            context);
+                MPCR_API_EXCEPTION("Error While Performing rcond gecon", rc);
+            }
+
+            memory::ReleaseScratchArray(pTemp_data, operation_placement,
+                                        context);
+        } else {
+            auto data_type = is_double <T>() ? DOUBLE : FLOAT;
+            DataType dump(data_type);
+            DataType inverse(data_type);
+            linear::Solve <T>(aInput, dump, inverse, true);
+
+            if (norm == "one") {
+                helper->NormMACS(inverse, ynorm, context);
+            } else if (norm == "inf") {
+                helper->NormMARS(inverse, ynorm, context);
+            }
+
+            out_temp_val = 1 / ( ynorm * xnorm );
+        }
+    }
+
+    aOutput = out_temp_val;
+
+
+}
+
+
+template <typename T>
+void
+linear::QRDecompositionQY(DataType &aInputA, DataType &aInputB,
+                          DataType &aInputC, DataType &aOutput,
+                          const bool &aTranspose) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto mem_transfer = ( operation_placement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+
+    auto row = aInputA.GetNRow();
+    auto col = aInputA.GetNCol();
+    auto is_matrix = aInputC.IsMatrix();
+    auto output_nrow = is_matrix ? aInputC.GetNRow() : aInputC.GetSize();
+    auto output_nrhs = is_matrix ? aInputC.GetNCol() : 1;
+
+    if (output_nrow != row) {
+        MPCR_API_EXCEPTION("Number of rows of y must match the rows of qr",
+                           -1);
+    }
+
+    /* y is only copied (and converted if needed), Q is never formed and the
+     * reflectors are applied directly to the copy */
+    DataType *pConverted = nullptr;
+    auto pInput_c = &aInputC;
+    if (aInputC.GetPrecision() != aInputA.GetPrecision()) {
+        pConverted = new DataType(aInputC, aInputA.GetPrecision());
+        pInput_c = pConverted;
+    }
+
+    auto pQr_data = (T *) aInputA.GetData(operation_placement);
+    auto pQraux = (T *) aInputB.GetData(operation_placement);
+    auto output_size = row * output_nrhs;
+    auto pOutput_data = memory::AllocateArray(output_size * sizeof(T),
+                                              operation_placement,
+                                              context);
+
+    memory::MemCpy((char *) pOutput_data,
+                   pInput_c->GetData(operation_placement),
+                   ( output_size * sizeof(T)), context, mem_transfer);
+    delete pConverted;
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    auto rc = solver->Ormqr(true, aTranspose, row, output_nrhs,
+                            std::min(row, col), pQr_data, row, pQraux,
+                            (T *) pOutput_data, row);
+
+    if (rc != 0) {
+        memory::DestroyArray(pOutput_data, operation_placement, context);
+        MPCR_API_EXCEPTION("Error While Performing QR.QY", rc);
+    }
+
+    aOutput.ClearUp();
+    aOutput.SetSize(output_size);
+    if (is_matrix) {
+        aOutput.SetDimensions(row, output_nrhs);
+    }
+    aOutput.SetData((char *) pOutput_data, operation_placement);
+}
+
+
+template <typename T>
+void
+linear::Determinant(DataType &aInput, double &aModulus, int &aSign,
+                    const bool &aLogarithm) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto operation_placement = context->GetOperationPlacement();
+
+    auto mem_transfer = ( operation_placement == CPU )
+                        ? memory::MemoryTransfer::HOST_TO_HOST
+                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+
+    if (!aInput.IsMatrix() || aInput.GetNRow() != aInput.GetNCol()) {
+        MPCR_API_EXCEPTION(
+            "Cannot calculate determinant for a non-square matrix", -1);
+    }
+
+    auto side_len = aInput.GetNRow();
+    aSign = 1;
+
+    if (side_len == 0) {
+        aModulus = aLogarithm ? 0 : 1;
+        return;
+    }
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
+        operation_placement);
+
+    /** det(A) == det(t(A)), the stored buffer can be used as is **/
+    auto pData = aInput.GetStoredData(operation_placement);
+    auto pIpiv = memory::RequestScratchArray(side_len * sizeof(int64_t),
+                                             operation_placement, context,
+                                             MPCR_SCRATCH_PIVOTS);
+    auto pTemp_data = memory::RequestScratchArray(
+        side_len * side_len * sizeof(T), operation_placement, context,
+        MPCR_SCRATCH_DATA);
+
+    memory::MemCpy(pTemp_data, pData, side_len * side_len * sizeof(T),
+                   context, mem_transfer);
+
+    auto rc = solver->Getrf(side_len, side_len, (T *) pTemp_data, side_len,
+                            (int64_t *) pIpiv);
+
+    if (rc < 0) {
+        memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+        memory::ReleaseScratchArray(pTemp_data, operation_placement, context);
+        MPCR_API_EXCEPTION("Error While Performing determinant getrf", rc);
+    }
+
+    if (rc > 0) {
+        /** Exactly zero pivot, the matrix is singular **/
+        memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+        memory::ReleaseScratchArray(pTemp_data, operation_placement, context);
+        aModulus = aLogarithm ? -std::numeric_limits <double>::infinity() : 0;
+        return;
+    }
+
+    auto pLU = (T *) pTemp_data;
+    auto pPivots = (int64_t *) pIpiv;
+
+    if (operation_placement == GPU) {
+        pLU = (T *) memory::AllocateArray(side_len * side_len * sizeof(T),
+                                          CPU, nullptr);
+        pPivots = (int64_t *) memory::AllocateArray(
+            side_len * sizeof(int64_t), CPU, nullptr);
+
+        memory::MemCpy((char *) pLU, pTemp_data,
+                       side_len * side_len * sizeof(T), context,
+                       memory::MemoryTransfer::DEVICE_TO_HOST);
+        memory::MemCpy((char *) pPivots, pIpiv, side_len * sizeof(int64_t),
+                       context, memory::MemoryTransfer::DEVICE_TO_HOST);
+    }
+
+    /** Accumulate in log space to avoid overflow of the plain product **/
+    double log_modulus = 0;
+    auto negative_count = 0;
+
+    for (auto i = 0; i < side_len; i++) {
+        auto val = (double) pLU[ i + ( i * side_len ) ];
+        if (val < 0) {
+            negative_count++;
+        }
+        if (pPivots[ i ] != i + 1) {
+            negative_count++;
+        }
+        log_modulus += std::log(std::abs(val));
+    }
+
+    aSign = ( negative_count % 2 == 0 ) ? 1 : -1;
+    aModulus = aLogarithm ? log_modulus : std::exp(log_modulus);
+
+    if (operation_placement == GPU) {
+        memory::DestroyArray((char *&) pLU, CPU, nullptr);
+        memory::DestroyArray((char *&) pPivots, CPU, nullptr);
+    }
+
+    memory::ReleaseScratchArray(pIpiv, operation_placement, context);
+    memory::ReleaseScratchArray(pTemp_data, operation_placement, context);
+
+}
+
+
+/**
+ * @brief
+ * Replace the columns of a tall matrix by an orthonormal basis of their span
+ * using a pivoted QR decomposition.
+ *
+ */
+template <typename T>
+int
+OrthonormalizeColumns(linear::LinearAlgebraBackend <T> *aSolver, T *apData,
+                      const size_t &aRow, const size_t &aCol, int64_t *apJpvt,
+                      T *apTau) {
+
+    std::fill(apJpvt, apJpvt + aCol, 0);
+    auto rc = aSolver->Geqp3(aRow, aCol, apData, aRow, apJpvt, apTau);
+    if (rc != 0) {
+        return rc;
     }
+    return aSolver->Orgqr(aRow, aCol, aCol, apData, aRow, apTau);
+}
 
 
+/**
+ * @brief
+ * Apply the centering to a product with the data matrix without forming the
+ * centered matrix, X = X - apLeft %*% t(apRight) for an m x n matrix X.
+ *
+ */
+template <typename T>
+void
+RemoveRankOne(linear::LinearAlgebraBackend <T> *aSolver, T *apData,
+              const size_t &aRow, const size_t &aCol, const T *apLeft,
+              const T *apRight) {
+    aSolver->Ger(aRow, aCol, -1, apLeft, 1, apRight, 1, apData, aRow);
 }
 
 
+/**
+ * @brief
+ * Compute t(X) %*% apVector for an m x n matrix X, or the column sums of X
+ * if apVector is nullptr.
+ *
+ */
 template <typename T>
-void linear::Eigen(DataType &aInput, DataType &aOutputValues,
-                   DataType *apOutputVectors) {
+void
+ProjectColumns(linear::LinearAlgebraBackend <T> *aSolver, const T *apData,
+               const size_t &aRow, const size_t &aCol, const T *apVector,
+               T *apOutput) {
+    if (apVector != nullptr) {
+        aSolver->Gemv(true, aRow, aCol, 1, apData, aRow, apVector, 1, 0,
+                      apOutput, 1);
+        return;
+    }
+    for (auto j = 0; j < aCol; j++) {
+        T sum = 0;
+        for (auto i = 0; i < aRow; i++) {
+            sum += apData[ i + ( j * aRow ) ];
+        }
+        apOutput[ j ] = sum;
+    }
+}
 
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
 
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
+template <typename T>
+void
+linear::RandomizedSVD(DataType &aInputA, DataType &aOutputS,
+                      DataType &aOutputU, DataType &aOutputV,
+                      const size_t &aRank, const size_t &aOversampling,
+                      const size_t &aPowerIterations, const bool &aTranspose,
+                      DataType *apCenter, const size_t &aSeed) {
 
-    if (row != col) {
-        MPCR_API_EXCEPTION("Cannot Perform Eigen on non square Matrix", -1);
+    if (!aInputA.IsMatrix()) {
+        MPCR_API_EXCEPTION("Randomized SVD can only be applied on a Matrix",
+                           -1);
     }
 
+    auto row = aInputA.GetNRow();
+    auto col = aInputA.GetNCol();
+    auto min_dim = std::min(row, col);
 
-    auto jobz_no_vec = true;
-    auto fill_upper = true;
+    if (aRank == 0 || aRank > min_dim) {
+        MPCR_API_EXCEPTION("Rank must be between 1 and min(nrow, ncol)", -1);
+    }
 
-    if (apOutputVectors != nullptr) {
-        jobz_no_vec = false;
+    T *pCenter = nullptr;
+    if (apCenter != nullptr) {
+        if (apCenter->GetSize() != col) {
+            MPCR_API_EXCEPTION(
+                "Center must have one element per column of the Matrix", -1);
+        }
+        pCenter = (T *) apCenter->GetData(CPU);
     }
 
-    auto pData = (T *) aInput.GetData(operation_placement);
+    auto sample = std::min(aRank + aOversampling, min_dim);
+    auto pData = (T *) aInputA.GetData(CPU);
+
+    auto pRange = (T *) memory::AllocateArray(row * sample * sizeof(T), CPU,
+                                              nullptr);
+    auto pProjection = (T *) memory::AllocateArray(col * sample * sizeof(T),
+                                                   CPU, nullptr);
+    auto pSmall_vt = (T *) memory::AllocateArray(sample * sample * sizeof(T),
+                                                 CPU, nullptr);
+    auto pValues = (T *) memory::AllocateArray(sample * sizeof(T), CPU,
+                                               nullptr);
+    auto pShift = (T *) memory::AllocateArray(sample * sizeof(T), CPU,
+                                              nullptr);
+    auto pJpvt = (int64_t *) memory::AllocateArray(sample * sizeof(int64_t),
+                                                   CPU, nullptr);
+
+    auto clean_up = [ & ]() {
+        memory::DestroyArray((char *&) pRange, CPU, nullptr);
+        memory::DestroyArray((char *&) pProjection, CPU, nullptr);
+        memory::DestroyArray((char *&) pSmall_vt, CPU, nullptr);
+        memory::DestroyArray((char *&) pValues, CPU, nullptr);
+        memory::DestroyArray((char *&) pShift, CPU, nullptr);
+        memory::DestroyArray((char *&) pJpvt, CPU, nullptr);
+    };
+
+    /** Gaussian sketch , kept in the projection buffer **/
+    std::mt19937_64 generator(aSeed);
+    std::normal_distribution <double> distribution(0, 1);
+    for (auto i = 0; i < col * sample; i++) {
+        pProjection[ i ] = (T) distribution(generator);
+    }
 
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    auto rc = 0;
 
-    auto pValues = memory::AllocateArray(col * sizeof(T),
-                                         operation_placement, context);
+    /** Y = A Z , centered as Y - 1 t(t(Z) center) **/
+    auto sample_range = [ & ]() {
+        solver->Gemm(false, false, row, sample, col, 1, pData, row,
+                     pProjection, col, 0, pRange, row);
+        if (pCenter != nullptr) {
+            ProjectColumns(solver.get(), pProjection, col, sample, pCenter,
+                           pShift);
+            std::vector <T> ones(row, 1);
+            RemoveRankOne(solver.get(), pRange, row, sample, ones.data(),
+                          pShift);
+        }
+    };
+
+    /** Z = t(A) Q , centered as Z - center t(colSums(Q)) **/
+    auto project_range = [ & ]() {
+        solver->Gemm(true, false, col, sample, row, 1, pData, row, pRange,
+                     row, 0, pProjection, col);
+        if (pCenter != nullptr) {
+            ProjectColumns(solver.get(), pRange, row, sample, (T *) nullptr,
+                           pShift);
+            RemoveRankOne(solver.get(), pProjection, col, sample, pCenter,
+                          pShift);
+        }
+    };
 
-    auto pVectors = memory::AllocateArray(col * col * sizeof(T),
-                                          operation_placement, context);
+    sample_range();
+    rc = OrthonormalizeColumns(solver.get(), pRange, row, sample, pJpvt,
+                               pValues);
 
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    for (auto iter = 0; iter < aPowerIterations && rc == 0; iter++) {
+        project_range();
+        rc = OrthonormalizeColumns(solver.get(), pProjection, col, sample,
+                                   pJpvt, pValues);
+        if (rc != 0) {
+            break;
+        }
+        sample_range();
+        rc = OrthonormalizeColumns(solver.get(), pRange, row, sample, pJpvt,
+                                   pValues);
+    }
 
+    if (rc != 0) {
+        clean_up();
+        MPCR_API_EXCEPTION("Error While Computing the Randomized Range", rc);
+    }
 
-    memory::MemCpy((char *) pVectors, (char *) pData, col * col * sizeof(T),
-                   context, mem_transfer);
+    /**
+     * t(B) = t(A) Q = W S t(Vb), then A ~ Q B = (Q Vb) S t(W), so the left
+     * singular vectors are Q Vb and the right ones are W.
+     **/
+    project_range();
 
-    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
-        operation_placement);
+    auto pOutput_u = (T *) memory::AllocateArray(row * aRank * sizeof(T),
+                                                 CPU, nullptr);
+    auto pOutput_w = (T *) memory::AllocateArray(col * sample * sizeof(T),
+                                                 CPU, nullptr);
 
-    auto rc = solver->Syevd(jobz_no_vec, fill_upper, col, (T *) pVectors, col,
-                            (T *) pValues);
+    rc = solver->SVD('S', col, sample, pProjection, col, pValues, pOutput_w,
+                     col, pSmall_vt, sample);
 
     if (rc != 0) {
-        memory::DestroyArray(pValues, operation_placement, context);
-        memory::DestroyArray(pVectors, operation_placement, context);
-        MPCR_API_EXCEPTION("Error While Performing Eigen", rc);
+        clean_up();
+        memory::DestroyArray((char *&) pOutput_u, CPU, nullptr);
+        memory::DestroyArray((char *&) pOutput_w, CPU, nullptr);
+        MPCR_API_EXCEPTION("Error While Getting SVD", rc);
     }
 
-    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
-
-    if (apOutputVectors) {
-        apOutputVectors->ClearUp();
-        apOutputVectors->SetSize(col * col);
-        apOutputVectors->SetDimensions(col, col);
-        apOutputVectors->SetData((char *) pVectors, operation_placement);
+    solver->Gemm(false, true, row, aRank, sample, 1, pRange, row, pSmall_vt,
+                 sample, 0, pOutput_u, row);
 
-        helper->Reverse(*apOutputVectors, context);
+    auto pOutput_s = (T *) memory::AllocateArray(aRank * sizeof(T), CPU,
+                                                 nullptr);
+    std::copy(pValues, pValues + aRank, pOutput_s);
 
+    T *pOutput_v = nullptr;
+    if (aTranspose) {
+        /** The first aRank columns of W are contiguous **/
+        memory::ReallocateArray((char *&) pOutput_w,
+                                col * sample * sizeof(T),
+                                col * aRank * sizeof(T), CPU, nullptr);
+        pOutput_v = pOutput_w;
     } else {
-        memory::DestroyArray(pVectors, operation_placement, context);
+        pOutput_v = (T *) memory::AllocateArray(col * aRank * sizeof(T), CPU,
+                                                nullptr);
+        for (auto j = 0; j < col; j++) {
+            for (auto i = 0; i < aRank; i++) {
+                pOutput_v[ i + ( j * aRank ) ] = pOutput_w[ j + ( i * col ) ];
+            }
+        }
+        memory::DestroyArray((char *&) pOutput_w, CPU, nullptr);
     }
 
-    aOutputValues.ClearUp();
-    aOutputValues.SetSize(col);
-    aOutputValues.SetData((char *) pValues, operation_placement);
-
-    helper->Reverse(aOutputValues, context);
-
+    clean_up();
 
-}
-
-
-template <typename T>
-void
-linear::Norm(DataType &aInput, const std::string &aType, double &aOutput) {
-
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
+    aOutputS.ClearUp();
+    aOutputU.ClearUp();
+    aOutputV.ClearUp();
 
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
+    aOutputS.SetSize(aRank);
+    aOutputS.SetData((char *) pOutput_s, CPU);
 
-    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
-    T val_out_temp = 0;
+    aOutputU.SetSize(row * aRank);
+    aOutputU.SetDimensions(row, aRank);
+    aOutputU.SetData((char *) pOutput_u, CPU);
 
-    if (row == 0 || col == 0) {
-        val_out_temp = 0.0f;
-    } else if (aType == "O" || aType == "1") {
-        helper->NormMACS(aInput, val_out_temp, context);
-    } else if (aType == "I") {
-        helper->NormMARS(aInput, val_out_temp, context);
-    } else if (aType == "F") {
-        helper->NormEuclidean(aInput, val_out_temp, context);
-    } else if (aType == "M") {
-        helper->NormMaxMod(aInput, val_out_temp, context);
+    aOutputV.SetSize(col * aRank);
+    if (aTranspose) {
+        aOutputV.SetDimensions(col, aRank);
     } else {
-        MPCR_API_EXCEPTION(
-            "Argument must be one of 'M','1','O','I','F' or 'E' ",
-            -1);
+        aOutputV.SetDimensions(aRank, col);
     }
-    aOutput = val_out_temp;
+    aOutputV.SetData((char *) pOutput_v, CPU);
+
 }
 
 
 template <typename T>
 void
-linear::QRDecomposition(DataType &aInputA, DataType &aOutputQr,
-                        DataType &aOutputQraux, DataType &aOutputPivot,
-                        DataType &aRank) {
+linear::PrincipalComponents(DataType &aInput, DataType &aOutputSdev,
+                            DataType &aOutputRotation,
+                            DataType &aOutputCenter, DataType &aOutputScores,
+                            const size_t &aRank, const bool &aCenter,
+                            const size_t &aOversampling,
+                            const size_t &aPowerIterations,
+                            const size_t &aSeed) {
+
+    if (!aInput.IsMatrix()) {
+        MPCR_API_EXCEPTION("PCA can only be applied on a Matrix", -1);
+    }
 
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
+    auto row = aInput.GetNRow();
+    auto col = aInput.GetNCol();
 
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    aOutputCenter.ClearUp();
+    if (aCenter) {
+        auto pData = (T *) aInput.GetData(CPU);
+        auto pCenter = (T *) memory::AllocateArray(col * sizeof(T), CPU,
+                                                   nullptr);
+        auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+        ProjectColumns(solver.get(), pData, row, col, (T *) nullptr, pCenter);
+        for (auto j = 0; j < col; j++) {
+            pCenter[ j ] /= row;
+        }
+        aOutputCenter.SetSize(col);
+        aOutputCenter.SetData((char *) pCenter, CPU);
+    }
 
-    auto col = aInputA.GetNCol();
-    auto row = aInputA.GetNRow();
-    auto min_dim = std::min(col, row);
-    auto pData = (T *) aInputA.GetData(operation_placement);
+    DataType values(aOutputSdev.GetPrecision());
+    RandomizedSVD <T>(aInput, values, aOutputScores, aOutputRotation, aRank,
+                      aOversampling, aPowerIterations, true,
+                      aCenter ? &aOutputCenter : nullptr, aSeed);
+
+    /** Scores are U S , the standard deviations S / sqrt(n - 1) **/
+    auto pValues = (T *) values.GetData(CPU);
+    auto pScores = (T *) aOutputScores.GetData(CPU);
+    auto pSdev = (T *) memory::AllocateArray(aRank * sizeof(T), CPU,
+                                             nullptr);
+    auto scale = std::sqrt((double) std::max(row, (size_t) 2) - 1);
+
+    for (auto j = 0; j < aRank; j++) {
+        for (auto i = 0; i < row; i++) {
+            pScores[ i + ( j * row ) ] *= pValues[ j ];
+        }
+        pSdev[ j ] = (T) ( pValues[ j ] / scale );
+    }
+    aOutputScores.SetData((char *) pScores, CPU);
 
-    auto pQr_in_out = memory::AllocateArray(row * col * sizeof(T),
-                                            operation_placement, context);
-    auto pQraux = memory::AllocateArray(min_dim * sizeof(T),
-                                        operation_placement, context);
-    auto pJpvt = memory::AllocateArray(col * sizeof(int64_t),
-                                       operation_placement,
-                                       context);
+    aOutputSdev.ClearUp();
+    aOutputSdev.SetSize(aRank);
+    aOutputSdev.SetData((char *) pSdev, CPU);
 
+}
 
-    memory::Memset((char *) pJpvt, 0, col * sizeof(int64_t),
-                   operation_placement, context);
 
+template <typename T>
+void
+linear::EigenRange(DataType &aInput, DataType &aOutputValues,
+                   DataType *apOutputVectors, const size_t &aFirstIndex,
+                   const size_t &aLastIndex) {
 
-    memory::MemCpy((char *) pQr_in_out, (char *) pData,
-                   ( aInputA.GetSize()) * sizeof(T), context, mem_transfer);
+    auto col = aInput.GetNCol();
+    auto row = aInput.GetNRow();
 
-    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
-        operation_placement);
+    if (row != col) {
+        MPCR_API_EXCEPTION("Cannot Perform Eigen on non square Matrix", -1);
+    }
 
-    auto rc = solver->Geqp3(row, col, (T *) pQr_in_out, row, (int64_t *) pJpvt,
-                            (T *) pQraux);
+    if (aFirstIndex < 1 || aFirstIndex > aLastIndex || aLastIndex > col) {
+        MPCR_API_EXCEPTION(
+            "Eigen indices must satisfy 1 <= first <= last <= ncol", -1);
+    }
 
-    if (rc != 0) {
-        memory::DestroyArray(pJpvt, operation_placement, context);
-        memory::DestroyArray(pQr_in_out, operation_placement, context);
-        memory::DestroyArray(pQraux, operation_placement, context);
-        MPCR_API_EXCEPTION("Error While Performing QR Decomposition", rc);
+    auto jobz_no_vec = ( apOutputVectors == nullptr );
+    auto count = aLastIndex - aFirstIndex + 1;
+    auto pData = (T *) aInput.GetData(CPU);
+
+    auto pTemp_data = (T *) memory::RequestScratchArray(
+        col * col * sizeof(T), CPU, ContextManager::GetOperationContext(),
+        MPCR_SCRATCH_DATA);
+    std::copy(pData, pData + ( col * col ), pTemp_data);
+
+    /** Syevr counts the eigen values in ascending order **/
+    auto pValues = (T *) memory::AllocateArray(col * sizeof(T), CPU, nullptr);
+    T *pVectors = nullptr;
+    if (!jobz_no_vec) {
+        pVectors = (T *) memory::AllocateArray(col * count * sizeof(T), CPU,
+                                               nullptr);
     }
 
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    int64_t found = 0;
+    auto rc = solver->Syevr(jobz_no_vec, true, col, pTemp_data, col, true, 0,
+                            0, col - aLastIndex + 1, col - aFirstIndex + 1,
+                            found, pValues, pVectors, col);
 
-    aOutputQr.ClearUp();
-    aOutputPivot.ClearUp();
-    aOutputQraux.ClearUp();
+    memory::ReleaseScratchArray((char *&) pTemp_data, CPU,
+                                ContextManager::GetOperationContext());
 
-    aOutputQr.SetSize(row * col);
-    aOutputQr.SetDimensions(row, col);
-    aOutputQr.SetData((char *) pQr_in_out, operation_placement);
+    if (rc != 0 || found != count) {
+        memory::DestroyArray((char *&) pValues, CPU, nullptr);
+        memory::DestroyArray((char *&) pVectors, CPU, nullptr);
+        MPCR_API_EXCEPTION("Error While Performing Eigen", rc);
+    }
 
-    aOutputQraux.SetSize(min_dim);
-    aOutputQraux.SetData((char *) pQraux, operation_placement);
+    auto helper = BackendFactory <T>::CreateHelpersBackend(CPU);
 
-    auto pTemp_pvt = (T *) memory::AllocateArray(col * sizeof(T),
-                                                 operation_placement, context);
+    if (apOutputVectors) {
+        apOutputVectors->ClearUp();
+        apOutputVectors->SetSize(col * count);
+        apOutputVectors->SetDimensions(col, count);
+        apOutputVectors->SetData((char *) pVectors, CPU);
 
+        helper->Reverse(*apOutputVectors, nullptr);
+    }
 
-    memory::Copy <int64_t, T>((char *) pJpvt, (char *) pTemp_pvt, col,
-                              operation_placement);
+    aOutputValues.ClearUp();
+    aOutputValues.SetSize(count);
+    aOutputValues.SetData((char *) pValues, CPU);
 
-    memory::DestroyArray(pJpvt, operation_placement, context);
+    helper->Reverse(aOutputValues, nullptr);
 
+}
 
-    aOutputPivot.SetSize(col);
-    aOutputPivot.SetData((char *) pTemp_pvt, operation_placement);
 
-    auto pRank = (T *) memory::AllocateArray(1 * sizeof(T), CPU, nullptr);
-    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
+/**
+ * @brief
+ * Orthonormalize column aIndex of the n x m basis apBasis against its first
+ * aIndex columns, using two passes of classical Gram-Schmidt with Gemv.
+ * If the column lies in the span of the previous ones, it is replaced by a
+ * random vector.
+ *
+ * @returns
+ * false if no orthogonal direction could be found.
+ *
+ */
+template <typename T>
+bool
+ExtendBasis(linear::LinearAlgebraBackend <T> *aSolver, T *apBasis,
+            const size_t &aRow, const size_t &aIndex, T *apWork,
+            std::mt19937_64 &aGenerator) {
+
+    std::normal_distribution <double> distribution(0, 1);
+    auto pColumn = apBasis + ( aIndex * aRow );
+
+    for (auto attempt = 0; attempt < 3; attempt++) {
+        double norm_before = 0;
+        for (auto i = 0; i < aRow; i++) {
+            norm_before += (double) pColumn[ i ] * pColumn[ i ];
+        }
+        norm_before = std::sqrt(norm_before);
 
+        for (auto pass = 0; pass < 2 && aIndex > 0; pass++) {
+            aSolver->Gemv(true, aRow, aIndex, 1, apBasis, aRow, pColumn, 1, 0,
+                          apWork, 1);
+            aSolver->Gemv(false, aRow, aIndex, -1, apBasis, aRow, apWork, 1, 1,
+                          pColumn, 1);
+        }
 
-    helper->GetRank(aOutputQr, *pRank, context);
+        double norm = 0;
+        for (auto i = 0; i < aRow; i++) {
+            norm += (double) pColumn[ i ] * pColumn[ i ];
+        }
+        norm = std::sqrt(norm);
 
-    aRank.ClearUp();
-    aRank.SetSize(1);
-    aRank.SetData((char *) pRank, CPU);
+        if (norm > norm_before * aRow * std::numeric_limits <T>::epsilon()) {
+            for (auto i = 0; i < aRow; i++) {
+                pColumn[ i ] = (T) ( pColumn[ i ] / norm );
+            }
+            return true;
+        }
 
+        for (auto i = 0; i < aRow; i++) {
+            pColumn[ i ] = (T) distribution(aGenerator);
+        }
+    }
+    return false;
 }
 
 
 template <typename T>
 void
-linear::QRDecompositionR(DataType &aInputA, DataType &aOutput,
-                         const bool &aComplete) {
-
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
+linear::Lanczos(DataType &aInput, DataType &aOutputValues,
+                DataType *apOutputVectors, const size_t &aNumValues,
+                const bool &aLargest, const double &aTolerance,
+                const size_t &aMaxRestarts, const size_t &aSeed) {
 
-    auto col = aInputA.GetNCol();
-    auto row = aInputA.GetNRow();
-    auto output_nrows = aComplete ? row : std::min(row, col);
-    auto output_size = output_nrows * col;
-
-    auto pOutput_data = (T *) memory::AllocateArray(output_size * sizeof(T),
-                                                    operation_placement,
-                                                    context);
-
-    aOutput.ClearUp();
-    aOutput.SetSize(output_size);
-    aOutput.SetDimensions(output_nrows, col);
-    aOutput.SetData((char *) pOutput_data, operation_placement);
+    auto col = aInput.GetNCol();
+    auto row = aInput.GetNRow();
 
-    auto helper = BackendFactory <T>::CreateHelpersBackend(operation_placement);
-    helper->CopyUpperTriangle(aInputA, aOutput, context);
+    if (row != col) {
+        MPCR_API_EXCEPTION("Cannot Perform Eigen on non square Matrix", -1);
+    }
 
+    if (aNumValues == 0 || aNumValues > col) {
+        MPCR_API_EXCEPTION(
+            "Number of eigen values must be between 1 and ncol", -1);
+    }
 
-}
+    auto n = col;
+    auto k = aNumValues;
+    /** Krylov basis size, kept small compared to n **/
+    auto basis_size = std::min(n, std::max(2 * k + 1, k + 20));
+    auto tolerance = std::max(aTolerance, 100.0 *
+                                          std::numeric_limits <T>::epsilon());
+
+    auto pData = (T *) aInput.GetData(CPU);
+    auto pBasis = (T *) memory::AllocateArray(n * ( basis_size + 1 ) *
+                                              sizeof(T), CPU, nullptr);
+    auto pProducts = (T *) memory::AllocateArray(n * basis_size * sizeof(T),
+                                                 CPU, nullptr);
+    auto pProjected = (T *) memory::AllocateArray(
+        basis_size * basis_size * sizeof(T), CPU, nullptr);
+    auto pRitz_values = (T *) memory::AllocateArray(basis_size * sizeof(T),
+                                                    CPU, nullptr);
+    auto pSelected = (T *) memory::AllocateArray(basis_size * k * sizeof(T),
+                                                 CPU, nullptr);
+    auto pRitz_vectors = (T *) memory::AllocateArray(n * k * sizeof(T), CPU,
+                                                     nullptr);
+    auto pRitz_products = (T *) memory::AllocateArray(n * k * sizeof(T), CPU,
+                                                      nullptr);
+    auto pWork = (T *) memory::AllocateArray(( basis_size + 1 ) * sizeof(T),
+                                             CPU, nullptr);
+
+    auto clean_up = [ & ]() {
+        memory::DestroyArray((char *&) pBasis, CPU, nullptr);
+        memory::DestroyArray((char *&) pProducts, CPU, nullptr);
+        memory::DestroyArray((char *&) pProjected, CPU, nullptr);
+        memory::DestroyArray((char *&) pRitz_values, CPU, nullptr);
+        memory::DestroyArray((char *&) pSelected, CPU, nullptr);
+        memory::DestroyArray((char *&) pWork, CPU, nullptr);
+    };
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    std::mt19937_64 generator(aSeed);
+    std::normal_distribution <double> distribution(0, 1);
+
+    for (auto i = 0; i < n; i++) {
+        pBasis[ i ] = (T) distribution(generator);
+    }
+    ExtendBasis(solver.get(), pBasis, n, 0, pWork, generator);
 
+    size_t start = 0;
+    auto converged = false;
+    auto rc = 0;
 
-template <typename T>
-void linear::QRDecompositionQ(DataType &aInputA, DataType &aInputB,
-                              DataType &aOutput,
-                              const bool &aComplete) {
+    for (auto restart = 0; restart <= aMaxRestarts; restart++) {
+
+        /** Expand the basis, keeping A V for the Rayleigh-Ritz projection **/
+        auto extended = true;
+        for (auto j = start; j < basis_size && extended; j++) {
+            solver->Gemv(false, n, n, 1, pData, n, pBasis + ( j * n ), 1, 0,
+                         pProducts + ( j * n ), 1);
+            if (j + 1 < n) {
+                std::copy(pProducts + ( j * n ), pProducts + ( ( j + 1 ) * n ),
+                          pBasis + ( ( j + 1 ) * n ));
+                extended = ExtendBasis(solver.get(), pBasis, n, j + 1, pWork,
+                                       generator);
+            }
+        }
 
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
+        if (!extended) {
+            rc = -1;
+            break;
+        }
 
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+        /** H = t(V) A V , symmetrized , and its eigen decomposition **/
+        solver->Gemm(true, false, basis_size, basis_size, n, 1, pBasis, n,
+                     pProducts, n, 0, pProjected, basis_size);
+        for (auto j = 0; j < basis_size; j++) {
+            for (auto i = 0; i < j; i++) {
+                auto val = ( pProjected[ i + ( j * basis_size ) ] +
+                             pProjected[ j + ( i * basis_size ) ] ) / 2;
+                pProjected[ i + ( j * basis_size ) ] = val;
+                pProjected[ j + ( i * basis_size ) ] = val;
+            }
+        }
 
-    auto row = aInputA.GetNRow();
-    auto col = aInputA.GetNCol();
-    auto pQr_data = (T *) aInputA.GetData(operation_placement);
-    auto pQraux = (T *) aInputB.GetData(operation_placement);
+        rc = solver->Syevd(false, true, basis_size, pProjected, basis_size,
+                           pRitz_values);
+        if (rc != 0) {
+            break;
+        }
 
-    auto output_nrhs = aComplete ? row : std::min(row, col);
-    auto output_size = row * output_nrhs;
-    auto pOutput_data = memory::AllocateArray(output_size * sizeof(T),
-                                              operation_placement,
-                                              context);
+        /** Wanted Ritz pairs in decreasing order of their values **/
+        for (auto i = 0; i < k; i++) {
+            auto idx = aLargest ? basis_size - 1 - i : k - 1 - i;
+            pWork[ i ] = pRitz_values[ idx ];
+            std::copy(pProjected + ( idx * basis_size ),
+                      pProjected + ( ( idx + 1 ) * basis_size ),
+                      pSelected + ( i * basis_size ));
+        }
 
+        solver->Gemm(false, false, n, k, basis_size, 1, pBasis, n, pSelected,
+                     basis_size, 0, pRitz_vectors, n);
+        solver->Gemm(false, false, n, k, basis_size, 1, pProducts, n,
+                     pSelected, basis_size, 0, pRitz_products, n);
 
-    memory::MemCpy((char *) pOutput_data, (char *) pQr_data,
-                   ( output_size * sizeof(T)), context, mem_transfer);
+        /** Residual || A x - theta x || of each wanted pair **/
+        double scale = 0;
+        for (auto i = 0; i < basis_size; i++) {
+            scale = std::max(scale, std::abs((double) pRitz_values[ i ]));
+        }
+        converged = true;
+        for (auto i = 0; i < k && converged; i++) {
+            double residual = 0;
+            for (auto r = 0; r < n; r++) {
+                auto val = (double) pRitz_products[ r + ( i * n ) ] -
+                           (double) pWork[ i ] * pRitz_vectors[ r + ( i * n ) ];
+                residual += val * val;
+            }
+            converged = std::sqrt(residual) <= tolerance * scale;
+        }
 
-    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
-        operation_placement);
+        if (converged || basis_size == n) {
+            converged = true;
+            break;
+        }
 
-    auto rc = solver->Orgqr(row, output_nrhs, col, (T *) pOutput_data, row,
-                            pQraux);
+        /**
+         * Thick restart, the basis keeps the wanted Ritz vectors followed by
+         * the last Lanczos direction, which is orthogonal to all of them.
+         **/
+        std::copy(pBasis + ( basis_size * n ),
+                  pBasis + ( ( basis_size + 1 ) * n ), pBasis + ( k * n ));
+        std::copy(pRitz_vectors, pRitz_vectors + ( n * k ), pBasis);
+        std::copy(pRitz_products, pRitz_products + ( n * k ), pProducts);
+        if (!ExtendBasis(solver.get(), pBasis, n, k, pWork, generator)) {
+            rc = -1;
+            break;
+        }
+        start = k;
+    }
 
-    if (rc != 0) {
-        memory::DestroyArray(pOutput_data, operation_placement, context);
-        MPCR_API_EXCEPTION("Error While Performing QR.Q", rc);
+    if (rc != 0 || !converged) {
+        clean_up();
+        memory::DestroyArray((char *&) pRitz_vectors, CPU, nullptr);
+        memory::DestroyArray((char *&) pRitz_products, CPU, nullptr);
+        MPCR_API_EXCEPTION("Lanczos iteration did not converge", rc);
     }
 
-    aOutput.ClearUp();
-    aOutput.SetSize(output_size);
-    aOutput.SetDimensions(row, output_nrhs);
-    aOutput.SetData((char *) pOutput_data, operation_placement);
+    auto pValues = (T *) memory::AllocateArray(k * sizeof(T), CPU, nullptr);
+    std::copy(pWork, pWork + k, pValues);
+    clean_up();
+    memory::DestroyArray((char *&) pRitz_products, CPU, nullptr);
+
+    aOutputValues.ClearUp();
+    aOutputValues.SetSize(k);
+    aOutputValues.SetData((char *) pValues, CPU);
+
+    if (apOutputVectors) {
+        apOutputVectors->ClearUp();
+        apOutputVectors->SetSize(n * k);
+        apOutputVectors->SetDimensions(n, k);
+        apOutputVectors->SetData((char *) pRitz_vectors, CPU);
+    } else {
+        memory::DestroyArray((char *&) pRitz_vectors, CPU, nullptr);
+    }
 
 }
 
 
-template <typename T>
+/**
+ * @brief
+ * Solve the least squares problem of linear::LeastSquares with the factors
+ * computed in the working precision W, while X, Y, the residuals and the
+ * coefficients stay in the precision T. Each pass solves the problem for the
+ * current residual and adds the correction to B, so with W == T a single pass
+ * is the plain solve and with a lower W the passes are the iterative
+ * refinement.
+ *
+ */
+template <typename T, typename W>
 void
-linear::ReciprocalCondition(DataType &aInput, double &aOutput,
-                            const std::string &aNorm, const bool &aTriangle) {
+LeastSquaresSolver(const T *apX, const T *apY, const T *apWeights,
+                   const size_t &aRow, const size_t &aCol, const size_t &aNrhs,
+                   const double &aLambda, const std::string &aMethod,
+                   const double &aTolerance, T *apCoefficients,
+                   T *apResiduals, size_t &aRank) {
 
     auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
-
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    auto solver = BackendFactory <W>::CreateLinearAlgebraBackend(CPU);
+    auto solver_refine = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    constexpr bool refine = !std::is_same <T, W>::value;
+
+    std::vector <T> sqrt_weights;
+    if (apWeights) {
+        sqrt_weights.resize(aRow);
+        for (auto i = 0; i < aRow; i++) {
+            sqrt_weights[ i ] = std::sqrt(apWeights[ i ]);
+        }
+    }
 
-    auto row = aInput.GetNRow();
-    auto col = aInput.GetNCol();
+    /* W^(1/2) X in the working precision, with leading dimension aLd */
+    auto fill_weighted = [ & ](W *apOutput, const size_t &aLd) {
+        for (auto j = 0; j < aCol; j++) {
+            for (auto i = 0; i < aRow; i++) {
+                auto val = apX[ i + ( j * aRow ) ];
+                apOutput[ i + ( j * aLd ) ] = (W) ( apWeights ?
+                                                    val * sqrt_weights[ i ]
+                                                              : val );
+            }
+        }
+    };
+
+    W *pFactor = nullptr;
+    auto use_qr = ( aMethod == "qr" );
+    auto ld_factor = aCol;
+
+    if (!use_qr) {
+        /* Normal equations t(X) W X + lambda I at the head of the buffer, the
+         * weighted or demoted copy of X right after it, X is used in place
+         * when it needs neither */
+        auto copy_x = ( refine || apWeights );
+        pFactor = (W *) memory::RequestScratchArray(
+            ( aCol + ( copy_x ? aRow : 0 ) ) * aCol * sizeof(W), CPU, context,
+            MPCR_SCRATCH_DATA);
+
+        const W *pX_working;
+        if (!copy_x) {
+            pX_working = (const W *) apX;
+        } else {
+            fill_weighted(pFactor + ( aCol * aCol ), aRow);
+            pX_working = pFactor + ( aCol * aCol );
+        }
+        solver->Syrk(false, true, aCol, aRow, 1, pX_working, aRow, 0,
+                     pFactor, aCol);
+
+        W norm = 0;
+        for (auto j = 0; j < aCol; j++) {
+            pFactor[ j + ( j * aCol ) ] += aLambda;
+            W sum = 0;
+            for (auto i = 0; i < aCol; i++) {
+                sum += std::abs(i <= j ? pFactor[ i + ( j * aCol ) ]
+                                       : pFactor[ j + ( i * aCol ) ]);
+            }
+            norm = std::max(norm, sum);
+        }
 
-    if (row != col) {
-        MPCR_API_EXCEPTION("Wrong Dimensions for rcond", -1);
+        auto rc = solver->Potrf(true, aCol, pFactor, aCol);
+        W rcond = 0;
+        if (rc == 0) {
+            solver->Pocon(true, aCol, pFactor, aCol, norm, &rcond);
+        } else if (aMethod == "chol") {
+            memory::ReleaseScratchArray((char *&) pFactor, CPU, context);
+            MPCR_API_EXCEPTION(
+                "Normal equations are not positive definite, use method qr",
+                rc);
+        }
+        use_qr = ( aMethod != "chol" &&
+                   rcond < std::sqrt(std::numeric_limits <W>::epsilon()));
     }
 
-    string norm = aNorm == "I" ? "inf" : "one";
+    /* QR of W^(1/2) X, stacked over sqrt(lambda) I for a ridge fit */
+    auto row_qr = aRow + ( aLambda > 0 ? aCol : 0 );
+    auto num_reflectors = std::min(row_qr, aCol);
+    std::vector <W> tau;
+    int64_t *pPivots = nullptr;
+    aRank = aCol;
+
+    if (use_qr) {
+        /* The Cholesky buffer (if any) is too small for the copy of X */
+        if (pFactor != nullptr) {
+            memory::ReleaseScratchArray((char *&) pFactor, CPU, context);
+        }
+        pFactor = (W *) memory::RequestScratchArray(
+            row_qr * aCol * sizeof(W), CPU, context, MPCR_SCRATCH_DATA);
+        ld_factor = row_qr;
+        fill_weighted(pFactor, row_qr);
+        for (auto j = 0; j < aCol; j++) {
+            std::fill(pFactor + ( j * row_qr ) + aRow,
+                      pFactor + ( ( j + 1 ) * row_qr ), 0);
+        }
+        for (auto j = 0; j < row_qr - aRow; j++) {
+            pFactor[ aRow + j + ( j * row_qr ) ] = std::sqrt(aLambda);
+        }
 
-    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
-        operation_placement);
+        pPivots = (int64_t *) memory::RequestScratchArray(
+            aCol * sizeof(int64_t), CPU, context, MPCR_SCRATCH_PIVOTS);
+        std::fill(pPivots, pPivots + aCol, 0);
+        tau.resize(num_reflectors);
 
-    T out_temp_val = 0.0f;
-    auto pData = (T *) aInput.GetData(operation_placement);
+        auto rc = solver->Geqp3(row_qr, aCol, pFactor, row_qr, pPivots,
+                                tau.data());
+        if (rc != 0) {
+            memory::ReleaseScratchArray((char *&) pFactor, CPU, context);
+            memory::ReleaseScratchArray((char *&) pPivots, CPU, context);
+            MPCR_API_EXCEPTION("Error While Performing QR", rc);
+        }
 
+        aRank = 0;
+        auto limit = aTolerance * std::abs(pFactor[ 0 ]);
+        while (aRank < num_reflectors &&
+               std::abs(pFactor[ aRank + ( aRank * row_qr ) ]) > limit) {
+            aRank++;
+        }
+    }
 
-    if (aTriangle) {
-        auto upper_triangle = false;
-        auto unit_triangle = false;
+    /* The first QR pass applies t(Q) to Y, every other pass solves the
+     * seminormal equations t(R) R D = t(X) W (Y - X B) - lambda B with the
+     * gradient formed in T, which keeps converging when the residual of
+     * the fit is large */
+    auto work_rows = use_qr ? row_qr : aCol;
+    std::vector <T> gradient(aCol * aNrhs);
+    std::vector <W> correction(work_rows * aNrhs);
+    std::fill(apCoefficients, apCoefficients + ( aCol * aNrhs ), 0);
+
+    auto max_passes = refine ? 30 : 1;
+    T last_update = std::numeric_limits <T>::max();
+
+    for (auto pass = 0; pass < max_passes; pass++) {
+
+        /* residuals = Y - X B */
+        std::copy(apY, apY + ( aRow * aNrhs ), apResiduals);
+        if (pass > 0) {
+            solver_refine->Gemm(false, false, aRow, aNrhs, aCol, -1, apX, aRow,
+                                apCoefficients, aCol, 1, apResiduals, aRow);
+        }
 
-        if (operation_placement == CPU) {
-            auto rc = solver->Trcon(aNorm, upper_triangle, unit_triangle, row,
-                                    pData, col, &out_temp_val);
-            if (rc != 0) {
-                MPCR_API_EXCEPTION("Error While Performing rcond Triangle", rc);
+        if (use_qr && pass == 0) {
+            /* t(Q) [ W^(1/2) Y ; 0 ] */
+            std::fill(correction.begin(), correction.end(), 0);
+            for (auto j = 0; j < aNrhs; j++) {
+                for (auto i = 0; i < aRow; i++) {
+                    auto val = apResiduals[ i + ( j * aRow ) ];
+                    correction[ i + ( j * row_qr ) ] = (W) ( apWeights ?
+                                                             val *
+                                                             sqrt_weights[ i ]
+                                                                       : val );
+                }
             }
+            solver->Ormqr(true, true, row_qr, aNrhs, num_reflectors, pFactor,
+                          row_qr, tau.data(), correction.data(), row_qr);
         } else {
-            T xnorm = 0;
-            T ynorm = 0;
+            if (apWeights) {
+                for (auto j = 0; j < aNrhs; j++) {
+                    for (auto i = 0; i < aRow; i++) {
+                        apResiduals[ i + ( j * aRow ) ] *= apWeights[ i ];
+                    }
+                }
+            }
+            solver_refine->Gemm(true, false, aCol, aNrhs, aRow, 1, apX, aRow,
+                                apResiduals, aRow, 0, gradient.data(), aCol);
+            for (auto j = 0; j < aNrhs; j++) {
+                for (auto i = 0; i < aRank; i++) {
+                    auto idx = ( use_qr ? pPivots[ i ] - 1 : i ) +
+                               ( j * aCol );
+                    correction[ i + ( j * work_rows ) ] = (W) (
+                        gradient[ idx ] - aLambda * apCoefficients[ idx ] );
+                }
+            }
+            if (aRank > 0) {
+                solver->Trsm(true, true, true, aRank, aNrhs, 1, pFactor,
+                             ld_factor, correction.data(), work_rows);
+            }
+        }
 
-            auto helper = BackendFactory <T>::CreateHelpersBackend(
-                operation_placement);
+        if (aRank > 0) {
+            solver->Trsm(true, true, false, aRank, aNrhs, 1, pFactor,
+                         ld_factor, correction.data(), work_rows);
+        }
 
-            if (norm == "one") {
-                helper->NormMACS(aInput, xnorm, context);
-            } else if (norm == "inf") {
-                helper->NormMARS(aInput, xnorm, context);
+        T update = 0;
+        T scale = 0;
+        for (auto j = 0; j < aNrhs; j++) {
+            for (auto i = 0; i < aRank; i++) {
+                auto idx = ( use_qr ? pPivots[ i ] - 1 : i ) + ( j * aCol );
+                T val = correction[ i + ( j * work_rows ) ];
+                apCoefficients[ idx ] += val;
+                update = std::max(update, std::abs(val));
+                scale = std::max(scale, std::abs(apCoefficients[ idx ]));
             }
-            auto side_len = aInput.GetNRow();
-            auto pInverse = (T *) memory::AllocateArray(
-                side_len * side_len * sizeof(T), GPU, context);
-            memory::MemCpy((char *) pInverse, aInput.GetData(GPU),
-                           side_len * side_len * sizeof(T), context,
-                           memory::MemoryTransfer::DEVICE_TO_DEVICE);
+        }
 
-            auto rc = solver->Trtri(side_len, pInverse, side_len, false);
+        /* Stop once the correction is at the precision of T, or when it
+         * stops shrinking */
+        if (update <= std::numeric_limits <T>::epsilon() * scale ||
+            ( pass > 0 && update >= last_update )) {
+            break;
+        }
+        last_update = update;
+    }
 
-            if (rc != 0) {
-                memory::DestroyArray((char *&) pInverse, GPU, context);
-                MPCR_API_EXCEPTION("Error While Performing rcond Trtri", rc);
-            }
-            auto data_type = is_double <T>() ? DOUBLE : FLOAT;
-            DataType temp(data_type, GPU);
-            temp.SetSize(side_len * side_len);
-            temp.SetDimensions(side_len, side_len);
-            temp.SetData((char *) pInverse, GPU);
+    std::copy(apY, apY + ( aRow * aNrhs ), apResiduals);
+    solver_refine->Gemm(false, false, aRow, aNrhs, aCol, -1, apX, aRow,
+                        apCoefficients, aCol, 1, apResiduals, aRow);
 
-            if (norm == "one") {
-                helper->NormMACS(temp, ynorm, context);
-            } else if (norm == "inf") {
-                helper->NormMARS(temp, ynorm, context);
+    if (use_qr) {
+        for (auto j = 0; j < aNrhs; j++) {
+            for (auto i = aRank; i < aCol; i++) {
+                apCoefficients[ pPivots[ i ] - 1 + ( j * aCol ) ] =
+                    std::numeric_limits <T>::quiet_NaN();
             }
-
-            out_temp_val = 1 / ( ynorm * xnorm );
         }
+        memory::ReleaseScratchArray((char *&) pPivots, CPU, context);
+    }
+    memory::ReleaseScratchArray((char *&) pFactor, CPU, context);
+}
 
-    } else {
-        T xnorm = 0;
-        T ynorm = 0;
 
-        auto helper = BackendFactory <T>::CreateHelpersBackend(
-            operation_placement);
+template <typename T>
+void
+linear::LeastSquares(DataType &aInputX, DataType &aInputY,
+                     DataType *apWeights, DataType &aCoefficients,
+                     DataType &aResiduals, size_t &aRank,
+                     const double &aLambda, const std::string &aMethod,
+                     const std::string &aInternalPrecision,
+                     const double &aTolerance) {
+
+    auto x_matrix = aInputX.IsMatrix();
+    auto row = x_matrix ? aInputX.GetNRow() : aInputX.GetSize();
+    auto col = x_matrix ? aInputX.GetNCol() : 1;
+    auto y_matrix = aInputY.IsMatrix();
+    auto y_row = y_matrix ? aInputY.GetNRow() : aInputY.GetSize();
+    auto nrhs = y_matrix ? aInputY.GetNCol() : 1;
+
+    if (row == 0 || col == 0 || y_row != row) {
+        MPCR_API_EXCEPTION("Number of rows of x and y must match", -1);
+    }
 
-        if (norm == "one") {
-            helper->NormMACS(aInput, xnorm, context);
-        } else if (norm == "inf") {
-            helper->NormMARS(aInput, xnorm, context);
+    if (aMethod != "auto" && aMethod != "qr" && aMethod != "chol") {
+        MPCR_API_EXCEPTION("Method must be auto, qr or chol", -1);
+    }
+
+    if (aLambda < 0) {
+        MPCR_API_EXCEPTION("Ridge penalty must be non-negative", -1);
+    }
+
+    if (apWeights && apWeights->GetSize() != row) {
+        MPCR_API_EXCEPTION("Number of weights must match the rows of x", -1);
+    }
+
+    auto demote = IsReducedInternalPrecision <T>(aInternalPrecision, CPU);
+
+    /* Y and the weights follow the precision of X */
+    auto precision = aInputX.GetPrecision();
+    DataType *pConverted_y = nullptr;
+    DataType *pConverted_w = nullptr;
+    auto pInput_y = &aInputY;
+    auto pInput_w = apWeights;
+    if (aInputY.GetPrecision() != precision) {
+        pConverted_y = new DataType(aInputY, precision);
+        pInput_y = pConverted_y;
+    }
+    if (apWeights && apWeights->GetPrecision() != precision) {
+        pConverted_w = new DataType(*apWeights, precision);
+        pInput_w = pConverted_w;
+    }
+
+    auto pX = (T *) aInputX.GetData(CPU);
+    auto pY = (T *) pInput_y->GetData(CPU);
+    T *pWeights = pInput_w ? (T *) pInput_w->GetData(CPU) : nullptr;
+
+    auto pCoefficients = (T *) memory::AllocateArray(
+        col * nrhs * sizeof(T), CPU, nullptr);
+    auto pResiduals = (T *) memory::AllocateArray(row * nrhs * sizeof(T), CPU,
+                                                  nullptr);
+
+    try {
+        if (pWeights) {
+            for (auto i = 0; i < row; i++) {
+                if (pWeights[ i ] < 0) {
+                    MPCR_API_EXCEPTION("Weights must be non-negative", -1);
+                }
+            }
         }
 
-        if (operation_placement == CPU) {
-            auto pIpiv = memory::AllocateArray(row * sizeof(int64_t),
-                                               operation_placement,
-                                               context);
-            auto pTemp_data = memory::AllocateArray(col * row * sizeof(T),
-                                                    operation_placement,
-                                                    context);
+        if (demote) {
+            LeastSquaresSolver <T, float>(pX, pY, pWeights, row, col, nrhs,
+                                          aLambda, aMethod, aTolerance,
+                                          pCoefficients, pResiduals, aRank);
+        } else {
+            LeastSquaresSolver <T, T>(pX, pY, pWeights, row, col, nrhs,
+                                      aLambda, aMethod, aTolerance,
+                                      pCoefficients, pResiduals, aRank);
+        }
+    } catch (...) {
+        delete pConverted_y;
+        delete pConverted_w;
+        memory::DestroyArray((char *&) pCoefficients, CPU, nullptr);
+        memory::DestroyArray((char *&) pResiduals, CPU, nullptr);
+        throw;
+    }
 
-            memory::MemCpy((char *) pTemp_data, (char *) pData,
-                           ( row * col ) * sizeof(T), context, mem_transfer);
+    delete pConverted_y;
+    delete pConverted_w;
 
+    aCoefficients.ClearUp();
+    aCoefficients.SetSize(col * nrhs);
+    if (y_matrix) {
+        aCoefficients.SetDimensions(col, nrhs);
+    }
+    aCoefficients.SetData((char *) pCoefficients, CPU);
 
-            auto rc = solver->Getrf(row, col, (T *) pTemp_data, col,
-                                    (int64_t *) pIpiv);
-            if (rc != 0) {
-                memory::DestroyArray(pIpiv, operation_placement, context);
-                memory::DestroyArray(pTemp_data, operation_placement, context);
+    aResiduals.ClearUp();
+    aResiduals.SetSize(row * nrhs);
+    if (y_matrix) {
+        aResiduals.SetDimensions(row, nrhs);
+    }
+    aResiduals.SetData((char *) pResiduals, CPU);
 
-                MPCR_API_EXCEPTION("Error While Performing rcond getrf", rc);
-            }
-            memory::DestroyArray(pIpiv, operation_placement, context);
+}
 
 
-            rc = solver->Gecon(aNorm, row, (T *) pTemp_data, col, xnorm,
-                               &out_temp_val);
+/**
+ * @brief
+ * Binary reduction tree of the TSQR, node k stacks the R factors of its two
+ * children (leaves first, then earlier nodes) into a 2w x w matrix and keeps
+ * its Householder reflectors for forming Q.
+ *
+ */
+template <typename T>
+struct TSQRTree {
+    /** Compact QR of each node, 2w x w **/
+    std::vector <std::vector <T>> mNodes;
+    /** Scalar factors of the reflectors of each node **/
+    std::vector <std::vector <T>> mTau;
+    /** Children of each node, ids below the number of leaves are leaves **/
+    std::vector <std::pair <size_t, size_t>> mChildren;
+};
 
-            if (rc != 0) {
-                memory::DestroyArray(pIpiv, operation_placement, context);
-                memory::DestroyArray(pTemp_data, operation_placement, context);
-                MPCR_API_EXCEPTION("Error While Performing rcond gecon", rc);
-            }
 
-            memory::DestroyArray(pTemp_data, operation_placement, context);
+/**
+ * @brief
+ * Reduce the w x w R factors of the leaves level by level, the nodes of a
+ * level are factorized in parallel. The caller keeps BLAS sequential.
+ *
+ * @returns
+ * id of the root, either a leaf or leaves + node index.
+ *
+ */
+template <typename T>
+size_t
+ReduceTSQRTree(linear::LinearAlgebraBackend <T> *aSolver,
+               const std::vector <T *> &aLeaves,
+               const std::vector <size_t> &aLeavesLd, const size_t &aWidth,
+               TSQRTree <T> &aTree) {
+
+    auto num_leaves = aLeaves.size();
+    auto get_r = [ & ](const size_t &aId, const T *&apData, size_t &aLd) {
+        if (aId < num_leaves) {
+            apData = aLeaves[ aId ];
+            aLd = aLeavesLd[ aId ];
         } else {
-            auto data_type = is_double <T>() ? DOUBLE : FLOAT;
-            DataType dump(data_type);
-            DataType inverse(data_type);
-            linear::Solve <T>(aInput, dump, inverse, true);
+            apData = aTree.mNodes[ aId - num_leaves ].data();
+            aLd = 2 * aWidth;
+        }
+    };
 
-            if (norm == "one") {
-                helper->NormMACS(inverse, ynorm, context);
-            } else if (norm == "inf") {
-                helper->NormMARS(inverse, ynorm, context);
-            }
+    std::vector <size_t> active(num_leaves);
+    for (auto i = 0; i < num_leaves; i++) {
+        active[ i ] = i;
+    }
 
-            out_temp_val = 1 / ( ynorm * xnorm );
+    while (active.size() > 1) {
+        auto num_pairs = active.size() / 2;
+        auto first_node = aTree.mNodes.size();
+        std::vector <size_t> next;
+        for (auto k = 0; k < num_pairs; k++) {
+            aTree.mNodes.emplace_back(2 * aWidth * aWidth, 0);
+            aTree.mTau.emplace_back(aWidth);
+            aTree.mChildren.emplace_back(active[ 2 * k ],
+                                         active[ ( 2 * k ) + 1 ]);
+            next.push_back(num_leaves + first_node + k);
+        }
+        if (active.size() % 2) {
+            next.push_back(active.back());
         }
-    }
 
-    aOutput = out_temp_val;
+        auto rc = 0;
+#pragma omp parallel for
+        for (size_t k = 0; k < num_pairs; k++) {
+            auto &node = aTree.mNodes[ first_node + k ];
+            auto children = aTree.mChildren[ first_node + k ];
+            for (auto half = 0; half < 2; half++) {
+                const T *pR;
+                size_t ld;
+                get_r(half ? children.second : children.first, pR, ld);
+                for (auto j = 0; j < aWidth; j++) {
+                    for (auto i = 0; i <= j; i++) {
+                        node[ i + ( half * aWidth ) + ( j * 2 * aWidth ) ] =
+                            pR[ i + ( j * ld ) ];
+                    }
+                }
+            }
+            auto rc_node = aSolver->Geqrf(2 * aWidth, aWidth, node.data(),
+                                          2 * aWidth,
+                                          aTree.mTau[ first_node + k ].data());
+            if (rc_node != 0) {
+#pragma omp critical
+                rc = rc_node;
+            }
+        }
 
+        if (rc != 0) {
+            MPCR_API_EXCEPTION("Error While Performing TSQR", rc);
+        }
+        active = next;
+    }
 
+    return active[ 0 ];
 }
 
 
 template <typename T>
 void
-linear::QRDecompositionQY(DataType &aInputA, DataType &aInputB,
-                          DataType &aInputC, DataType &aOutput,
-                          const bool &aTranspose) {
+linear::TSQR(DataType &aInput, DataType &aOutputR, DataType *apOutputQ,
+             DataType *apInputY, DataType *apOutputQty,
+             const size_t &aBlockRows) {
 
-    auto context = ContextManager::GetOperationContext();
-    auto operation_placement = context->GetOperationPlacement();
+    auto row = aInput.GetNRow();
+    auto col = aInput.GetNCol();
+    auto y_matrix = apInputY && apInputY->IsMatrix();
+    auto nrhs = apInputY ? ( y_matrix ? apInputY->GetNCol() : 1 ) : 0;
+    auto y_row = y_matrix ? apInputY->GetNRow()
+                          : ( apInputY ? apInputY->GetSize() : row );
 
-    auto mem_transfer = ( operation_placement == CPU )
-                        ? memory::MemoryTransfer::HOST_TO_HOST
-                        : memory::MemoryTransfer::DEVICE_TO_DEVICE;
+    if (apInputY && !apOutputQty) {
+        MPCR_API_EXCEPTION("An output is needed for t(Q) %*% y", -1);
+    }
 
-    auto row = aInputA.GetNRow();
-    auto col = aInputA.GetNCol();
-    auto pQr_data = (T *) aInputA.GetData(operation_placement);
-    auto pQraux = (T *) aInputB.GetData(operation_placement);
+    if (y_row != row) {
+        MPCR_API_EXCEPTION("Number of rows of x and y must match", -1);
+    }
 
-    auto output_nrhs = aInputC.GetNCol();
-    auto output_size = row * output_nrhs;
-    auto pOutput_data = memory::AllocateArray(output_size * sizeof(T),
-                                              operation_placement,
-                                              context);
+    /* Without Q, Y is appended to the columns of A and rides along */
+    auto width = apOutputQ ? col : col + nrhs;
+    if (!aInput.IsMatrix() || col == 0 || row < width) {
+        MPCR_API_EXCEPTION(
+            "TSQR needs a matrix with at least as many rows as cols", -1);
+    }
 
-    memory::MemCpy((char *) pOutput_data, (char *) pQr_data,
-                   ( output_size * sizeof(T)), context, mem_transfer);
+    DataType *pConverted = nullptr;
+    auto pInput_y = apInputY;
+    if (apInputY && apInputY->GetPrecision() != aInput.GetPrecision()) {
+        pConverted = new DataType(*apInputY, aInput.GetPrecision());
+        pInput_y = pConverted;
+    }
 
-    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(
-        operation_placement);
+    auto pData = (T *) aInput.GetData(CPU);
+    auto pY = pInput_y ? (T *) pInput_y->GetData(CPU) : nullptr;
 
-    auto rc = solver->Orgqr(row, output_nrhs, col, (T *) pOutput_data, row,
-                            pQraux);
+    auto block_rows = aBlockRows;
+    if (block_rows == 0) {
+        auto cores = (size_t) std::max(1, kernels::GetMaxThreads());
+        block_rows = ( row + cores - 1 ) / cores;
+    }
+    block_rows = std::max(block_rows, width);
+    auto num_blocks = std::max(row / block_rows, (size_t) 1);
+
+    /* The last block absorbs the remaining rows */
+    auto block_start = [ & ](const size_t &aBlock) {
+        return aBlock * block_rows;
+    };
+    auto block_size = [ & ](const size_t &aBlock) {
+        return ( aBlock == num_blocks - 1 ) ? row - ( aBlock * block_rows )
+                                            : block_rows;
+    };
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    std::vector <T *> leaves(num_blocks);
+    std::vector <size_t> leaves_ld(num_blocks);
+    std::vector <std::vector <T>> leaves_tau(num_blocks,
+                                             std::vector <T>(width));
+    std::vector <std::vector <T>> leaves_r;
+    T *pQ = nullptr;
+    auto rc = 0;
+    /* Blocks and tree nodes are factorized on every core, the LAPACK calls
+     * inside them stay sequential */
+    kernels::SequentialBlasScope sequential_blas;
+
+    if (apOutputQ) {
+        /* Blocks are factorized in place inside the output Q */
+        pQ = (T *) memory::AllocateArray(row * col * sizeof(T), CPU, nullptr);
+        std::copy(pData, pData + ( row * col ), pQ);
+
+#pragma omp parallel for schedule(dynamic)
+        for (size_t b = 0; b < num_blocks; b++) {
+            leaves[ b ] = pQ + block_start(b);
+            leaves_ld[ b ] = row;
+            auto rc_block = solver->Geqrf(block_size(b), col, leaves[ b ], row,
+                                          leaves_tau[ b ].data());
+            if (rc_block != 0) {
+#pragma omp critical
+                rc = rc_block;
+            }
+        }
+    } else {
+        /* Each block is streamed through a panel under its running R */
+        auto panel_rows = std::max(4 * width, (size_t) 1024);
+        auto ld_panel = width + panel_rows;
+        leaves_r.resize(num_blocks);
+
+#pragma omp parallel for schedule(dynamic)
+        for (size_t b = 0; b < num_blocks; b++) {
+            std::vector <T> panel(ld_panel * width);
+            size_t filled = 0;
+            auto end = block_start(b) + block_size(b);
+            for (auto start = block_start(b); start < end;
+                 start += panel_rows) {
+                auto count = std::min(panel_rows, end - start);
+                for (auto j = 0; j < width; j++) {
+                    auto pSource = ( j < col ) ? pData + ( j * row )
+                                               : pY + ( ( j - col ) * row );
+                    std::copy(pSource + start, pSource + start + count,
+                              panel.data() + filled + ( j * ld_panel ));
+                }
+                auto rc_block = solver->Geqrf(filled + count, width,
+                                              panel.data(), ld_panel,
+                                              leaves_tau[ b ].data());
+                if (rc_block != 0) {
+#pragma omp critical
+                    rc = rc_block;
+                }
+                filled = width;
+                for (auto j = 0; j < width; j++) {
+                    std::fill(panel.data() + ( j * ld_panel ) + j + 1,
+                              panel.data() + ( j * ld_panel ) + width, 0);
+                }
+            }
+            leaves_r[ b ].resize(width * width);
+            for (auto j = 0; j < width; j++) {
+                std::copy(panel.data() + ( j * ld_panel ),
+                          panel.data() + ( j * ld_panel ) + width,
+                          leaves_r[ b ].data() + ( j * width ));
+            }
+            leaves[ b ] = leaves_r[ b ].data();
+            leaves_ld[ b ] = width;
+        }
+    }
 
     if (rc != 0) {
-        memory::DestroyArray(pOutput_data, operation_placement, context);
-        MPCR_API_EXCEPTION("Error While Performing QR.QY", rc);
+        delete pConverted;
+        memory::DestroyArray((char *&) pQ, CPU, nullptr);
+        MPCR_API_EXCEPTION("Error While Performing TSQR", rc);
     }
 
-    aOutput.ClearUp();
-    aOutput.SetSize(output_size);
-    aOutput.SetDimensions(row, output_nrhs);
-    aOutput.SetData((char *) pOutput_data, operation_placement);
+    TSQRTree <T> tree;
+    size_t root;
+    try {
+        root = ReduceTSQRTree(solver.get(), leaves, leaves_ld, width, tree);
+    } catch (...) {
+        delete pConverted;
+        memory::DestroyArray((char *&) pQ, CPU, nullptr);
+        throw;
+    }
+
+    const T *pRoot = ( root < num_blocks ) ? leaves[ root ]
+                                           : tree.mNodes[ root -
+                                                          num_blocks ].data();
+    auto ld_root = ( root < num_blocks ) ? leaves_ld[ root ] : 2 * width;
+
+    auto pR = (T *) memory::AllocateArray(col * col * sizeof(T), CPU, nullptr);
+    for (auto j = 0; j < col; j++) {
+        for (auto i = 0; i < col; i++) {
+            pR[ i + ( j * col ) ] = ( i <= j ) ? pRoot[ i + ( j * ld_root ) ]
+                                               : 0;
+        }
+    }
+
+    T *pQty = nullptr;
+    if (apInputY) {
+        pQty = (T *) memory::AllocateArray(col * nrhs * sizeof(T), CPU,
+                                           nullptr);
+        if (!apOutputQ) {
+            for (auto j = 0; j < nrhs; j++) {
+                std::copy(pRoot + ( ( col + j ) * ld_root ),
+                          pRoot + ( ( col + j ) * ld_root ) + col,
+                          pQty + ( j * col ));
+            }
+        } else {
+            /* Q stays implicit, t(Q) Y is applied through the reflectors of
+             * the leaves and then of the nodes bottom up, each keeping the
+             * top ncol rows of its result */
+            std::vector <std::vector <T>> partial(num_blocks +
+                                                  tree.mNodes.size());
+#pragma omp parallel for schedule(dynamic)
+            for (size_t b = 0; b < num_blocks; b++) {
+                auto rows = block_size(b);
+                std::vector <T> block_y(rows * nrhs);
+                for (auto j = 0; j < nrhs; j++) {
+                    std::copy(pY + block_start(b) + ( j * row ),
+                              pY + block_start(b) + ( j * row ) + rows,
+                              block_y.data() + ( j * rows ));
+                }
+                solver->Ormqr(true, true, rows, nrhs, col, leaves[ b ], row,
+                              leaves_tau[ b ].data(), block_y.data(), rows);
+                partial[ b ].resize(col * nrhs);
+                for (auto j = 0; j < nrhs; j++) {
+                    std::copy(block_y.data() + ( j * rows ),
+                              block_y.data() + ( j * rows ) + col,
+                              partial[ b ].data() + ( j * col ));
+                }
+            }
+
+            /* Nodes were created level by level, children come first */
+            for (auto k = 0; k < tree.mNodes.size(); k++) {
+                std::vector <T> stacked(2 * col * nrhs);
+                auto children = tree.mChildren[ k ];
+                for (auto half = 0; half < 2; half++) {
+                    auto &child = partial[ half ? children.second
+                                                : children.first ];
+                    for (auto j = 0; j < nrhs; j++) {
+                        std::copy(child.data() + ( j * col ),
+                                  child.data() + ( ( j + 1 ) * col ),
+                                  stacked.data() + ( j * 2 * col ) +
+                                  ( half * col ));
+                    }
+                }
+                solver->Ormqr(true, true, 2 * col, nrhs, col,
+                              tree.mNodes[ k ].data(), 2 * col,
+                              tree.mTau[ k ].data(), stacked.data(), 2 * col);
+                auto &node = partial[ num_blocks + k ];
+                node.resize(col * nrhs);
+                for (auto j = 0; j < nrhs; j++) {
+                    std::copy(stacked.data() + ( j * 2 * col ),
+                              stacked.data() + ( j * 2 * col ) + col,
+                              node.data() + ( j * col ));
+                }
+            }
+            std::copy(partial[ root ].begin(), partial[ root ].end(), pQty);
+        }
+    }
+
+    if (apOutputQ) {
+        /* Top down, every node splits [C ; 0] between its two children,
+         * starting from the identity at the root */
+        std::vector <std::vector <T>> transforms(num_blocks + tree.mNodes.size(),
+                                                 std::vector <T>());
+        transforms[ root ].assign(col * col, 0);
+        for (auto j = 0; j < col; j++) {
+            transforms[ root ][ j + ( j * col ) ] = 1;
+        }
+
+        for (int64_t k = tree.mNodes.size() - 1; k >= 0; k--) {
+            auto &transform = transforms[ num_blocks + k ];
+            std::vector <T> stacked(2 * col * col, 0);
+            for (auto j = 0; j < col; j++) {
+                std::copy(transform.data() + ( j * col ),
+                          transform.data() + ( ( j + 1 ) * col ),
+                          stacked.data() + ( j * 2 * col ));
+            }
+            solver->Ormqr(true, false, 2 * col, col, col,
+                          tree.mNodes[ k ].data(), 2 * col,
+                          tree.mTau[ k ].data(), stacked.data(), 2 * col);
+            auto children = tree.mChildren[ k ];
+            for (auto half = 0; half < 2; half++) {
+                auto &child = transforms[ half ? children.second
+                                               : children.first ];
+                child.resize(col * col);
+                for (auto j = 0; j < col; j++) {
+                    std::copy(stacked.data() + ( j * 2 * col ) + ( half * col ),
+                              stacked.data() + ( j * 2 * col ) +
+                              ( ( half + 1 ) * col ),
+                              child.data() + ( j * col ));
+                }
+            }
+        }
+
+        /* Q of each block times its transform, by chunks of rows */
+#pragma omp parallel for schedule(dynamic)
+        for (size_t b = 0; b < num_blocks; b++) {
+            auto rows = block_size(b);
+            auto pBlock = pQ + block_start(b);
+            solver->Orgqr(rows, col, col, pBlock, row, leaves_tau[ b ].data());
+            size_t chunk = 1024;
+            std::vector <T> temp(std::min(chunk, rows) * col);
+            for (size_t start = 0; start < rows; start += chunk) {
+                auto count = std::min(chunk, rows - start);
+                solver->Gemm(false, false, count, col, col, 1, pBlock + start,
+                             row, transforms[ b ].data(), col, 0, temp.data(),
+                             count);
+                for (auto j = 0; j < col; j++) {
+                    std::copy(temp.data() + ( j * count ),
+                              temp.data() + ( ( j + 1 ) * count ),
+                              pBlock + start + ( j * row ));
+                }
+            }
+        }
+
+        apOutputQ->ClearUp();
+        apOutputQ->SetSize(row * col);
+        apOutputQ->SetDimensions(row, col);
+        apOutputQ->SetData((char *) pQ, CPU);
+    }
+
+    delete pConverted;
+
+    if (apInputY) {
+        apOutputQty->ClearUp();
+        apOutputQty->SetSize(col * nrhs);
+        if (y_matrix) {
+            apOutputQty->SetDimensions(col, nrhs);
+        }
+        apOutputQty->SetData((char *) pQty, CPU);
+    }
+
+    aOutputR.ClearUp();
+    aOutputR.SetSize(col * col);
+    aOutputR.SetDimensions(col, col);
+    aOutputR.SetData((char *) pR, CPU);
+
 }
 
 
@@ -1166,25 +3793,52 @@ SIMPLE_INSTANTIATE(void, linear::CrossProduct, DataType &aInputA,
                    const bool &aSymmetrize, const double &aAlpha,
                    const double &aBeta)
 
-SIMPLE_INSTANTIATE(void, linear::IsSymmetric, DataType &aInput, bool &aOutput)
+SIMPLE_INSTANTIATE(void, linear::IsSymmetric, DataType &aInput, bool &aOutput,
+                   const double &aTolerance)
+
+SIMPLE_INSTANTIATE(void, linear::PackedCrossProduct, DataType &aInput,
+                   DataType &aOutput, const bool &aTranspose,
+                   const bool &aUpperTriangle)
+
+SIMPLE_INSTANTIATE(void, linear::Cholesky, DataType &aInputA,
+                   DataType &aOutput, const bool &aUpperTriangle,
+                   const bool &aOverwrite)
 
 SIMPLE_INSTANTIATE(void, linear::Cholesky, DataType &aInputA,
-                   DataType &aOutput, const bool &aUpperTriangle)
+                   DataType &aOutput, const bool &aUpperTriangle,
+                   const double &aTolerance, const size_t &aTileSize,
+                   double &aAccuracy, std::vector <double> &aFlopShare)
 
 SIMPLE_INSTANTIATE(void, linear::CholeskyInv, DataType &aInputA,
-                   DataType &aOutput, const size_t &aNCol)
+                   DataType &aOutput, const size_t &aNCol,
+                   const std::string &aInternalPrecision)
+
+SIMPLE_INSTANTIATE(void, linear::CholeskySolve, DataType &aInputA,
+                   DataType &aInputB, DataType &aOutput, const bool &aSingle,
+                   const std::string &aInternalPrecision)
 
 SIMPLE_INSTANTIATE(void, linear::Solve, DataType &aInputA, DataType &aInputB,
                    DataType &aOutput, const bool &aSingle,
-                   const std::string &aInternalPrecision)
+                   const std::string &aInternalPrecision,
+                   const bool &aOverwrite)
 
 SIMPLE_INSTANTIATE(void, linear::BackSolve, DataType &aInputA,
                    DataType &aInputB, DataType &aOutput, const size_t &aCol,
                    const bool &aUpperTri, const bool &aTranspose,
                    const char &aSide, const double &aAlpha)
 
+SIMPLE_INSTANTIATE(void, linear::TriangularMultiply, DataType &aInputA,
+                   DataType &aInputB, DataType &aOutput, const bool &aUpperTri,
+                   const bool &aTranspose, const char &aSide,
+                   const double &aAlpha)
+
+SIMPLE_INSTANTIATE(void, linear::SymmetricMultiply, DataType &aInputA,
+                   DataType &aInputB, DataType &aOutput, const bool &aUpperTri,
+                   const char &aSide, const double &aAlpha)
+
 SIMPLE_INSTANTIATE(void, linear::Eigen, DataType &aInput,
-                   DataType &aOutputValues, DataType *apOutputVectors)
+                   DataType &aOutputValues, DataType *apOutputVectors,
+                   const bool &aOverwrite)
 
 SIMPLE_INSTANTIATE(void, linear::Norm, DataType &aInput,
                    const std::string &aType, double &aOutput)
@@ -1195,14 +3849,16 @@ SIMPLE_INSTANTIATE(void, linear::ReciprocalCondition, DataType &aInput,
 
 SIMPLE_INSTANTIATE(void, linear::SVD, DataType &aInputA, DataType &aOutputS,
                    DataType &aOutputU, DataType &aOutputV, const size_t &aNu,
-                   const size_t &aNv, const bool &aTranspose)
+                   const size_t &aNv, const bool &aTranspose,
+                   const bool &aOverwrite)
 
 SIMPLE_INSTANTIATE(void, linear::QRDecompositionQ, DataType &aInputA,
                    DataType &aInputB, DataType &aOutput, const bool &aComplete)
 
 SIMPLE_INSTANTIATE(void, linear::QRDecomposition, DataType &aInputA,
                    DataType &aOutputQr, DataType &aOutputQraux,
-                   DataType &aOutputPivot, DataType &aRank)
+                   DataType &aOutputPivot, DataType &aRank,
+                   const bool &aOverwrite)
 
 SIMPLE_INSTANTIATE(void, linear::QRDecompositionR, DataType &aInputA,
                    DataType &aOutput, const bool &aComplete)
@@ -1211,4 +3867,40 @@ SIMPLE_INSTANTIATE(void, linear::QRDecompositionQY, DataType &aInputA,
                    DataType &aInputB, DataType &aInputC, DataType &aOutput,
                    const bool &aTranspose)
 
-
+SIMPLE_INSTANTIATE(void, linear::Determinant, DataType &aInput,
+                   double &aModulus, int &aSign, const bool &aLogarithm)
+
+SIMPLE_INSTANTIATE(void, linear::RandomizedSVD, DataType &aInputA,
+                   DataType &aOutputS, DataType &aOutputU, DataType &aOutputV,
+                   const size_t &aRank, const size_t &aOversampling,
+                   const size_t &aPowerIterations, const bool &aTranspose,
+                   DataType *apCenter, const size_t &aSeed)
+
+SIMPLE_INSTANTIATE(void, linear::PrincipalComponents, DataType &aInput,
+                   DataType &aOutputSdev, DataType &aOutputRotation,
+                   DataType &aOutputCenter, DataType &aOutputScores,
+                   const size_t &aRank, const bool &aCenter,
+                   const size_t &aOversampling,
+                   const size_t &aPowerIterations, const size_t &aSeed)
+
+SIMPLE_INSTANTIATE(void, linear::EigenRange, DataType &aInput,
+                   DataType &aOutputValues, DataType *apOutputVectors,
+                   const size_t &aFirstIndex, const size_t &aLastIndex)
+
+SIMPLE_INSTANTIATE(void, linear::Lanczos, DataType &aInput,
+                   DataType &aOutputValues, DataType *apOutputVectors,
+                   const size_t &aNumValues, const bool &aLargest,
+                   const double &aTolerance, const size_t &aMaxRestarts,
+                   const size_t &aSeed)
+
+SIMPLE_INSTANTIATE(void, linear::LeastSquares, DataType &aInputX,
+                   DataType &aInputY, DataType *apWeights,
+                   DataType &aCoefficients, DataType &aResiduals,
+                   size_t &aRank, const double &aLambda,
+                   const std::string &aMethod,
+                   const std::string &aInternalPrecision,
+                   const double &aTolerance)
+
+SIMPLE_INSTANTIATE(void, linear::TSQR, DataType &aInput, DataType &aOutputR,
+                   DataType *apOutputQ, DataType *apInputY,
+                   DataType *apOutputQty, const size_t &aBlockRows)
@@ -128,7 +128,7 @@ void math::Log(DataType &aInputA, DataType &aOutput, double aBase) {
             pOutput[ i ] = std::log(pData[ i ]) * val;
         }
     } else {
-        delete[] pOutput;
+        memory::DestroyArray((char *&) pOutput, CPU, nullptr);
         MPCR_API_EXCEPTION("Unknown Log Base", aBase);
     }
 
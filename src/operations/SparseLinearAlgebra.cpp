@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <operations/SparseLinearAlgebra.hpp>
+
+
+using namespace mpcr::operations;
+using namespace mpcr::kernels;
+using namespace std;
+
+
+template <typename T>
+void
+linear::SparseMultiply(SparseDataType &aInputA, DataType &aInputB,
+                       DataType &aOutput, const bool &aTransposeA,
+                       const bool &aTransposeB, const double &aAlpha,
+                       const double &aBeta) {
+
+    if (aInputA.GetPrecision() != aInputB.GetPrecision()) {
+        MPCR_API_EXCEPTION(
+            "Sparse and dense inputs must have the same precision", -1);
+    }
+
+    /* A pending lazy transpose of B is folded into the transpose flag,
+     * dimensions below describe the stored buffer. */
+    auto transpose_b = aTransposeB;
+    size_t row_b = aInputB.GetSize();
+    size_t col_b = 1;
+
+    if (aInputB.IsMatrix()) {
+        transpose_b = aTransposeB != aInputB.IsTransposed();
+        row_b = aInputB.GetNRow();
+        col_b = aInputB.GetNCol();
+        if (aInputB.IsTransposed()) {
+            std::swap(row_b, col_b);
+        }
+    }
+
+    auto ldb = row_b;
+    auto inner_b = transpose_b ? col_b : row_b;
+    auto col_out = transpose_b ? row_b : col_b;
+
+    auto row_out = aTransposeA ? aInputA.GetNCol() : aInputA.GetNRow();
+    auto inner_a = aTransposeA ? aInputA.GetNRow() : aInputA.GetNCol();
+
+    if (inner_a != inner_b) {
+        MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
+    }
+
+    /* The kernel walks the rows of op(A), i.e. op(A) must be compressed by
+     * rows. CSR of A serves A, CSC of A serves t(A), otherwise the layout is
+     * converted once on a copy. */
+    auto is_row_oriented =
+        ( aInputA.GetFormat() == SparseFormat::CSR ) != aTransposeA;
+
+    SparseDataType converted(aInputA.GetPrecision());
+    auto pSparse = &aInputA;
+
+    if (!is_row_oriented) {
+        converted = aInputA;
+        converted.ConvertFormat(aInputA.GetFormat() == SparseFormat::CSR
+                                ? SparseFormat::CSC : SparseFormat::CSR);
+        pSparse = &converted;
+    }
+
+    T *pOutput = nullptr;
+    auto use_beta = aBeta != 0 && aOutput.GetSize() != 0;
+
+    if (use_beta) {
+        if (aOutput.GetNRow() != row_out || aOutput.GetNCol() != col_out) {
+            MPCR_API_EXCEPTION("Wrong Output Matrix Dimensions", -1);
+        }
+        pOutput = (T *) aOutput.GetData(CPU);
+    } else {
+        pOutput = (T *) memory::AllocateArray(row_out * col_out * sizeof(T),
+                                              CPU, nullptr);
+    }
+
+    auto pData_b = (T *) aInputB.GetStoredData(CPU);
+    auto pPointers = pSparse->GetPointers(CPU);
+    auto pIndices = pSparse->GetIndices(CPU);
+    auto pValues = (T *) pSparse->GetValues(CPU);
+    auto has_values = pSparse->GetNnz() > 0;
+
+    T alpha = aAlpha;
+    T beta = use_beta ? aBeta : 0;
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for (size_t i = 0; i < row_out; i++) {
+        for (size_t j = 0; j < col_out; j++) {
+            T sum = 0;
+            if (has_values) {
+                for (auto k = pPointers[ i ]; k < pPointers[ i + 1 ]; k++) {
+                    auto idx = transpose_b ? j + ( pIndices[ k ] * ldb )
+                                           : pIndices[ k ] + ( j * ldb );
+                    sum += pValues[ k ] * pData_b[ idx ];
+                }
+            }
+            auto out_idx = i + ( j * row_out );
+            if (use_beta) {
+                pOutput[ out_idx ] = alpha * sum + beta * pOutput[ out_idx ];
+            } else {
+                pOutput[ out_idx ] = alpha * sum;
+            }
+        }
+    }
+
+    if (!use_beta) {
+        aOutput.ClearUp();
+        aOutput.ConvertPrecision(aInputA.GetPrecision());
+        aOutput.SetSize(row_out * col_out);
+        aOutput.SetDimensions(row_out, col_out);
+    }
+    aOutput.SetData((char *) pOutput, CPU);
+
+}
+
+
+template <typename T>
+void
+linear::CrossProduct(SparseDataType &aInputA, DataType &aInputB,
+                     DataType &aOutput, const bool &aTransposeA,
+                     const bool &aTransposeB) {
+    linear::SparseMultiply <T>(aInputA, aInputB, aOutput, aTransposeA,
+                               aTransposeB);
+}
+
+
+template <typename T>
+void
+linear::CrossProduct(DataType &aInputA, SparseDataType &aInputB,
+                     DataType &aOutput, const bool &aTransposeA,
+                     const bool &aTransposeB) {
+    linear::SparseMultiply <T>(aInputB, aInputA, aOutput, !aTransposeB,
+                               !aTransposeA);
+    aOutput.LazyTranspose();
+}
+
+
+SIMPLE_INSTANTIATE(void, linear::SparseMultiply, SparseDataType &aInputA,
+                   DataType &aInputB, DataType &aOutput,
+                   const bool &aTransposeA, const bool &aTransposeB,
+                   const double &aAlpha, const double &aBeta)
+
+SIMPLE_INSTANTIATE(void, linear::CrossProduct, SparseDataType &aInputA,
+                   DataType &aInputB, DataType &aOutput,
+                   const bool &aTransposeA, const bool &aTransposeB)
+
+SIMPLE_INSTANTIATE(void, linear::CrossProduct, DataType &aInputA,
+                   SparseDataType &aInputB, DataType &aOutput,
+                   const bool &aTransposeA, const bool &aTransposeB)
@@ -0,0 +1,495 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <operations/TileLinearAlgebra.hpp>
+#include <operations/concrete/BackendFactory.hpp>
+#include <memory>
+
+
+using namespace mpcr::operations;
+using namespace mpcr::precision;
+using namespace std;
+
+
+/**
+ * @brief
+ * Get a tile in the given precision, a converted copy is created in aHolder
+ * in case the tile is held in another precision.
+ *
+ */
+DataType *
+GetTileInPrecision(DataType *apTile, const Precision &aPrecision,
+                   unique_ptr <DataType> &aHolder) {
+    if (apTile->GetPrecision() == aPrecision) {
+        return apTile;
+    }
+    aHolder = make_unique <DataType>(*apTile, aPrecision);
+    return aHolder.get();
+}
+
+
+/**
+ * @brief
+ * Run a kernel updating the given tile. Half precision tiles are promoted to
+ * single precision for the update and demoted back afterwards.
+ *
+ */
+template <typename FUNCTION>
+void
+UpdateTile(DataType &aTile, FUNCTION aKernel) {
+    if (aTile.GetPrecision() != HALF) {
+        aKernel(aTile);
+        return;
+    }
+    DataType temp(aTile, FLOAT);
+    aKernel(temp);
+    temp.ConvertPrecision(HALF);
+    aTile = temp;
+}
+
+
+/**
+ * @brief
+ * Prepare the tiles of a matrix before submitting tasks, host buffers are
+ * made valid once so concurrent tasks only read them. Device copies of output
+ * tiles are dropped since the tasks update the host buffers.
+ *
+ */
+void
+PrepareTiles(MPCRTile &aTile, const bool &aIsOutput) {
+    for (auto j = 0; j < aTile.GetGridNCol(); j++) {
+        for (auto i = 0; i < aTile.GetGridNRow(); i++) {
+            auto pTile = aTile.GetTile(i, j);
+            if (pTile->GetPrecision() == HALF) {
+                continue;
+            }
+            pTile->GetData(CPU);
+#ifdef USE_CUDA
+            if (aIsOutput) {
+                pTile->FreeGPUMemory();
+            }
+#endif
+        }
+    }
+}
+
+
+template <typename T>
+void
+TileGemmKernel(DataType &aTileA, DataType &aTileB, DataType &aTileC,
+               const bool &aTransposeA, const bool &aTransposeB,
+               const double &aAlpha, const double &aBeta) {
+
+    unique_ptr <DataType> temp_a;
+    unique_ptr <DataType> temp_b;
+    auto pTile_a = GetTileInPrecision(&aTileA, aTileC.GetPrecision(), temp_a);
+    auto pTile_b = GetTileInPrecision(&aTileB, aTileC.GetPrecision(), temp_b);
+
+    auto row = aTileC.GetNRow();
+    auto col = aTileC.GetNCol();
+    auto inner = aTransposeA ? pTile_a->GetNRow() : pTile_a->GetNCol();
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    solver->Gemm(aTransposeA, aTransposeB, row, col, inner, (T) aAlpha,
+                 (T *) pTile_a->GetData(CPU), pTile_a->GetNRow(),
+                 (T *) pTile_b->GetData(CPU), pTile_b->GetNRow(), (T) aBeta,
+                 (T *) aTileC.GetData(CPU), row);
+}
+
+
+template <typename T>
+void
+TileTrsmKernel(DataType &aTileA, DataType &aTileB, const bool &aLeftSide,
+               const bool &aUpperTriangle, const bool &aTranspose,
+               const double &aAlpha) {
+
+    unique_ptr <DataType> temp_a;
+    auto pTile_a = GetTileInPrecision(&aTileA, aTileB.GetPrecision(), temp_a);
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    solver->Trsm(aLeftSide, aUpperTriangle, aTranspose, aTileB.GetNRow(),
+                 aTileB.GetNCol(), (T) aAlpha, (T *) pTile_a->GetData(CPU),
+                 pTile_a->GetNRow(), (T *) aTileB.GetData(CPU),
+                 aTileB.GetNRow());
+}
+
+
+template <typename T>
+void
+TileSyrkKernel(DataType &aTileA, DataType &aTileC, const bool &aTranspose,
+               const double &aAlpha, const double &aBeta) {
+
+    unique_ptr <DataType> temp_a;
+    auto pTile_a = GetTileInPrecision(&aTileA, aTileC.GetPrecision(), temp_a);
+
+    auto order = aTileC.GetNRow();
+    auto inner = aTranspose ? pTile_a->GetNRow() : pTile_a->GetNCol();
+
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    solver->Syrk(true, aTranspose, order, inner, (T) aAlpha,
+                 (T *) pTile_a->GetData(CPU), pTile_a->GetNRow(), (T) aBeta,
+                 (T *) aTileC.GetData(CPU), order);
+}
+
+
+template <typename T>
+void
+TilePotrfKernel(DataType &aTileA, int &aInfo) {
+
+    auto order = aTileA.GetNRow();
+    auto solver = BackendFactory <T>::CreateLinearAlgebraBackend(CPU);
+    aInfo = solver->Potrf(false, order, (T *) aTileA.GetData(CPU), order);
+}
+
+
+/**
+ * @brief
+ * Add the flops of a tile update to the counter of the precision it runs in.
+ *
+ */
+void
+CountFlops(vector <double> &aFlops, DataType *apTile, const double &aCount) {
+    auto precision = apTile->GetPrecision();
+    if (precision == HALF) {
+        precision = FLOAT;
+    }
+    aFlops[ precision - 1 ] += aCount;
+}
+
+
+void
+tile::TileGemm(MPCRTile &aInputA, MPCRTile &aInputB, MPCRTile &aInputC,
+               const bool &aTransposeA, const bool &aTransposeB,
+               const double &aAlpha, const double &aBeta) {
+
+    if (&aInputC == &aInputA || &aInputC == &aInputB) {
+        MPCR_API_EXCEPTION("Output Tile Matrix must not alias the inputs", -1);
+    }
+
+    auto row_a = aTransposeA ? aInputA.GetNCol() : aInputA.GetNRow();
+    auto col_a = aTransposeA ? aInputA.GetNRow() : aInputA.GetNCol();
+    auto tile_row_a = aTransposeA ? aInputA.GetTileNCol()
+                                  : aInputA.GetTileNRow();
+    auto tile_col_a = aTransposeA ? aInputA.GetTileNRow()
+                                  : aInputA.GetTileNCol();
+
+    auto row_b = aTransposeB ? aInputB.GetNCol() : aInputB.GetNRow();
+    auto col_b = aTransposeB ? aInputB.GetNRow() : aInputB.GetNCol();
+    auto tile_row_b = aTransposeB ? aInputB.GetTileNCol()
+                                  : aInputB.GetTileNRow();
+    auto tile_col_b = aTransposeB ? aInputB.GetTileNRow()
+                                  : aInputB.GetTileNCol();
+
+    if (col_a != row_b || row_a != aInputC.GetNRow() ||
+        col_b != aInputC.GetNCol()) {
+        MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
+    }
+
+    if (tile_col_a != tile_row_b || tile_row_a != aInputC.GetTileNRow() ||
+        tile_col_b != aInputC.GetTileNCol()) {
+        MPCR_API_EXCEPTION("Tile sizes of the matrices don't conform", -1);
+    }
+
+    PrepareTiles(aInputA, false);
+    PrepareTiles(aInputB, false);
+    PrepareTiles(aInputC, true);
+
+    auto grid_row = aInputC.GetGridNRow();
+    auto grid_col = aInputC.GetGridNCol();
+    auto grid_inner = aTransposeA ? aInputA.GetGridNRow()
+                                  : aInputA.GetGridNCol();
+    auto transpose_a = aTransposeA;
+    auto transpose_b = aTransposeB;
+    auto alpha = aAlpha;
+
+    /* Every C tile is a chain of tasks over the inner dimension, chains of
+     * different C tiles are independent. */
+#pragma omp parallel
+#pragma omp single
+    {
+        for (auto j = 0; j < grid_col; j++) {
+            for (auto i = 0; i < grid_row; i++) {
+                auto pTile_c = aInputC.GetTile(i, j);
+                for (auto l = 0; l < grid_inner; l++) {
+                    auto pTile_a = transpose_a ? aInputA.GetTile(l, i)
+                                               : aInputA.GetTile(i, l);
+                    auto pTile_b = transpose_b ? aInputB.GetTile(j, l)
+                                               : aInputB.GetTile(l, j);
+                    auto beta = ( l == 0 ) ? aBeta : 1;
+
+#pragma omp task depend(inout: pTile_c[0])
+                    UpdateTile(*pTile_c, [ & ](DataType &aTile) {
+                        SIMPLE_DISPATCH(aTile.GetPrecision(), TileGemmKernel,
+                                        *pTile_a, *pTile_b, aTile,
+                                        transpose_a, transpose_b, alpha, beta)
+                    });
+                }
+            }
+        }
+    }
+}
+
+
+void
+tile::TileTrsm(MPCRTile &aInputA, MPCRTile &aInputB, const bool &aLeftSide,
+               const bool &aUpperTriangle, const bool &aTranspose,
+               const double &aAlpha) {
+
+    if (&aInputA == &aInputB) {
+        MPCR_API_EXCEPTION("Output Tile Matrix must not alias the inputs", -1);
+    }
+
+    if (aInputA.GetNRow() != aInputA.GetNCol() ||
+        aInputA.GetTileNRow() != aInputA.GetTileNCol()) {
+        MPCR_API_EXCEPTION(
+            "Triangular Tile Matrix must be square with square tiles", -1);
+    }
+
+    auto solved_dim = aLeftSide ? aInputB.GetNRow() : aInputB.GetNCol();
+    auto solved_tile = aLeftSide ? aInputB.GetTileNRow()
+                                 : aInputB.GetTileNCol();
+
+    if (solved_dim != aInputA.GetNRow()) {
+        MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
+    }
+    if (solved_tile != aInputA.GetTileNRow()) {
+        MPCR_API_EXCEPTION("Tile sizes of the matrices don't conform", -1);
+    }
+
+    PrepareTiles(aInputA, false);
+    PrepareTiles(aInputB, true);
+
+    auto grid = aInputA.GetGridNRow();
+    auto grid_other = aLeftSide ? aInputB.GetGridNCol()
+                                : aInputB.GetGridNRow();
+
+    /* op(A) is effectively lower triangular when A is lower and not
+     * transposed, or upper and transposed. Left solves on a lower op(A) and
+     * right solves on an upper op(A) sweep forward, otherwise backward. */
+    auto op_lower = aUpperTriangle == aTranspose;
+    auto forward = aLeftSide ? op_lower : !op_lower;
+
+    auto left_side = aLeftSide;
+    auto upper_triangle = aUpperTriangle;
+    auto transpose = aTranspose;
+
+#pragma omp parallel
+#pragma omp single
+    {
+        for (auto step = 0; step < grid; step++) {
+            auto k = forward ? step : grid - 1 - step;
+            auto alpha = ( step == 0 ) ? aAlpha : 1;
+            auto pTile_kk = aInputA.GetTile(k, k);
+
+            /* Solve the tiles of the current block row (left) / col (right) */
+            for (auto j = 0; j < grid_other; j++) {
+                auto pTile_b = left_side ? aInputB.GetTile(k, j)
+                                         : aInputB.GetTile(j, k);
+
+#pragma omp task depend(inout: pTile_b[0])
+                UpdateTile(*pTile_b, [ & ](DataType &aTile) {
+                    SIMPLE_DISPATCH(aTile.GetPrecision(), TileTrsmKernel,
+                                    *pTile_kk, aTile, left_side,
+                                    upper_triangle, transpose, alpha)
+                });
+            }
+
+            /* Update the remaining block rows (left) / cols (right) */
+            for (auto next = step + 1; next < grid; next++) {
+                auto m = forward ? next : grid - 1 - next;
+
+                for (auto j = 0; j < grid_other; j++) {
+                    DataType *pTile_a = nullptr;
+                    DataType *pTile_x = nullptr;
+                    DataType *pTile_b = nullptr;
+                    if (left_side) {
+                        /* B(m,j) -= op(A)(m,k) X(k,j) */
+                        pTile_a = transpose ? aInputA.GetTile(k, m)
+                                            : aInputA.GetTile(m, k);
+                        pTile_x = aInputB.GetTile(k, j);
+                        pTile_b = aInputB.GetTile(m, j);
+                    } else {
+                        /* B(j,m) -= X(j,k) op(A)(k,m) */
+                        pTile_a = transpose ? aInputA.GetTile(m, k)
+                                            : aInputA.GetTile(k, m);
+                        pTile_x = aInputB.GetTile(j, k);
+                        pTile_b = aInputB.GetTile(j, m);
+                    }
+
+#pragma omp task depend(in: pTile_x[0]) depend(inout: pTile_b[0])
+                    UpdateTile(*pTile_b, [ & ](DataType &aTile) {
+                        if (left_side) {
+                            SIMPLE_DISPATCH(aTile.GetPrecision(),
+                                            TileGemmKernel, *pTile_a,
+                                            *pTile_x, aTile, transpose, false,
+                                            -1, alpha)
+                        } else {
+                            SIMPLE_DISPATCH(aTile.GetPrecision(),
+                                            TileGemmKernel, *pTile_x,
+                                            *pTile_a, aTile, false, transpose,
+                                            -1, alpha)
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
+
+
+void
+tile::TileSyrk(MPCRTile &aInputA, MPCRTile &aInputC, const bool &aTranspose,
+               const double &aAlpha, const double &aBeta) {
+
+    if (&aInputA == &aInputC) {
+        MPCR_API_EXCEPTION("Output Tile Matrix must not alias the inputs", -1);
+    }
+
+    if (aInputC.GetNRow() != aInputC.GetNCol() ||
+        aInputC.GetTileNRow() != aInputC.GetTileNCol()) {
+        MPCR_API_EXCEPTION(
+            "Output Tile Matrix must be square with square tiles", -1);
+    }
+
+    auto row_a = aTranspose ? aInputA.GetNCol() : aInputA.GetNRow();
+    auto tile_row_a = aTranspose ? aInputA.GetTileNCol()
+                                 : aInputA.GetTileNRow();
+
+    if (row_a != aInputC.GetNRow()) {
+        MPCR_API_EXCEPTION("Wrong Matrix Dimensions", -1);
+    }
+    if (tile_row_a != aInputC.GetTileNRow()) {
+        MPCR_API_EXCEPTION("Tile sizes of the matrices don't conform", -1);
+    }
+
+    PrepareTiles(aInputA, false);
+    PrepareTiles(aInputC, true);
+
+    auto grid = aInputC.GetGridNRow();
+    auto grid_inner = aTranspose ? aInputA.GetGridNRow()
+                                 : aInputA.GetGridNCol();
+    auto transpose = aTranspose;
+    auto alpha = aAlpha;
+
+#pragma omp parallel
+#pragma omp single
+    {
+        for (auto j = 0; j < grid; j++) {
+            for (auto i = j; i < grid; i++) {
+                auto pTile_c = aInputC.GetTile(i, j);
+                for (auto l = 0; l < grid_inner; l++) {
+                    auto pTile_a_i = transpose ? aInputA.GetTile(l, i)
+                                               : aInputA.GetTile(i, l);
+                    auto pTile_a_j = transpose ? aInputA.GetTile(l, j)
+                                               : aInputA.GetTile(j, l);
+                    auto beta = ( l == 0 ) ? aBeta : 1;
+                    auto diagonal = i == j;
+
+#pragma omp task depend(inout: pTile_c[0])
+                    UpdateTile(*pTile_c, [ & ](DataType &aTile) {
+                        if (diagonal) {
+                            SIMPLE_DISPATCH(aTile.GetPrecision(),
+                                            TileSyrkKernel, *pTile_a_i, aTile,
+                                            transpose, alpha, beta)
+                        } else {
+                            SIMPLE_DISPATCH(aTile.GetPrecision(),
+                                            TileGemmKernel, *pTile_a_i,
+                                            *pTile_a_j, aTile, transpose,
+                                            !transpose, alpha, beta)
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
+
+
+void
+tile::TileCholesky(MPCRTile &aInputA, std::vector <double> &aFlops) {
+
+    if (aInputA.GetNRow() != aInputA.GetNCol() ||
+        aInputA.GetTileNRow() != aInputA.GetTileNCol()) {
+        MPCR_API_EXCEPTION(
+            "Cannot Apply Cholesky Decomposition on non-square Tile Matrix",
+            -1);
+    }
+
+    PrepareTiles(aInputA, true);
+
+    auto grid = aInputA.GetGridNRow();
+    auto rc = 0;
+    aFlops.assign(3, 0);
+
+#pragma omp parallel
+#pragma omp single
+    {
+        for (auto k = 0; k < grid; k++) {
+            auto pTile_kk = aInputA.GetTile(k, k);
+            double order_k = pTile_kk->GetNRow();
+            auto offset = k * aInputA.GetTileNRow();
+
+            /* A(k,k) = L(k,k) t(L(k,k)) */
+            CountFlops(aFlops, pTile_kk, order_k * order_k * order_k / 3);
+#pragma omp task depend(inout: pTile_kk[0])
+            UpdateTile(*pTile_kk, [ & ](DataType &aTile) {
+                auto info = 0;
+                SIMPLE_DISPATCH(aTile.GetPrecision(), TilePotrfKernel, aTile,
+                                info)
+                if (info != 0) {
+#pragma omp atomic write
+                    rc = offset + info;
+                }
+            });
+
+            /* L(m,k) = A(m,k) t(L(k,k))^-1 */
+            for (auto m = k + 1; m < grid; m++) {
+                auto pTile_mk = aInputA.GetTile(m, k);
+                CountFlops(aFlops, pTile_mk,
+                           pTile_mk->GetNRow() * order_k * order_k);
+#pragma omp task depend(in: pTile_kk[0]) depend(inout: pTile_mk[0])
+                UpdateTile(*pTile_mk, [ & ](DataType &aTile) {
+                    SIMPLE_DISPATCH(aTile.GetPrecision(), TileTrsmKernel,
+                                    *pTile_kk, aTile, false, false, true, 1)
+                });
+            }
+
+            /* A(m,n) -= L(m,k) t(L(n,k)) on the trailing lower triangle */
+            for (auto n = k + 1; n < grid; n++) {
+                auto pTile_nk = aInputA.GetTile(n, k);
+                auto pTile_nn = aInputA.GetTile(n, n);
+                double order_n = pTile_nn->GetNRow();
+
+                CountFlops(aFlops, pTile_nn, order_n * order_n * order_k);
+#pragma omp task depend(in: pTile_nk[0]) depend(inout: pTile_nn[0])
+                UpdateTile(*pTile_nn, [ & ](DataType &aTile) {
+                    SIMPLE_DISPATCH(aTile.GetPrecision(), TileSyrkKernel,
+                                    *pTile_nk, aTile, false, -1, 1)
+                });
+
+                for (auto m = n + 1; m < grid; m++) {
+                    auto pTile_mk = aInputA.GetTile(m, k);
+                    auto pTile_mn = aInputA.GetTile(m, n);
+                    CountFlops(aFlops, pTile_mn,
+                               2 * pTile_mn->GetNRow() * order_n * order_k);
+#pragma omp task depend(in: pTile_mk[0], pTile_nk[0]) \
+                 depend(inout: pTile_mn[0])
+                    UpdateTile(*pTile_mn, [ & ](DataType &aTile) {
+                        SIMPLE_DISPATCH(aTile.GetPrecision(), TileGemmKernel,
+                                        *pTile_mk, *pTile_nk, aTile, false,
+                                        true, -1, 1)
+                    });
+                }
+            }
+        }
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Applying Cholesky Decomposition", rc);
+    }
+}
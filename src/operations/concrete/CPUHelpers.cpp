@@ -9,11 +9,18 @@
 #include <operations/concrete/CPUHelpers.hpp>
 #include <utilities/MPCRDispatcher.hpp>
 #include <lapack.hh>
+#include <algorithm>
+#include <cmath>
 
 
 using namespace mpcr::operations::helpers;
 using namespace mpcr;
 
+/** Rows summed by each thread of the infinity norm **/
+#define MPCR_NORM_ROW_BLOCK 256
+/** Side length of the square tiles compared by the symmetry check **/
+#define MPCR_SYMMETRY_TILE 64
+
 
 template <typename T>
 void
@@ -133,6 +140,7 @@ CPUHelpers <T>::Symmetrize(DataType &aInput, const bool &aToUpperTriangle,
     }
 
     aInput.SetData((char *) pData, CPU);
+    aInput.SetProperty(MATRIX_SYMMETRIC);
 }
 
 
@@ -141,28 +149,32 @@ void
 CPUHelpers <T>::NormMARS(DataType &aInput, T &aValue,
                          kernels::RunContext *aContext) {
 
-    aValue = 0.0f;
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
-
+    T value = 0;
+    size_t col = aInput.GetNCol();
+    size_t row = aInput.GetNRow();
     auto pData = (T *) aInput.GetData(CPU);
-    auto pTemp = (T *) memory::AllocateArray(row * sizeof(T), CPU, nullptr);
-    memory::Memset((char *) pTemp, 0, sizeof(T) * row, CPU, nullptr);
-
 
-    for (auto j = 0; j < col; j++) {
-        for (auto i = 0; i < row; i++) {
-            pTemp[ i ] += fabsf(pData[ i + row * j ]);
+    /* Each thread owns a block of rows and accumulates its sums while
+     * streaming down the columns, so every read is contiguous. */
+#pragma omp parallel for reduction(max : value) schedule(static)
+    for (size_t i = 0; i < row; i += MPCR_NORM_ROW_BLOCK) {
+        T sums[MPCR_NORM_ROW_BLOCK] = {0};
+        auto block_size = std::min(row - i, (size_t) MPCR_NORM_ROW_BLOCK);
+
+        for (size_t j = 0; j < col; j++) {
+            auto pColumn = pData + i + ( row * j );
+#pragma omp simd
+            for (size_t k = 0; k < block_size; k++) {
+                sums[ k ] += std::abs(pColumn[ k ]);
+            }
         }
-    }
 
-    for (auto i = 0; i < row; i++) {
-        if (pTemp[ i ] > aValue) {
-            aValue = pTemp[ i ];
+        for (size_t k = 0; k < block_size; k++) {
+            value = std::max(value, sums[ k ]);
         }
     }
 
-    memory::DestroyArray((char *&) pTemp, CPU, nullptr);
+    aValue = value;
 
 }
 
@@ -172,21 +184,24 @@ void
 CPUHelpers <T>::NormMACS(DataType &aInput, T &aValue,
                          kernels::RunContext *aContext) {
 
-    aValue = 0.0f;
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
+    T value = 0;
+    size_t col = aInput.GetNCol();
+    size_t row = aInput.GetNRow();
     auto pData = (T *) aInput.GetData(CPU);
 
-    for (auto j = 0; j < col; j++) {
-        T temp = 0.0f;
-        for (auto i = 0; i < row; i++) {
-            temp += fabsf(pData[ i + row * j ]);
+#pragma omp parallel for reduction(max : value) schedule(static)
+    for (size_t j = 0; j < col; j++) {
+        auto pColumn = pData + ( row * j );
+        T sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (size_t i = 0; i < row; i++) {
+            sum += std::abs(pColumn[ i ]);
         }
-
-        if (temp > aValue)
-            aValue = temp;
+        value = std::max(value, sum);
     }
 
+    aValue = value;
+
 }
 
 
@@ -196,16 +211,38 @@ CPUHelpers <T>::NormEuclidean(DataType &aInput, T &aValue,
                               kernels::RunContext *aContext) {
 
     auto pData = (T *) aInput.GetData(CPU);
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
-    T scale = 0.0f;
-    T sumsq = 1.0f;
+    size_t col = aInput.GetNCol();
+    size_t row = aInput.GetNRow();
+    T scale = 0;
+    T sumsq = 1;
+
+    /* Each thread scales its own columns, the partial sums are merged with
+     * the larger scale to avoid overflow and underflow, as lassq does. */
+#pragma omp parallel
+    {
+        T local_scale = 0;
+        T local_sumsq = 1;
+
+#pragma omp for schedule(static)
+        for (size_t j = 0; j < col; j++) {
+            lapack::lassq(row, pData + ( j * row ), 1, &local_scale,
+                          &local_sumsq);
+        }
 
-    for (auto j = 0; j < col; j++) {
-        lapack::lassq(row, pData + ( j * row ), 1, &scale, &sumsq);
+#pragma omp critical
+        {
+            if (local_scale > scale) {
+                sumsq = local_sumsq +
+                        sumsq * ( scale / local_scale ) * ( scale / local_scale );
+                scale = local_scale;
+            } else if (local_scale > 0) {
+                sumsq += local_sumsq * ( local_scale / scale ) *
+                         ( local_scale / scale );
+            }
+        }
     }
 
-    aValue = scale * sqrtf(sumsq);
+    aValue = scale * std::sqrt(sumsq);
 
 }
 
@@ -215,19 +252,18 @@ void
 CPUHelpers <T>::NormMaxMod(DataType &aInput, T &aValue,
                            kernels::RunContext *aContext) {
 
+    T value = 0;
+    size_t size = aInput.GetSize();
     auto pData = (T *) aInput.GetData(CPU);
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
-    aValue = 0.0f;
 
-    for (auto j = 0; j < col; j++) {
-        for (auto i = 0; i < row; i++) {
-            T temp = (T) fabsf(pData[ i + row * j ]);
-            if (temp > aValue)
-                aValue = temp;
-        }
+    /* The layout doesn't matter, the data is walked as a single vector */
+#pragma omp parallel for simd reduction(max : value) schedule(static)
+    for (size_t i = 0; i < size; i++) {
+        value = std::max(value, std::abs(pData[ i ]));
     }
 
+    aValue = value;
+
 }
 
 
@@ -251,36 +287,63 @@ CPUHelpers <T>::GetRank(DataType &aInput, T &aRank,
 template <typename T>
 void
 CPUHelpers <T>::IsSymmetric(DataType &aInput, bool &aOutput,
+                            const double &aTolerance,
                             kernels::RunContext *aContext) {
 
     aOutput = false;
-    auto pData = (T *) aInput.GetData(CPU);
-    auto col = aInput.GetNCol();
-    auto row = aInput.GetNRow();
+    size_t col = aInput.GetNCol();
+    size_t row = aInput.GetNRow();
 
     if (col != row) {
         return;
     }
 
-    size_t idx_col_maj;
-    size_t idx_row_maj;
-    auto epsilon = std::numeric_limits <T>::epsilon();
-    T val;
-    for (auto i = 0; i < col; i++) {
-        for (auto j = 0; j < row; j++) {
-            if (i == j) {
-                break;
-            }
-            idx_col_maj = ( i * row ) + j;
-            idx_row_maj = ( j * col ) + i;
-            val = std::fabs(pData[ idx_row_maj ] - pData[ idx_col_maj ]);
-            if (val > epsilon) {
-                return;
+    auto pData = (T *) aInput.GetData(CPU);
+    auto tolerance = (T) aTolerance;
+    size_t tiles = ( row + MPCR_SYMMETRY_TILE - 1 ) / MPCR_SYMMETRY_TILE;
+    bool symmetric = true;
+
+    /* Each tile below the diagonal is compared against its mirror above it,
+     * both blocks stay in cache while the mirror is read across its rows.
+     * A mismatch found by any thread lets the remaining tiles be skipped. */
+#pragma omp parallel for schedule(dynamic)
+    for (size_t k = 0; k < tiles * tiles; k++) {
+        auto tile_row = k / tiles;
+        auto tile_col = k % tiles;
+
+        bool proceed;
+#pragma omp atomic read
+        proceed = symmetric;
+
+        if (tile_row < tile_col || !proceed) {
+            continue;
+        }
+
+        auto row_start = tile_row * MPCR_SYMMETRY_TILE;
+        auto row_end = std::min(row_start + MPCR_SYMMETRY_TILE, row);
+        auto col_start = tile_col * MPCR_SYMMETRY_TILE;
+        auto col_end = std::min(col_start + MPCR_SYMMETRY_TILE, row);
+        auto match = true;
+
+        for (auto j = col_start; j < col_end && match; j++) {
+            /* Diagonal tiles only hold their strictly lower part */
+            auto i = ( tile_row == tile_col ) ? j + 1 : row_start;
+            for (; i < row_end; i++) {
+                if (std::abs(pData[ i + ( j * row ) ] -
+                             pData[ j + ( i * row ) ]) > tolerance) {
+                    match = false;
+                    break;
+                }
             }
         }
+
+        if (!match) {
+#pragma omp atomic write
+            symmetric = false;
+        }
     }
 
-    aOutput = true;
+    aOutput = symmetric;
 }
 
 
@@ -290,7 +353,11 @@ template <typename T>
 void
 CPUHelpers <T>::CreateIdentityMatrix(T *apData, size_t &aSideLength,
                                      kernels::RunContext *aContext) {
-    MPCR_API_EXCEPTION("CPU Identity Matrix is not implemented", -1);
+    memory::Memset((char *) apData, 0,
+                   aSideLength * aSideLength * sizeof(T), CPU, nullptr);
+    for (auto i = 0; i < aSideLength; i++) {
+        apData[ i + ( i * aSideLength ) ] = 1;
+    }
 }
 
 
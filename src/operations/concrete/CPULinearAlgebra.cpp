@@ -1,11 +1,131 @@
 
 
 #include <operations/concrete/CPULinearAlgebra.hpp>
+#include <utilities/TypeChecker.hpp>
+#include <kernels/MemoryHandler.hpp>
 #include <blas.hh>
 #include <lapack.hh>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 
 using namespace mpcr::operations::linear;
+using namespace mpcr;
+
+
+/** Maximum number of refinement steps before falling back to a full
+ * precision factorization (same as LAPACK dsgesv) **/
+#define MPCR_MAX_REFINEMENT_ITERATIONS 30
+
+
+/**
+ * @brief
+ * Solve A X = B in double precision with a factorization of A computed in
+ * single precision, the solution is refined using residuals computed in
+ * double precision until it reaches double precision accuracy (same scheme
+ * and stopping criterion as LAPACK dsgesv / dsposv). A is not modified.
+ * aFactorize(SA) factorizes the single precision copy of A,
+ * aSolve(SA, SX) solves in place of SX using the factorization and
+ * aResidual(X, R) performs R = R - A X in double precision.
+ *
+ * @returns
+ * true if the refinement converged and apDataX holds X, otherwise apDataX
+ * still holds B.
+ *
+ */
+template <typename FACTORIZE, typename SOLVE, typename RESIDUAL>
+bool
+RefineSolution(const int &aNumN, const int &aNumNRH, const double *apDataA,
+               const int &aLda, const double &aNormA, double *apDataX,
+               const int &aLdx, FACTORIZE aFactorize, SOLVE aSolve,
+               RESIDUAL aResidual) {
+
+    /* Offsets are formed in size_t, n^2 overflows an int for n > 46340 */
+    size_t num_n = aNumN;
+    size_t num_rhs = aNumNRH;
+    size_t lda = aLda;
+    size_t ldx = aLdx;
+    size_t size_a = num_n * num_n;
+    size_t size_x = num_n * num_rhs;
+
+    auto pData_sa = (float *) memory::AllocateArray(size_a * sizeof(float),
+                                                    CPU, nullptr);
+    auto pData_sx = (float *) memory::AllocateArray(size_x * sizeof(float),
+                                                    CPU, nullptr);
+    auto pData_b = (double *) memory::AllocateArray(size_x * sizeof(double),
+                                                    CPU, nullptr);
+    auto pData_r = (double *) memory::AllocateArray(size_x * sizeof(double),
+                                                    CPU, nullptr);
+
+    for (size_t j = 0; j < num_n; j++) {
+        std::copy(apDataA + ( j * lda ), apDataA + ( j * lda ) + num_n,
+                  pData_sa + ( j * num_n ));
+    }
+    for (size_t j = 0; j < num_rhs; j++) {
+        std::copy(apDataX + ( j * ldx ), apDataX + ( j * ldx ) + num_n,
+                  pData_b + ( j * num_n ));
+    }
+
+    auto converged = false;
+
+    if (aFactorize(pData_sa) == 0) {
+        auto threshold = aNormA * std::numeric_limits <double>::epsilon() *
+                         sqrt((double) aNumN);
+
+        std::copy(pData_b, pData_b + size_x, pData_sx);
+
+        for (auto iter = 0; iter <= MPCR_MAX_REFINEMENT_ITERATIONS; iter++) {
+            aSolve(pData_sa, pData_sx);
+
+            /* X += correction , R = B - A X */
+            for (size_t j = 0; j < num_rhs; j++) {
+                for (size_t i = 0; i < num_n; i++) {
+                    auto correction = (double) pData_sx[ i + ( j * num_n ) ];
+                    apDataX[ i + ( j * ldx ) ] =
+                        ( iter == 0 ) ? correction
+                                      : apDataX[ i + ( j * ldx ) ] +
+                                        correction;
+                }
+            }
+            std::copy(pData_b, pData_b + size_x, pData_r);
+            aResidual(apDataX, pData_r);
+
+            converged = true;
+            for (size_t j = 0; j < num_rhs && converged; j++) {
+                double max_x = 0;
+                double max_r = 0;
+                for (size_t i = 0; i < num_n; i++) {
+                    max_x = std::max(max_x,
+                                     fabs(apDataX[ i + ( j * ldx ) ]));
+                    max_r = std::max(max_r,
+                                     fabs(pData_r[ i + ( j * num_n ) ]));
+                }
+                /* NaN residuals never converge */
+                converged = max_r <= max_x * threshold;
+            }
+
+            if (converged) {
+                break;
+            }
+            std::copy(pData_r, pData_r + size_x, pData_sx);
+        }
+    }
+
+    if (!converged) {
+        for (size_t j = 0; j < num_rhs; j++) {
+            std::copy(pData_b + ( j * num_n ), pData_b + ( ( j + 1 ) * num_n ),
+                      apDataX + ( j * ldx ));
+        }
+    }
+
+    memory::DestroyArray((char *&) pData_sa, CPU, nullptr);
+    memory::DestroyArray((char *&) pData_sx, CPU, nullptr);
+    memory::DestroyArray((char *&) pData_b, CPU, nullptr);
+    memory::DestroyArray((char *&) pData_r, CPU, nullptr);
+
+    return converged;
+}
 
 
 template <typename T>
@@ -49,6 +169,56 @@ CPULinearAlgebra <T>::Syrk(const bool &aFillLower,
                aAlpha, apDataA, aLda, aBeta, apDataC, aLdc);
 }
 
+template <typename T>
+void
+CPULinearAlgebra <T>::Gemv(const bool &aTranspose, const int &aNumRowA,
+                           const int &aNumColA, const T &aAlpha,
+                           const T *apDataA, const int &aLda,
+                           const T *apDataX, const int &aIncX, const T &aBeta,
+                           T *apDataY, const int &aIncY) {
+
+    auto transpose = aTranspose ? blas::Op::Trans : blas::Op::NoTrans;
+    auto layout = blas::Layout::ColMajor;
+
+    blas::gemv(layout, transpose, aNumRowA, aNumColA, aAlpha, apDataA, aLda,
+               apDataX, aIncX, aBeta, apDataY, aIncY);
+}
+
+
+template <typename T>
+T
+CPULinearAlgebra <T>::Dot(const int &aNumElements, const T *apDataX,
+                          const int &aIncX, const T *apDataY,
+                          const int &aIncY) {
+
+    return blas::dot(aNumElements, apDataX, aIncX, apDataY, aIncY);
+}
+
+
+template <typename T>
+void
+CPULinearAlgebra <T>::Ger(const int &aNumRowA, const int &aNumColA,
+                          const T &aAlpha, const T *apDataX, const int &aIncX,
+                          const T *apDataY, const int &aIncY, T *apDataA,
+                          const int &aLda) {
+
+    auto layout = blas::Layout::ColMajor;
+
+    blas::ger(layout, aNumRowA, aNumColA, aAlpha, apDataX, aIncX, apDataY,
+              aIncY, apDataA, aLda);
+}
+
+
+template <typename T>
+void
+CPULinearAlgebra <T>::Axpy(const int &aNumElements, const T &aAlpha,
+                           const T *apDataX, const int &aIncX, T *apDataY,
+                           const int &aIncY) {
+
+    blas::axpy(aNumElements, aAlpha, apDataX, aIncX, apDataY, aIncY);
+}
+
+
 
 template <typename T>
 void
@@ -71,6 +241,48 @@ CPULinearAlgebra <T>::Trsm(const bool &aLeftSide,
                apDataB, aLdb);
 }
 
+template <typename T>
+void
+CPULinearAlgebra <T>::Trmm(const bool &aLeftSide,
+                           const bool &aFillUpperTri,
+                           const bool &aTranspose,
+                           const int &aNumRowsB,
+                           const int &aNumColsB,
+                           const T &aAlpha, const T *apDataA,
+                           const int &aLda, T *apDataB,
+                           const int &aLdb) {
+
+    auto side = aLeftSide ? blas::Side::Left : blas::Side::Right;
+    auto which_triangle = aFillUpperTri ? blas::Uplo::Upper : blas::Uplo::Lower;
+    auto transpose = aTranspose ? blas::Op::Trans : blas::Op::NoTrans;
+    auto layout = blas::Layout::ColMajor;
+
+    blas::trmm(layout, side, which_triangle, transpose,
+               blas::Diag::NonUnit, aNumRowsB, aNumColsB, aAlpha, apDataA, aLda,
+               apDataB, aLdb);
+}
+
+
+template <typename T>
+void
+CPULinearAlgebra <T>::Symm(const bool &aLeftSide,
+                           const bool &aFillUpperTri,
+                           const int &aNumRowsC,
+                           const int &aNumColsC,
+                           const T &aAlpha, const T *apDataA,
+                           const int &aLda, const T *apDataB,
+                           const int &aLdb, const T &aBeta,
+                           T *apDataC, const int &aLdc) {
+
+    auto side = aLeftSide ? blas::Side::Left : blas::Side::Right;
+    auto which_triangle = aFillUpperTri ? blas::Uplo::Upper : blas::Uplo::Lower;
+    auto layout = blas::Layout::ColMajor;
+
+    blas::symm(layout, side, which_triangle, aNumRowsC, aNumColsC, aAlpha,
+               apDataA, aLda, apDataB, aLdb, aBeta, apDataC, aLdc);
+}
+
+
 
 template <typename T>
 int
@@ -105,6 +317,36 @@ CPULinearAlgebra <T>::Gesv(const int &aNumN, const int &aNumNRH,
                            T *apDataB, const int &aLdb, T *apDataOut,
                            const int &aLdo,const std::string &aInternalPrecision) {
 
+    if constexpr(is_double <T>()) {
+        /* There's no half / tensorfloat arithmetic on CPU, all reduced
+         * precisions factorize in single precision */
+        if (precision::IsReducedPrecision(aInternalPrecision)) {
+            auto pIpiv = (int64_t *) aIpiv;
+            auto norm_a = lapack::lange(lapack::Norm::Inf, aNumN, aNumN,
+                                        apDataA, aLda);
+            auto converged = RefineSolution(
+                aNumN, aNumNRH, apDataA, aLda, norm_a, apDataOut, aLdo,
+                [ & ](float *apFactor) {
+                    return lapack::getrf(aNumN, aNumN, apFactor, aNumN, pIpiv);
+                },
+                [ & ](const float *apFactor, float *apSolution) {
+                    lapack::getrs(lapack::Op::NoTrans, aNumN, aNumNRH,
+                                  apFactor, aNumN, pIpiv, apSolution, aNumN);
+                },
+                [ & ](const double *apSolution, double *apResidual) {
+                    blas::gemm(blas::Layout::ColMajor, blas::Op::NoTrans,
+                               blas::Op::NoTrans, aNumN, aNumNRH, aNumN, -1,
+                               apDataA, aLda, apSolution, aLdo, 1, apResidual,
+                               aNumN);
+                });
+
+            if (converged) {
+                return 0;
+            }
+            /* Refinement stalled, fall back to a double factorization */
+        }
+    }
+
     auto rc = lapack::gesv(aNumN, aNumNRH, apDataA, aLda, (int64_t *) aIpiv,
                            apDataOut, aLdo);
 
@@ -113,6 +355,52 @@ CPULinearAlgebra <T>::Gesv(const int &aNumN, const int &aNumNRH,
 }
 
 
+template <typename T>
+int
+CPULinearAlgebra <T>::Posv(const bool &aFillUpperTri, const int &aNumN,
+                           const int &aNumNRH, T *apDataA, const int &aLda,
+                           T *apDataB, const int &aLdb,
+                           const std::string &aInternalPrecision) {
+
+    auto triangle = aFillUpperTri ? lapack::Uplo::Upper : lapack::Uplo::Lower;
+
+    if constexpr(is_double <T>()) {
+        /* There's no half / tensorfloat arithmetic on CPU, all reduced
+         * precisions factorize in single precision */
+        if (precision::IsReducedPrecision(aInternalPrecision)) {
+            auto norm_a = lapack::lansy(lapack::Norm::Inf, triangle, aNumN,
+                                        apDataA, aLda);
+            auto converged = RefineSolution(
+                aNumN, aNumNRH, apDataA, aLda, norm_a, apDataB, aLdb,
+                [ & ](float *apFactor) {
+                    return lapack::potrf(triangle, aNumN, apFactor, aNumN);
+                },
+                [ & ](const float *apFactor, float *apSolution) {
+                    lapack::potrs(triangle, aNumN, aNumNRH, apFactor, aNumN,
+                                  apSolution, aNumN);
+                },
+                [ & ](const double *apSolution, double *apResidual) {
+                    blas::symm(blas::Layout::ColMajor, blas::Side::Left,
+                               triangle, aNumN, aNumNRH, -1, apDataA, aLda,
+                               apSolution, aLdb, 1, apResidual, aNumN);
+                });
+
+            if (converged) {
+                return 0;
+            }
+            /* Refinement stalled, fall back to a double factorization */
+        }
+    }
+
+    auto rc = lapack::potrf(triangle, aNumN, apDataA, aLda);
+    if (rc == 0) {
+        rc = lapack::potrs(triangle, aNumN, aNumNRH, apDataA, aLda, apDataB,
+                           aLdb);
+    }
+    return rc;
+}
+
+
 template <typename T>
 int
 CPULinearAlgebra <T>::Getrf(const int &aNumRow, const int &aNumCol,
@@ -176,6 +464,32 @@ CPULinearAlgebra <T>::Syevd(const bool &aJobzNoVec,
 }
 
 
+template <typename T>
+int
+CPULinearAlgebra <T>::Syevr(const bool &aJobzNoVec,
+                            const bool &aFillUpperTri,
+                            const int &aNumCol, T *apDataA,
+                            const int64_t &aLda, const bool &aByIndex,
+                            const T &aLower, const T &aUpper,
+                            const int64_t &aFirstIndex,
+                            const int64_t &aLastIndex, int64_t &aNumFound,
+                            T *apDataW, T *apDataZ, const int64_t &aLdz) {
+
+    auto jobz = aJobzNoVec ? lapack::Job::NoVec : lapack::Job::Vec;
+    auto range = aByIndex ? lapack::Range::Index : lapack::Range::Value;
+    auto triangle = aFillUpperTri ? lapack::Uplo::Upper : lapack::Uplo::Lower;
+    std::vector <int64_t> support(2 * std::max(aNumCol, 1));
+
+    /** abstol = 0 , LAPACK uses its default tolerance **/
+    auto rc = lapack::syevr(jobz, range, triangle, aNumCol, apDataA, aLda,
+                            aLower, aUpper, aFirstIndex, aLastIndex, 0,
+                            &aNumFound, apDataW, apDataZ, aLdz,
+                            support.data());
+    return rc;
+
+}
+
+
 template <typename T>
 int
 CPULinearAlgebra <T>::Geqp3(const int &aNumRow, const int &aNumCol, T *apDataA,
@@ -187,6 +501,17 @@ CPULinearAlgebra <T>::Geqp3(const int &aNumRow, const int &aNumCol, T *apDataA,
 }
 
 
+template <typename T>
+int
+CPULinearAlgebra <T>::Geqrf(const int &aNumRow, const int &aNumCol, T *apDataA,
+                            const int &aLda, T *aTau) {
+
+    auto rc = lapack::geqrf(aNumRow, aNumCol, apDataA, aLda, aTau);
+    return rc;
+
+}
+
+
 template <typename T>
 int
 CPULinearAlgebra <T>::Orgqr(const int &aNumRow, const int &aNum,
@@ -198,6 +523,23 @@ CPULinearAlgebra <T>::Orgqr(const int &aNumRow, const int &aNum,
 }
 
 
+template <typename T>
+int
+CPULinearAlgebra <T>::Ormqr(const bool &aLeftSide, const bool &aTranspose,
+                            const int &aNumRow, const int &aNumCol,
+                            const int &aNumReflectors, const T *apDataA,
+                            const int &aLda, const T *aTau, T *apDataC,
+                            const int &aLdc) {
+
+    auto side = aLeftSide ? lapack::Side::Left : lapack::Side::Right;
+    auto transpose = aTranspose ? lapack::Op::Trans : lapack::Op::NoTrans;
+
+    auto rc = lapack::ormqr(side, transpose, aNumRow, aNumCol, aNumReflectors,
+                            apDataA, aLda, aTau, apDataC, aLdc);
+    return rc;
+}
+
+
 template <typename T>
 int
 CPULinearAlgebra <T>::Gecon(const std::string &aNorm, const int &aNumRow,
@@ -226,14 +568,28 @@ int CPULinearAlgebra <T>::Trcon(const std::string &aNorm,
 }
 
 
+template <typename T>
+int
+CPULinearAlgebra <T>::Pocon(const bool &aFillUpperTri, const int &aNumRow,
+                            const T *apData, const int &aLda, T aNormVal,
+                            T *aRCond) {
+    auto triangle = aFillUpperTri ? lapack::Uplo::Upper : lapack::Uplo::Lower;
+
+    auto rc = lapack::pocon(triangle, aNumRow, apData, aLda, aNormVal, aRCond);
+    return rc;
+}
+
+
 template <typename T>
 int CPULinearAlgebra <T>::Getrs(const bool &aTransposeA, const size_t &aNumRowA,
                                 const size_t &aNumRhs, const T *apDataA,
                                 const size_t &aLda, const int64_t *aIpiv,
                                 T *apDataB, const size_t &aLdb) {
 
-    MPCR_API_EXCEPTION("Getrs is not implemented in CPU", -1);
-    return 0;
+    auto transpose = aTransposeA ? lapack::Op::Trans : lapack::Op::NoTrans;
+    auto rc = lapack::getrs(transpose, aNumRowA, aNumRhs, apDataA, aLda,
+                            aIpiv, apDataB, aLdb);
+    return rc;
 }
 
 
@@ -243,4 +599,78 @@ CPULinearAlgebra <T>::Trtri(const size_t &aSideLength, T *apDataA,
                             const size_t &aLda, const bool &aUpperTri) {
     MPCR_API_EXCEPTION("Trtri is not implemented in CPU", -1);
     return 0;
-}
\ No newline at end of file
+}
+
+template <typename T>
+int
+CPULinearAlgebra <T>::Pptrf(const bool &aFillUpperTri, const int &aNumRow,
+                            T *apDataA) {
+
+    auto triangle = aFillUpperTri ? lapack::Uplo::Upper : lapack::Uplo::Lower;
+    auto rc = lapack::pptrf(triangle, aNumRow, apDataA);
+
+    return rc;
+}
+
+
+template <typename T>
+int
+CPULinearAlgebra <T>::Pptri(const bool &aFillUpperTri, const int &aNumRow,
+                            T *apDataA) {
+
+    auto triangle = aFillUpperTri ? lapack::Uplo::Upper : lapack::Uplo::Lower;
+    auto rc = lapack::pptri(triangle, aNumRow, apDataA);
+
+    return rc;
+}
+
+
+template <typename T>
+int
+CPULinearAlgebra <T>::Tptrs(const bool &aFillUpperTri, const bool &aTranspose,
+                            const int &aNumRow, const int &aNumRhs,
+                            const T *apDataA, T *apDataB, const int &aLdb) {
+
+    auto triangle = aFillUpperTri ? lapack::Uplo::Upper : lapack::Uplo::Lower;
+    auto transpose = aTranspose ? lapack::Op::Trans : lapack::Op::NoTrans;
+
+    auto rc = lapack::tptrs(triangle, transpose, lapack::Diag::NonUnit,
+                            aNumRow, aNumRhs, apDataA, apDataB, aLdb);
+
+    return rc;
+}
+
+
+template <typename T>
+void
+CPULinearAlgebra <T>::PackedSyrk(const bool &aFillLower,
+                                 const bool &aTranspose,
+                                 const int &aNumRowA, const int &aNumColA,
+                                 const T &aAlpha, const T *apDataA,
+                                 const int &aLda, const T &aBeta,
+                                 T *apDataC) {
+
+    /* BLAS has no packed syrk, every packed column of C is an independent
+     * gemv against the columns (or rows) of A. */
+    auto layout = blas::Layout::ColMajor;
+    size_t side_len = aNumRowA;
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t j = 0; j < side_len; j++) {
+        auto start = aFillLower ? j : 0;
+        auto length = aFillLower ? side_len - j : j + 1;
+        auto offset = aFillLower ? j + ( j * ( 2 * side_len - j - 1 ) / 2 )
+                                 : ( j * ( j + 1 ) / 2 );
+        auto pColumn = apDataC + offset;
+
+        if (aTranspose) {
+            blas::gemv(layout, blas::Op::Trans, aNumColA, length, aAlpha,
+                       apDataA + ( start * aLda ), aLda, apDataA + ( j * aLda ),
+                       1, aBeta, pColumn, 1);
+        } else {
+            blas::gemv(layout, blas::Op::NoTrans, length, aNumColA, aAlpha,
+                       apDataA + start, aLda, apDataA + j, aLda, aBeta, pColumn,
+                       1);
+        }
+    }
+}
@@ -85,6 +85,117 @@ GPULinearAlgebra <T>::Syrk(const bool &aFillLower,
 
 }
 
+template <typename T>
+void
+GPULinearAlgebra <T>::Gemv(const bool &aTranspose, const int &aNumRowA,
+                           const int &aNumColA, const T &aAlpha,
+                           const T *apDataA, const int &aLda,
+                           const T *apDataX, const int &aIncX, const T &aBeta,
+                           T *apDataY, const int &aIncY) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cublas_handle = context->GetCuBlasDnHandle();
+    auto transpose = aTranspose ? CUBLAS_OP_T : CUBLAS_OP_N;
+
+    auto rc = 0;
+
+    if constexpr(is_double <T>()) {
+        rc = cublasDgemv(cublas_handle, transpose, aNumRowA, aNumColA,
+                         &aAlpha, apDataA, aLda, apDataX, aIncX, &aBeta,
+                         apDataY, aIncY);
+    } else {
+        rc = cublasSgemv(cublas_handle, transpose, aNumRowA, aNumColA,
+                         &aAlpha, apDataA, aLda, apDataX, aIncX, &aBeta,
+                         apDataY, aIncY);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Performing Gemv on GPU", rc);
+    }
+}
+
+
+template <typename T>
+T
+GPULinearAlgebra <T>::Dot(const int &aNumElements, const T *apDataX,
+                          const int &aIncX, const T *apDataY,
+                          const int &aIncY) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cublas_handle = context->GetCuBlasDnHandle();
+
+    T result = 0;
+    auto rc = 0;
+
+    /* The handle is in host pointer mode, the call blocks until the result
+     * is copied back. */
+    if constexpr(is_double <T>()) {
+        rc = cublasDdot(cublas_handle, aNumElements, apDataX, aIncX, apDataY,
+                        aIncY, &result);
+    } else {
+        rc = cublasSdot(cublas_handle, aNumElements, apDataX, aIncX, apDataY,
+                        aIncY, &result);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Performing Dot on GPU", rc);
+    }
+
+    return result;
+}
+
+
+template <typename T>
+void
+GPULinearAlgebra <T>::Ger(const int &aNumRowA, const int &aNumColA,
+                          const T &aAlpha, const T *apDataX, const int &aIncX,
+                          const T *apDataY, const int &aIncY, T *apDataA,
+                          const int &aLda) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cublas_handle = context->GetCuBlasDnHandle();
+
+    auto rc = 0;
+
+    if constexpr(is_double <T>()) {
+        rc = cublasDger(cublas_handle, aNumRowA, aNumColA, &aAlpha, apDataX,
+                        aIncX, apDataY, aIncY, apDataA, aLda);
+    } else {
+        rc = cublasSger(cublas_handle, aNumRowA, aNumColA, &aAlpha, apDataX,
+                        aIncX, apDataY, aIncY, apDataA, aLda);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Performing Ger on GPU", rc);
+    }
+}
+
+
+template <typename T>
+void
+GPULinearAlgebra <T>::Axpy(const int &aNumElements, const T &aAlpha,
+                           const T *apDataX, const int &aIncX, T *apDataY,
+                           const int &aIncY) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cublas_handle = context->GetCuBlasDnHandle();
+
+    auto rc = 0;
+
+    if constexpr(is_double <T>()) {
+        rc = cublasDaxpy(cublas_handle, aNumElements, &aAlpha, apDataX, aIncX,
+                         apDataY, aIncY);
+    } else {
+        rc = cublasSaxpy(cublas_handle, aNumElements, &aAlpha, apDataX, aIncX,
+                         apDataY, aIncY);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Performing Axpy on GPU", rc);
+    }
+}
+
+
 
 template <typename T>
 void
@@ -122,6 +233,80 @@ GPULinearAlgebra <T>::Trsm(const bool &aLeftSide,
     }
 }
 
+template <typename T>
+void
+GPULinearAlgebra <T>::Trmm(const bool &aLeftSide,
+                           const bool &aFillUpperTri,
+                           const bool &aTranspose,
+                           const int &aNumRowsB,
+                           const int &aNumColsB,
+                           const T &aAlpha, const T *apDataA,
+                           const int &aLda, T *apDataB,
+                           const int &aLdb) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cublas_handle = context->GetCuBlasDnHandle();
+    auto side = aLeftSide ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto transpose = aTranspose ? CUBLAS_OP_T : CUBLAS_OP_N;
+    auto triangle = aFillUpperTri ? CUBLAS_FILL_MODE_UPPER
+                                  : CUBLAS_FILL_MODE_LOWER;
+    auto diag = CUBLAS_DIAG_NON_UNIT;
+
+    auto rc = 0;
+
+    /* cuBLAS trmm is out of place, passing B as the output C with the same
+     * leading dimension runs it in place as in BLAS. */
+    if constexpr(is_double <T>()) {
+        rc = cublasDtrmm(cublas_handle, side, triangle, transpose, diag,
+                         aNumRowsB, aNumColsB, &aAlpha, apDataA, aLda,
+                         apDataB, aLdb, apDataB, aLdb);
+    } else {
+        rc = cublasStrmm(cublas_handle, side, triangle, transpose, diag,
+                         aNumRowsB, aNumColsB, &aAlpha, apDataA, aLda,
+                         apDataB, aLdb, apDataB, aLdb);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Performing Trmm on GPU", rc);
+    }
+}
+
+
+template <typename T>
+void
+GPULinearAlgebra <T>::Symm(const bool &aLeftSide,
+                           const bool &aFillUpperTri,
+                           const int &aNumRowsC,
+                           const int &aNumColsC,
+                           const T &aAlpha, const T *apDataA,
+                           const int &aLda, const T *apDataB,
+                           const int &aLdb, const T &aBeta,
+                           T *apDataC, const int &aLdc) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cublas_handle = context->GetCuBlasDnHandle();
+    auto side = aLeftSide ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto triangle = aFillUpperTri ? CUBLAS_FILL_MODE_UPPER
+                                  : CUBLAS_FILL_MODE_LOWER;
+
+    auto rc = 0;
+
+    if constexpr(is_double <T>()) {
+        rc = cublasDsymm(cublas_handle, side, triangle, aNumRowsC, aNumColsC,
+                         &aAlpha, apDataA, aLda, apDataB, aLdb, &aBeta,
+                         apDataC, aLdc);
+    } else {
+        rc = cublasSsymm(cublas_handle, side, triangle, aNumRowsC, aNumColsC,
+                         &aAlpha, apDataA, aLda, apDataB, aLdb, &aBeta,
+                         apDataC, aLdc);
+    }
+
+    if (rc != 0) {
+        MPCR_API_EXCEPTION("Error While Performing Symm on GPU", rc);
+    }
+}
+
+
 
 template <typename T>
 int
@@ -164,6 +349,28 @@ GPULinearAlgebra <T>::Potrf(const bool &aFillUpperTri,
 }
 
 
+template <typename T>
+int
+GPULinearAlgebra <T>::Posv(const bool &aFillUpperTri, const int &aNumN,
+                           const int &aNumNRH, T *apDataA, const int &aLda,
+                           T *apDataB, const int &aLdb,
+                           const std::string &aInternalPrecision) {
+
+    /* The factorization runs in the precision of A on GPU */
+    auto rc = this->Potrf(aFillUpperTri, aNumN, apDataA, aLda);
+    if (rc != 0) {
+        return rc;
+    }
+
+    this->Trsm(true, aFillUpperTri, aFillUpperTri, aNumN, aNumNRH, 1, apDataA,
+               aLda, apDataB, aLdb);
+    this->Trsm(true, aFillUpperTri, !aFillUpperTri, aNumN, aNumNRH, 1,
+               apDataA, aLda, apDataB, aLdb);
+
+    return rc;
+}
+
+
 template <typename T>
 int
 GPULinearAlgebra <T>::Potri(const bool &aFillUpperTri,
@@ -211,8 +418,8 @@ GPULinearAlgebra <T>::Gesv(const int &aNumN, const int &aNumNRH,
 
     auto context = ContextManager::GetOperationContext();
     auto cusolver_handle = context->GetCusolverDnHandle();
-    std::string internal_precision;
-    std::transform(aInternalPrecision.begin(), aInternalPrecision.end(),
+    std::string internal_precision = aInternalPrecision;
+    std::transform(internal_precision.begin(), internal_precision.end(),
                    internal_precision.begin(), ::tolower);
 
     size_t lWork_device = 0;
@@ -560,6 +767,46 @@ GPULinearAlgebra <T>::Geqp3(const int &aNumRow, const int &aNumCol, T *apDataA,
 }
 
 
+template <typename T>
+int
+GPULinearAlgebra <T>::Geqrf(const int &aNumRow, const int &aNumCol, T *apDataA,
+                            const int &aLda, T *aTau) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cusolver_handle = context->GetCusolverDnHandle();
+
+    size_t lWork_device = 0;
+    size_t lWork_host = 0;
+
+    auto data_type = is_double <T>() ? CUDA_R_64F : CUDA_R_32F;
+
+    cusolverDnXgeqrf_bufferSize(cusolver_handle, NULL, aNumRow, aNumCol,
+                                data_type, apDataA, aLda, data_type, aTau,
+                                data_type, &lWork_device, &lWork_host);
+
+    auto work_space_dev = context->RequestWorkBufferDevice(lWork_device);
+    auto work_space_host = context->RequestWorkBufferHost(lWork_host);
+
+    cusolverDnXgeqrf(cusolver_handle, NULL, aNumRow, aNumCol, data_type,
+                     apDataA,
+                     aLda, data_type, aTau, data_type, work_space_dev,
+                     lWork_device, work_space_host, lWork_host,
+                     context->GetInfoPointer());
+
+    int rc = 0;
+    memory::MemCpy((char *) &rc, (char *) context->GetInfoPointer(),
+                   sizeof(int), context,
+                   memory::MemoryTransfer::DEVICE_TO_HOST);
+
+    if (context->GetRunMode() == kernels::RunMode::SYNC) {
+        context->FreeWorkBufferHost();
+    }
+
+    return rc;
+
+}
+
+
 template <typename T>
 int
 GPULinearAlgebra <T>::Orgqr(const int &aNumRow, const int &aNum,
@@ -590,6 +837,43 @@ GPULinearAlgebra <T>::Orgqr(const int &aNumRow, const int &aNum,
 }
 
 
+template <typename T>
+int
+GPULinearAlgebra <T>::Ormqr(const bool &aLeftSide, const bool &aTranspose,
+                            const int &aNumRow, const int &aNumCol,
+                            const int &aNumReflectors, const T *apDataA,
+                            const int &aLda, const T *aTau, T *apDataC,
+                            const int &aLdc) {
+
+    auto context = ContextManager::GetOperationContext();
+    auto cusolver_handle = context->GetCusolverDnHandle();
+    auto side = aLeftSide ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto transpose = aTranspose ? CUBLAS_OP_T : CUBLAS_OP_N;
+    int lWork_device = 0;
+
+    CUDA_FUNCTIONS_NAME_DISPATCHER(cusolverDn, ormqr_bufferSize,
+                                   cusolver_handle, side, transpose, aNumRow,
+                                   aNumCol, aNumReflectors, apDataA, aLda,
+                                   aTau, apDataC, aLdc, &lWork_device)
+
+    auto work_space_dev = (T *) context->RequestWorkBufferDevice(
+        lWork_device * sizeof(T));
+
+    CUDA_FUNCTIONS_NAME_DISPATCHER(cusolverDn, ormqr, cusolver_handle, side,
+                                   transpose, aNumRow, aNumCol, aNumReflectors,
+                                   apDataA, aLda, aTau, apDataC, aLdc,
+                                   work_space_dev, lWork_device,
+                                   context->GetInfoPointer())
+
+    int rc = 0;
+    memory::MemCpy((char *) &rc, (char *) context->GetInfoPointer(),
+                   sizeof(int), context,
+                   memory::MemoryTransfer::DEVICE_TO_HOST);
+
+    return rc;
+}
+
+
 template <typename T>
 int
 GPULinearAlgebra <T>::Gecon(const std::string &aNorm, const int &aNumRow,
@@ -637,6 +921,33 @@ int GPULinearAlgebra <T>::Trcon(const std::string &aNorm,
 }
 
 
+template <typename T>
+int
+GPULinearAlgebra <T>::Pocon(const bool &aFillUpperTri, const int &aNumRow,
+                            const T *apData, const int &aLda, T aNormVal,
+                            T *aRCond) {
+    // NO GPU Implementation
+    MPCR_API_EXCEPTION("No Pocon implementation for GPU", -1);
+    return 0;
+}
+
+
+template <typename T>
+int
+GPULinearAlgebra <T>::Syevr(const bool &aJobzNoVec,
+                            const bool &aFillUpperTri,
+                            const int &aNumCol, T *apDataA,
+                            const int64_t &aLda, const bool &aByIndex,
+                            const T &aLower, const T &aUpper,
+                            const int64_t &aFirstIndex,
+                            const int64_t &aLastIndex, int64_t &aNumFound,
+                            T *apDataW, T *apDataZ, const int64_t &aLdz) {
+    // NO GPU Implementation
+    MPCR_API_EXCEPTION("No Syevr implementation for GPU", -1);
+    return 0;
+}
+
+
 template <typename T>
 int GPULinearAlgebra <T>::Getrs(const bool &aTransposeA, const size_t &aNumRowA,
                                 const size_t &aNumRhs, const T *apDataA,
@@ -711,6 +1022,50 @@ GPULinearAlgebra <T>::Trtri(const size_t &aSideLength, T *apDataA,
 }
 
 
+template <typename T>
+int
+GPULinearAlgebra <T>::Pptrf(const bool &aFillUpperTri, const int &aNumRow,
+                            T *apDataA) {
+    // NO GPU Implementation
+    MPCR_API_EXCEPTION("No Pptrf implementation for GPU", -1);
+    return 0;
+}
+
+
+template <typename T>
+int
+GPULinearAlgebra <T>::Pptri(const bool &aFillUpperTri, const int &aNumRow,
+                            T *apDataA) {
+    // NO GPU Implementation
+    MPCR_API_EXCEPTION("No Pptri implementation for GPU", -1);
+    return 0;
+}
+
+
+template <typename T>
+int
+GPULinearAlgebra <T>::Tptrs(const bool &aFillUpperTri, const bool &aTranspose,
+                            const int &aNumRow, const int &aNumRhs,
+                            const T *apDataA, T *apDataB, const int &aLdb) {
+    // NO GPU Implementation
+    MPCR_API_EXCEPTION("No Tptrs implementation for GPU", -1);
+    return 0;
+}
+
+
+template <typename T>
+void
+GPULinearAlgebra <T>::PackedSyrk(const bool &aFillLower,
+                                 const bool &aTranspose,
+                                 const int &aNumRowA, const int &aNumColA,
+                                 const T &aAlpha, const T *apDataA,
+                                 const int &aLda, const T &aBeta,
+                                 T *apDataC) {
+    // NO GPU Implementation
+    MPCR_API_EXCEPTION("No PackedSyrk implementation for GPU", -1);
+}
+
+
 
 /************************* Half Only Routines ***************************/
 
@@ -170,17 +170,17 @@ GetRankKernel(T *apData, size_t aNumRow, size_t aNumCol, int *apRank) {
 template <typename T>
 __global__
 void
-IsSymmetricKernel(T *apInput, size_t aSideLength, bool *aOutput) {
+IsSymmetricKernel(T *apInput, size_t aSideLength, T aTolerance,
+                  bool *aOutput) {
 
     size_t col = blockIdx.x * blockDim.x + threadIdx.x;
     size_t row = blockIdx.y * blockDim.y + threadIdx.y;
 
-    T epsilon = 0.001;
     if (row < aSideLength && col < aSideLength && row > col) {
         size_t idx_one = row * aSideLength + col;
         size_t idx_two = col * aSideLength + row;
         T val = std::fabs(apInput[ idx_one ] - apInput[ idx_two ]);
-        if (val > epsilon) {
+        if (val > aTolerance) {
             *aOutput = false;
         }
     }
@@ -244,6 +244,12 @@ GPUHelpers <T>::FillTriangle(DataType &aInput, const double &aValue,
 template <typename T>
 void
 GPUHelpers <T>::Transpose(DataType &aInput, kernels::RunContext *aContext) {
+    /* The stored data is already the transpose of the reported matrix. */
+    if (aInput.IsTransposed()) {
+        aInput.LazyTranspose();
+        return;
+    }
+
     auto row = aInput.GetNRow();
     auto col = aInput.GetNCol();
     auto pData = (T *) aInput.GetData(GPU);
@@ -324,6 +330,7 @@ GPUHelpers <T>::Symmetrize(DataType &aInput, const bool &aToUpperTriangle,
 
     aContext->Sync();
     aInput.SetData((char *) pData, GPU);
+    aInput.SetProperty(MATRIX_SYMMETRIC);
 
 
 }
@@ -518,6 +525,7 @@ GPUHelpers <T>::GetRank(DataType &aInput, T &aRank,
 template <typename T>
 void
 GPUHelpers <T>::IsSymmetric(DataType &aInput, bool &aOutput,
+                            const double &aTolerance,
                             kernels::RunContext *aContext) {
 
     aOutput = true;
@@ -542,7 +550,7 @@ GPUHelpers <T>::IsSymmetric(DataType &aInput, bool &aOutput,
 
     IsSymmetricKernel <T><<<grid_size,
     block_size, 0, aContext->GetStream()>>>
-        (pData, side_len, output);
+        (pData, side_len, (T) aTolerance, output);
 
     aContext->Sync();
 
@@ -299,15 +299,11 @@ TEST_DATA_HOLDER_CPU() {
         }
 
         data_a.SetDataPointer((char *) pdata_host, n * sizeof(float), CPU);
-        auto pdata_host_raw = data_a.GetDataPointer(CPU);
 
 
         data_a.ChangePrecision <float, double>();
         REQUIRE(data_a.GetSize() == n * sizeof(double));
         auto pdata_host_double = (double *) data_a.GetDataPointer(CPU);
-        auto pdata_host_new = data_a.GetDataPointer(CPU);
-
-        REQUIRE(pdata_host_raw != pdata_host_new);
 
         for (auto i = 0; i < n; i++) {
             REQUIRE(pdata_host_double[ i ] == 2 * i);
@@ -316,6 +312,29 @@ TEST_DATA_HOLDER_CPU() {
         data_a.ChangePrecision <double, double>();
         REQUIRE(data_a.GetSize() == n * sizeof(double));
         REQUIRE(pdata_host_double == (double *) data_a.GetDataPointer(CPU));
+    }SECTION("Changing precision in place on Host") {
+        auto size = 1001;
+        DataHolder data_a(size * sizeof(double), CPU);
+        auto pdata_host = (double *) data_a.GetDataPointer(CPU);
+        for (auto i = 0; i < size; i++) {
+            pdata_host[ i ] = i + 0.5;
+        }
+
+        data_a.ChangePrecision <double, float>();
+        REQUIRE(data_a.GetSize() == size * sizeof(float));
+        auto pdata_host_float = (float *) data_a.GetDataPointer(CPU);
+        for (auto i = 0; i < size; i++) {
+            REQUIRE(pdata_host_float[ i ] == i + 0.5);
+        }
+
+        data_a.ChangePrecision <float, double>();
+        REQUIRE(data_a.GetSize() == size * sizeof(double));
+        pdata_host = (double *) data_a.GetDataPointer(CPU);
+        for (auto i = 0; i < size; i++) {
+            REQUIRE(pdata_host[ i ] == i + 0.5);
+        }
+
+        REQUIRE_THROWS(data_a.GetDataPointer(GPU));
     }
 }
 #endif
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <libraries/catch/catch.hpp>
+#include <utilities/MPCRDispatcher.hpp>
+#include <data-units/MPCRFactorization.hpp>
+#include <operations/LinearAlgebra.hpp>
+
+
+using namespace mpcr::precision;
+using namespace mpcr::operations;
+using namespace std;
+
+
+void
+TEST_MPCR_FACTORIZATION() {
+
+    auto n = 5;
+    vector <double> values_sym(n * n);
+    vector <double> values_gen(n * n);
+    for (auto i = 0; i < n; i++) {
+        for (auto j = 0; j < n; j++) {
+            values_sym[ i + ( j * n ) ] = 1.0 / ( i + j + 1 ) + ( i == j );
+            values_gen[ i + ( j * n ) ] = (double) ( ( i * 7 + j * 3 ) % 11 ) -
+                                          5 + ( i == j ) * 2;
+        }
+    }
+    vector <double> values_b = {1, -2, 3, 0.5, 4, 2, 2, -1, 0, 1};
+
+    DataType b(values_b, DOUBLE);
+    b.ToMatrix(n, 2);
+
+    SECTION("Factorization Solve, Inverse, Determinant and RCond") {
+        cout << "Testing MPCR Factorization ..." << endl;
+
+        for (auto type: {"lu", "chol", "qr"}) {
+            auto &values = string(type) == "chol" ? values_sym : values_gen;
+            DataType a(values, DOUBLE);
+            a.ToMatrix(n, n);
+
+            MPCRFactorization factor(a, type);
+            REQUIRE(factor.IsMPCRFactorization());
+            REQUIRE(factor.GetNRow() == n);
+            REQUIRE(factor.GetPrecision() == DOUBLE);
+            REQUIRE_FALSE(factor.IsSingular());
+
+            DataType validate(DOUBLE);
+            DataType dump(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, b, validate, false)
+
+            /* Repeated solves reuse the same factors */
+            for (auto k = 0; k < 2; k++) {
+                DataType x(DOUBLE);
+                factor.Solve(b, x);
+                REQUIRE(x.GetNRow() == n);
+                REQUIRE(x.GetNCol() == 2);
+                for (auto i = 0; i < x.GetSize(); i++) {
+                    REQUIRE(fabs(x.GetVal(i) - validate.GetVal(i)) < 1e-10);
+                }
+            }
+
+            DataType inverse(DOUBLE);
+            DataType validate_inverse(DOUBLE);
+            factor.Inverse(inverse);
+            SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, dump, validate_inverse,
+                            true)
+            for (auto i = 0; i < n * n; i++) {
+                REQUIRE(fabs(inverse.GetVal(i) - validate_inverse.GetVal(i)) <
+                        1e-10);
+            }
+
+            double modulus = 0;
+            double validate_modulus = 0;
+            int sign = 0;
+            int validate_sign = 0;
+            factor.Determinant(modulus, sign);
+            SIMPLE_DISPATCH(DOUBLE, linear::Determinant, a, validate_modulus,
+                            validate_sign, true)
+            REQUIRE(sign == validate_sign);
+            REQUIRE(fabs(modulus - validate_modulus) < 1e-10);
+
+            if (string(type) != "qr") {
+                double validate_rcond = 0;
+                SIMPLE_DISPATCH(DOUBLE, linear::ReciprocalCondition, a,
+                                validate_rcond, "O", false)
+                REQUIRE(fabs(factor.ReciprocalCondition("O") -
+                             validate_rcond) < 1e-10);
+            } else {
+                REQUIRE(factor.ReciprocalCondition("O") > 0);
+            }
+        }
+    }
+
+    SECTION("Factorization Least Squares and Errors") {
+        /* Least squares solution satisfies t(A) A x = t(A) b */
+        auto row = 8;
+        auto col = 3;
+        vector <double> values_a(row * col);
+        vector <double> values_y(row);
+        for (auto i = 0; i < row * col; i++) {
+            values_a[ i ] = (double) ( ( i * 5 ) % 7 ) - 3;
+        }
+        for (auto i = 0; i < row; i++) {
+            values_y[ i ] = i * 0.5 - 1;
+        }
+
+        DataType a(values_a, DOUBLE);
+        a.ToMatrix(row, col);
+        DataType y(values_y, FLOAT);
+
+        MPCRFactorization factor(a, "QR");
+        DataType x(DOUBLE);
+        factor.Solve(y, x);
+        REQUIRE(x.GetPrecision() == DOUBLE);
+        REQUIRE(x.GetNRow() == col);
+        REQUIRE(y.IsMatrix() == false);
+
+        DataType ata(DOUBLE);
+        DataType aty(DOUBLE);
+        DataType atax(DOUBLE);
+        y.ToMatrix(row, 1);
+        DataType y_double(y, DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, a, ata, true, false)
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, y_double, aty, true,
+                        false)
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, ata, x, atax, false,
+                        false)
+        for (auto i = 0; i < col; i++) {
+            REQUIRE(fabs(atax.GetVal(i) - aty.GetVal(i)) < 1e-8);
+        }
+
+        DataType inverse(DOUBLE);
+        double modulus = 0;
+        int sign = 0;
+        REQUIRE_THROWS(factor.Inverse(inverse));
+        REQUIRE_THROWS(factor.Determinant(modulus, sign));
+        REQUIRE_THROWS(MPCRFactorization(a, "lu"));
+        REQUIRE_THROWS(MPCRFactorization(a, "svd"));
+
+        /* Singular matrix */
+        vector <double> values_singular = {1, 2, 2, 4};
+        DataType singular(values_singular, DOUBLE);
+        singular.ToMatrix(2, 2);
+        MPCRFactorization factor_singular(singular, "lu");
+        REQUIRE(factor_singular.IsSingular());
+        factor_singular.Determinant(modulus, sign, false);
+        REQUIRE(modulus == 0);
+        REQUIRE(factor_singular.ReciprocalCondition() == 0);
+        REQUIRE_THROWS(factor_singular.Solve(b, x));
+        REQUIRE_THROWS(MPCRFactorization(singular, "chol"));
+
+        /* Single precision factors */
+        DataType a_float(values_sym, FLOAT);
+        a_float.ToMatrix(n, n);
+        MPCRFactorization factor_float(a_float, "chol");
+        factor_float.Solve(b, x);
+        REQUIRE(x.GetPrecision() == FLOAT);
+    }
+}
+
+
+TEST_CASE("MPCRFactorizationTest", "[MPCRFactorization]") {
+    mpcr::kernels::ContextManager::GetOperationContext()->SetOperationPlacement(
+        CPU);
+    TEST_MPCR_FACTORIZATION();
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <libraries/catch/catch.hpp>
+#include <data-units/MPCRTile.hpp>
+
+
+using namespace mpcr::precision;
+using namespace std;
+
+
+void
+TEST_MPCR_TILE() {
+
+    /* 5x4 matrix split into 2x3 tiles, grid is 3x2 with cut edge tiles */
+    vector <double> values;
+    for (auto i = 0; i < 20; i++) {
+        values.push_back(i + 1);
+    }
+
+    SECTION("Tile Construction") {
+        cout << "Testing MPCR Tile ..." << endl;
+
+        vector <string> precisions = {"double", "float", "float", "float",
+                                      "double", "float"};
+        MPCRTile a(5, 4, 2, 3, values, precisions);
+
+        REQUIRE(a.IsMPCRTile());
+        REQUIRE(a.GetNRow() == 5);
+        REQUIRE(a.GetNCol() == 4);
+        REQUIRE(a.GetGridNRow() == 3);
+        REQUIRE(a.GetGridNCol() == 2);
+
+        REQUIRE(a.GetTile(0, 0)->GetPrecision() == DOUBLE);
+        REQUIRE(a.GetTile(1, 1)->GetPrecision() == DOUBLE);
+        REQUIRE(a.GetTile(2, 0)->GetPrecision() == FLOAT);
+
+        REQUIRE(a.GetTile(2, 1)->GetNRow() == 1);
+        REQUIRE(a.GetTile(2, 1)->GetNCol() == 1);
+        REQUIRE(a.GetTile(0, 0)->GetNRow() == 2);
+        REQUIRE(a.GetTile(0, 0)->GetNCol() == 3);
+
+        for (auto i = 0; i < 5; i++) {
+            for (auto j = 0; j < 4; j++) {
+                REQUIRE(a.GetVal(i, j) == values[ i + ( j * 5 ) ]);
+            }
+        }
+
+        a.SetVal(4, 3, -1);
+        REQUIRE(a.GetVal(4, 3) == -1);
+        REQUIRE(a.GetTile(2, 1)->GetVal(0) == -1);
+
+        REQUIRE_THROWS(a.GetVal(5, 0));
+        REQUIRE_THROWS(a.GetTile(3, 0));
+        REQUIRE_THROWS(MPCRTile(5, 4, 2, 3, values, {"float", "double"}));
+        REQUIRE_THROWS(MPCRTile(5, 4, 6, 3, values, {"float"}));
+    }
+
+    SECTION("Tile Precision and Assembly") {
+        MPCRTile a(5, 4, 2, 3, values, {"float"});
+        MPCRTile b(a);
+
+        a.ChangeTilePrecision(1, 0, DOUBLE);
+        REQUIRE(a.GetTile(1, 0)->GetPrecision() == DOUBLE);
+        REQUIRE(b.GetTile(1, 0)->GetPrecision() == FLOAT);
+
+        vector <double> tile_values = {10, 20, 30, 40, 50, 60};
+        DataType tile(tile_values, DOUBLE);
+        tile.ToMatrix(2, 3);
+        b.InsertTile(tile, 1, 0);
+        REQUIRE(b.GetVal(2, 0) == 10);
+        REQUIRE(b.GetVal(3, 2) == 60);
+
+        DataType wrong_tile(tile_values, DOUBLE);
+        wrong_tile.ToMatrix(3, 2);
+        REQUIRE_THROWS(b.InsertTile(wrong_tile, 1, 0));
+
+        DataType output(FLOAT);
+        a.GetMatrix(output, DOUBLE);
+        REQUIRE(output.GetPrecision() == DOUBLE);
+        REQUIRE(output.GetNRow() == 5);
+        REQUIRE(output.GetNCol() == 4);
+        for (auto i = 0; i < values.size(); i++) {
+            REQUIRE(output.GetVal(i) == values[ i ]);
+        }
+
+        MPCRTile zeros(3, 3, 2, 2, FLOAT);
+        REQUIRE(zeros.GetGridNRow() == 2);
+        REQUIRE(zeros.GetVal(2, 2) == 0);
+    }
+}
+
+
+TEST_CASE("MPCRTileTest", "[MPCRTile]") {
+    TEST_MPCR_TILE();
+}
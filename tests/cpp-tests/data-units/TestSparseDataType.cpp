@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <libraries/catch/catch.hpp>
+#include <data-units/SparseDataType.hpp>
+
+
+using namespace mpcr::precision;
+using namespace std;
+
+
+void
+TEST_SPARSE_DATA_TYPE() {
+
+    /* 4x3 matrix
+     * | 1 0 2 |
+     * | 0 0 3 |
+     * | 0 0 0 |
+     * | 4 5 0 |
+     */
+    vector <size_t> row_idx = {3, 0, 1, 0, 3, 0};
+    vector <size_t> col_idx = {1, 2, 2, 0, 0, 2};
+    vector <double> values = {5, 1.5, 3, 1, 4, 0.5};
+    vector <double> validate = {1, 0, 0, 4, 0, 0, 0, 5, 2, 3, 0, 0};
+
+    SECTION("Triplet Construction") {
+        cout << "Testing Sparse DataType ..." << endl;
+
+        SparseDataType a(row_idx, col_idx, values, 4, 3, DOUBLE);
+        REQUIRE(a.IsSparseDataType());
+        REQUIRE(a.GetNRow() == 4);
+        REQUIRE(a.GetNCol() == 3);
+        REQUIRE(a.GetNnz() == 5);
+        REQUIRE(a.GetFormat() == SparseFormat::CSR);
+
+        vector <int64_t> pointers = {0, 2, 3, 3, 5};
+        vector <int64_t> indices = {0, 2, 2, 0, 1};
+        auto pPointers = a.GetPointers();
+        auto pIndices = a.GetIndices();
+        for (auto i = 0; i < pointers.size(); i++) {
+            REQUIRE(pPointers[ i ] == pointers[ i ]);
+        }
+        for (auto i = 0; i < indices.size(); i++) {
+            REQUIRE(pIndices[ i ] == indices[ i ]);
+        }
+
+        for (auto i = 0; i < 4; i++) {
+            for (auto j = 0; j < 3; j++) {
+                REQUIRE(a.GetVal(i, j) == validate[ i + ( j * 4 ) ]);
+            }
+        }
+
+        REQUIRE_THROWS(a.GetVal(4, 0));
+        REQUIRE_THROWS(SparseDataType(row_idx, col_idx, values, 3, 3, DOUBLE));
+        REQUIRE_THROWS(SparseDataType(HALF));
+    }
+
+    SECTION("Format Conversion") {
+        SparseDataType a(row_idx, col_idx, values, 4, 3, FLOAT);
+        SparseDataType b(row_idx, col_idx, values, 4, 3, FLOAT,
+                         SparseFormat::CSC);
+
+        a.ConvertFormat(SparseFormat::CSC);
+        REQUIRE(a.GetFormat() == SparseFormat::CSC);
+        REQUIRE(a.GetNnz() == b.GetNnz());
+
+        auto pPointers_a = a.GetPointers();
+        auto pPointers_b = b.GetPointers();
+        for (auto i = 0; i < 4; i++) {
+            REQUIRE(pPointers_a[ i ] == pPointers_b[ i ]);
+        }
+
+        auto pIndices_a = a.GetIndices();
+        auto pIndices_b = b.GetIndices();
+        auto pValues_a = (float *) a.GetValues();
+        auto pValues_b = (float *) b.GetValues();
+        for (auto i = 0; i < a.GetNnz(); i++) {
+            REQUIRE(pIndices_a[ i ] == pIndices_b[ i ]);
+            REQUIRE(pValues_a[ i ] == pValues_b[ i ]);
+        }
+
+        a.ConvertFormat(SparseFormat::CSR);
+        for (auto i = 0; i < 4; i++) {
+            for (auto j = 0; j < 3; j++) {
+                REQUIRE(a.GetVal(i, j) == validate[ i + ( j * 4 ) ]);
+            }
+        }
+    }
+
+    SECTION("Transpose and Dense") {
+        SparseDataType a(row_idx, col_idx, values, 4, 3, DOUBLE);
+        SparseDataType b(a);
+
+        b.Transpose();
+        REQUIRE(b.GetNRow() == 3);
+        REQUIRE(b.GetNCol() == 4);
+        REQUIRE(b.GetFormat() == SparseFormat::CSC);
+        for (auto i = 0; i < 4; i++) {
+            for (auto j = 0; j < 3; j++) {
+                REQUIRE(b.GetVal(j, i) == a.GetVal(i, j));
+            }
+        }
+
+        DataType dense(FLOAT);
+        a.ToDense(dense);
+        REQUIRE(dense.GetPrecision() == DOUBLE);
+        REQUIRE(dense.IsMatrix());
+        REQUIRE(dense.GetNRow() == 4);
+        REQUIRE(dense.GetNCol() == 3);
+        for (auto i = 0; i < validate.size(); i++) {
+            REQUIRE(dense.GetVal(i) == validate[ i ]);
+        }
+
+        SparseDataType zeros({}, {}, {}, 2, 2, DOUBLE);
+        REQUIRE(zeros.GetNnz() == 0);
+        REQUIRE(zeros.GetVal(1, 1) == 0);
+        zeros.ToDense(dense);
+        REQUIRE(dense.GetSize() == 4);
+        for (auto i = 0; i < 4; i++) {
+            REQUIRE(dense.GetVal(i) == 0);
+        }
+    }
+}
+
+
+TEST_CASE("SparseDataTypeTest", "[SparseDataType]") {
+    TEST_SPARSE_DATA_TYPE();
+}
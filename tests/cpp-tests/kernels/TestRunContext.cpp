@@ -8,6 +8,7 @@
 
 
 #include <kernels/RunContext.hpp>
+#include <kernels/MemoryHandler.hpp>
 #include <libraries/catch/catch.hpp>
 
 
@@ -83,6 +84,46 @@ TEST_RUN_CONTEXT(){
     REQUIRE(context_test_placement.GetOperationPlacement()==CPU);
     REQUIRE(context_test_placement.GetRunMode()==mpcr::kernels::RunMode::ASYNC);
 
+    cout << "Testing Run Context Scratch Arena ..." << endl;
+    REQUIRE(context.RequestScratchBufferHost(0, 0) == nullptr);
+    REQUIRE(context.GetScratchBufferSizeHost() == 0);
+
+    auto pscratch = context.RequestScratchBufferHost(500, 0);
+    REQUIRE(pscratch != nullptr);
+    auto pscratch_two = context.RequestScratchBufferHost(200, 2);
+    REQUIRE(pscratch_two != nullptr);
+    REQUIRE(pscratch_two != pscratch);
+    REQUIRE(context.GetScratchBufferSizeHost() == 700);
+
+    /** Smaller or equal requests reuse the slot buffer **/
+    REQUIRE(context.RequestScratchBufferHost(300, 0) == pscratch);
+    REQUIRE(context.RequestScratchBufferHost(500, 0) == pscratch);
+    REQUIRE(context.GetScratchBufferSizeHost() == 700);
+
+    context.RequestScratchBufferHost(800, 0);
+    REQUIRE(context.GetScratchBufferSizeHost() == 1000);
+
+    /** Copies don't share the arena **/
+    RunContext context_copy_three(context);
+    REQUIRE(context_copy_three.GetScratchBufferSizeHost() == 0);
+
+    /** Requests above the limit are plain allocations, not kept **/
+    auto limit = context.GetScratchLimitHost();
+    REQUIRE(context.RequestScratchBufferHost(limit + 1, 1) == nullptr);
+    REQUIRE(context.IsScratchBufferHost(pscratch_two));
+    auto plarge = mpcr::memory::RequestScratchArray(limit + 1,
+                                                    mpcr::definitions::CPU,
+                                                    &context, 1);
+    REQUIRE(plarge != nullptr);
+    REQUIRE(!context.IsScratchBufferHost(plarge));
+    REQUIRE(context.GetScratchBufferSizeHost() == 1000);
+    mpcr::memory::ReleaseScratchArray(plarge, mpcr::definitions::CPU,
+                                      &context);
+    REQUIRE(plarge == nullptr);
+
+    context.FreeScratchBuffersHost();
+    REQUIRE(context.GetScratchBufferSizeHost() == 0);
+
 
 }
 
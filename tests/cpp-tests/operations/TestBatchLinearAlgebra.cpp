@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <libraries/catch/catch.hpp>
+#include <utilities/MPCRDispatcher.hpp>
+#include <operations/LinearAlgebra.hpp>
+#include <operations/BatchLinearAlgebra.hpp>
+#include <kernels/BlasThreading.hpp>
+#include <memory>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+using namespace std;
+using namespace mpcr::precision;
+using namespace mpcr::operations;
+
+
+/* Symmetric positive definite matrices of different sizes and precisions */
+vector <unique_ptr <DataType>>
+GenerateBatch(const vector <size_t> &aSizes,
+              const vector <Precision> &aPrecisions) {
+    vector <unique_ptr <DataType>> batch;
+    for (auto k = 0; k < aSizes.size(); k++) {
+        auto n = aSizes[ k ];
+        vector <double> values(n * n);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < n; j++) {
+                values[ i + ( j * n ) ] =
+                    1.0 / ( i + j + 1 + k ) + ( i == j ) * ( n + k );
+            }
+        }
+        batch.push_back(make_unique <DataType>(values, aPrecisions[ k ]));
+        batch.back()->ToMatrix(n, n);
+    }
+    return batch;
+}
+
+
+void
+TEST_BATCH_LINEAR_ALGEBRA() {
+
+    vector <size_t> sizes = {4, 6, 4, 4, 6, 3};
+    vector <Precision> precisions = {DOUBLE, DOUBLE, FLOAT, DOUBLE, FLOAT,
+                                     DOUBLE};
+    auto holder_a = GenerateBatch(sizes, precisions);
+    auto batch_size = sizes.size();
+
+    vector <DataType *> inputs;
+    vector <unique_ptr <DataType>> holder_out;
+    vector <DataType *> outputs;
+    for (auto &a: holder_a) {
+        inputs.push_back(a.get());
+        holder_out.push_back(make_unique <DataType>(DOUBLE));
+        outputs.push_back(holder_out.back().get());
+    }
+
+    SECTION("Batch Cholesky") {
+        cout << "Testing Batch Cholesky ..." << endl;
+
+#ifdef _OPENMP
+        /* BLAS calls of the problems don't open nested parallel regions */
+        auto max_active_levels = omp_get_max_active_levels();
+        {
+            mpcr::kernels::SequentialBlasScope sequential_blas;
+            REQUIRE(omp_get_max_active_levels() == 1);
+        }
+        REQUIRE(omp_get_max_active_levels() == max_active_levels);
+#endif
+
+        batch::BatchCholesky(inputs, outputs, true);
+#ifdef _OPENMP
+        REQUIRE(omp_get_max_active_levels() == max_active_levels);
+#endif
+
+        for (auto k = 0; k < batch_size; k++) {
+            DataType validate(precisions[ k ]);
+            SIMPLE_DISPATCH(precisions[ k ], linear::Cholesky, *inputs[ k ],
+                            validate, true)
+            REQUIRE(outputs[ k ]->GetPrecision() == precisions[ k ]);
+            REQUIRE(outputs[ k ]->GetNRow() == sizes[ k ]);
+            for (auto i = 0; i < validate.GetSize(); i++) {
+                REQUIRE(fabs(outputs[ k ]->GetVal(i) - validate.GetVal(i)) <
+                        1e-6);
+            }
+        }
+
+        /* A failing problem is reported by its index */
+        inputs[ 3 ]->SetValMatrix(0, 0, -10);
+        REQUIRE_THROWS(batch::BatchCholesky(inputs, outputs, false));
+    }
+
+    SECTION("Batch Solve and Trsm") {
+        cout << "Testing Batch Solve ..." << endl;
+
+        vector <unique_ptr <DataType>> holder_b;
+        vector <DataType *> inputs_b;
+        for (auto k = 0; k < batch_size; k++) {
+            vector <double> values(sizes[ k ] * 2);
+            for (auto i = 0; i < values.size(); i++) {
+                values[ i ] = i - k;
+            }
+            holder_b.push_back(make_unique <DataType>(values, DOUBLE));
+            holder_b.back()->ToMatrix(sizes[ k ], 2);
+            inputs_b.push_back(holder_b.back().get());
+        }
+
+        batch::BatchSolve(inputs, inputs_b, outputs);
+
+        for (auto k = 0; k < batch_size; k++) {
+            DataType b(*inputs_b[ k ], precisions[ k ]);
+            DataType validate(precisions[ k ]);
+            SIMPLE_DISPATCH(precisions[ k ], linear::Solve, *inputs[ k ], b,
+                            validate, false)
+            REQUIRE(outputs[ k ]->GetNCol() == 2);
+            for (auto i = 0; i < validate.GetSize(); i++) {
+                REQUIRE(fabs(outputs[ k ]->GetVal(i) - validate.GetVal(i)) <
+                        1e-5);
+            }
+        }
+
+        /* Solve through the Cholesky factors, t(R) R X = B */
+        vector <unique_ptr <DataType>> holder_r;
+        vector <DataType *> factors;
+        vector <unique_ptr <DataType>> holder_y;
+        vector <DataType *> temp;
+        vector <unique_ptr <DataType>> holder_x;
+        vector <DataType *> solution;
+        for (auto k = 0; k < batch_size; k++) {
+            holder_r.push_back(make_unique <DataType>(DOUBLE));
+            factors.push_back(holder_r.back().get());
+            holder_y.push_back(make_unique <DataType>(DOUBLE));
+            temp.push_back(holder_y.back().get());
+            holder_x.push_back(make_unique <DataType>(DOUBLE));
+            solution.push_back(holder_x.back().get());
+        }
+        batch::BatchCholesky(inputs, factors, true);
+        batch::BatchTrsm(factors, inputs_b, temp, true, true, true, 1);
+        batch::BatchTrsm(factors, temp, solution, true, true, false, 1);
+
+        for (auto k = 0; k < batch_size; k++) {
+            for (auto i = 0; i < solution[ k ]->GetSize(); i++) {
+                REQUIRE(fabs(solution[ k ]->GetVal(i) -
+                             outputs[ k ]->GetVal(i)) < 1e-4);
+            }
+        }
+
+        inputs_b.pop_back();
+        REQUIRE_THROWS(batch::BatchSolve(inputs, inputs_b, outputs));
+    }
+
+    SECTION("Batch Gemm and Eigen") {
+        cout << "Testing Batch Gemm ..." << endl;
+
+        batch::BatchGemm(inputs, inputs, outputs, true, false, 2, 0);
+
+        for (auto k = 0; k < batch_size; k++) {
+            DataType validate(precisions[ k ]);
+            SIMPLE_DISPATCH(precisions[ k ], linear::CrossProduct,
+                            *inputs[ k ], *inputs[ k ], validate, true, false,
+                            false, 2)
+            for (auto i = 0; i < validate.GetSize(); i++) {
+                REQUIRE(fabs(outputs[ k ]->GetVal(i) - validate.GetVal(i)) <
+                        1e-4);
+            }
+        }
+
+        /* C = A %*% A + C */
+        batch::BatchGemm(inputs, inputs, outputs, false, false, 1, 1);
+        for (auto k = 0; k < batch_size; k++) {
+            DataType validate(precisions[ k ]);
+            SIMPLE_DISPATCH(precisions[ k ], linear::CrossProduct,
+                            *inputs[ k ], *inputs[ k ], validate, false, false,
+                            false, 3)
+            for (auto i = 0; i < validate.GetSize(); i++) {
+                REQUIRE(fabs(outputs[ k ]->GetVal(i) - validate.GetVal(i)) <
+                        1e-3);
+            }
+        }
+
+        cout << "Testing Batch Eigen ..." << endl;
+
+        vector <unique_ptr <DataType>> holder_vectors;
+        vector <DataType *> vectors;
+        for (auto k = 0; k < batch_size; k++) {
+            holder_vectors.push_back(make_unique <DataType>(DOUBLE));
+            vectors.push_back(holder_vectors.back().get());
+        }
+        batch::BatchEigen(inputs, outputs, &vectors);
+
+        for (auto k = 0; k < batch_size; k++) {
+            DataType validate_values(precisions[ k ]);
+            DataType validate_vectors(precisions[ k ]);
+            SIMPLE_DISPATCH(precisions[ k ], linear::Eigen, *inputs[ k ],
+                            validate_values, &validate_vectors)
+            REQUIRE(outputs[ k ]->GetSize() == sizes[ k ]);
+            for (auto i = 0; i < sizes[ k ]; i++) {
+                REQUIRE(fabs(outputs[ k ]->GetVal(i) -
+                             validate_values.GetVal(i)) < 1e-4);
+            }
+            for (auto i = 0; i < validate_vectors.GetSize(); i++) {
+                REQUIRE(fabs(fabs(vectors[ k ]->GetVal(i)) -
+                             fabs(validate_vectors.GetVal(i))) < 1e-4);
+            }
+        }
+    }
+}
+
+
+TEST_CASE("BatchLinearAlgebra", "[Batch Linear Algebra]") {
+    mpcr::kernels::ContextManager::GetOperationContext()->SetOperationPlacement(
+        CPU);
+    TEST_BATCH_LINEAR_ALGEBRA();
+}
@@ -9,6 +9,7 @@
 #include <libraries/catch/catch.hpp>
 #include <utilities/MPCRDispatcher.hpp>
 #include <operations/LinearAlgebra.hpp>
+#include <operations/SparseLinearAlgebra.hpp>
 #include <operations/MathematicalOperations.hpp>
 
 
@@ -110,6 +111,106 @@ TEST_LINEAR_ALGEBRA() {
             REQUIRE(output.GetVal(i) == validate_vals[ i ]);
         }
 
+        /* A single vector is a column, tcrossprod(x) is its outer product
+         * and crossprod(x) its squared norm */
+        values = {1, -2, 3};
+        DataType x(values, DOUBLE);
+        DataType empty(0, DOUBLE);
+        DataType outer(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, x, empty, outer, false,
+                        true)
+        REQUIRE(!x.IsMatrix());
+        REQUIRE(outer.GetNRow() == 3);
+        REQUIRE(outer.GetNCol() == 3);
+        for (auto j = 0; j < 3; j++) {
+            for (auto i = 0; i < 3; i++) {
+                REQUIRE(outer.GetValMatrix(i, j) == values[ i ] * values[ j ]);
+            }
+        }
+
+        DataType inner(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, x, empty, inner, true,
+                        false)
+        REQUIRE(!x.IsMatrix());
+        REQUIRE(inner.GetSize() == 1);
+        REQUIRE(inner.GetVal(0) == 14);
+
+        /* Vector operands take the gemv / dot / ger paths */
+        values.clear();
+        for (auto i = 0; i < 15; i++) {
+            values.push_back(( i * 7 ) % 11 - 4);
+        }
+        DataType mat(values, DOUBLE);
+        mat.ToMatrix(5, 3);
+        vector <double> values_v = {1, -2, 3};
+        DataType column(values_v, DOUBLE);
+        column.ToMatrix(3, 1);
+        vector <double> values_w = {2, 0, -1, 1, 3};
+        DataType row_vec(values_w, DOUBLE);
+        row_vec.ToMatrix(1, 5);
+
+        /* A x , accumulated : y = 2 A x + 3 y */
+        vector <double> values_y = {1, 1, 1, 1, 1};
+        DataType gemv_out(values_y, DOUBLE);
+        gemv_out.ToMatrix(5, 1);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, mat, column, gemv_out,
+                        false, false, false, 2, 3)
+        for (auto i = 0; i < 5; i++) {
+            double expected = 3;
+            for (auto j = 0; j < 3; j++) {
+                expected += 2 * values[ i + ( j * 5 ) ] * values_v[ j ];
+            }
+            REQUIRE(gemv_out.GetVal(i) == expected);
+        }
+
+        /* w A is a row , and t(A) t(w) the same values as a column */
+        DataType row_out(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, row_vec, mat, row_out,
+                        false, false)
+        DataType column_out(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, mat, row_vec, column_out,
+                        true, true)
+        REQUIRE(row_out.GetNRow() == 1);
+        REQUIRE(row_out.GetNCol() == 3);
+        REQUIRE(column_out.GetNRow() == 3);
+        REQUIRE(column_out.GetNCol() == 1);
+        for (auto j = 0; j < 3; j++) {
+            double expected = 0;
+            for (auto i = 0; i < 5; i++) {
+                expected += values_w[ i ] * values[ i + ( j * 5 ) ];
+            }
+            REQUIRE(row_out.GetVal(j) == expected);
+            REQUIRE(column_out.GetVal(j) == expected);
+        }
+
+        /* w (A x) is a dot product , (A x) w an outer product */
+        DataType dot_out(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, row_vec, gemv_out,
+                        dot_out, false, false)
+        double expected_dot = 0;
+        for (auto i = 0; i < 5; i++) {
+            expected_dot += values_w[ i ] * gemv_out.GetVal(i);
+        }
+        REQUIRE(dot_out.GetSize() == 1);
+        REQUIRE(dot_out.GetVal(0) == expected_dot);
+
+        values_y.assign(25, 100);
+        DataType outer_out(values_y, DOUBLE);
+        outer_out.ToMatrix(5, 5);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, gemv_out, row_vec,
+                        outer_out, false, false)
+        for (auto j = 0; j < 5; j++) {
+            for (auto i = 0; i < 5; i++) {
+                REQUIRE(outer_out.GetValMatrix(i, j) ==
+                        gemv_out.GetVal(i) * values_w[ j ]);
+            }
+        }
+
+        DataType wrong_out(DOUBLE);
+        REQUIRE_THROWS(linear::CrossProduct <double>(mat, row_vec, wrong_out,
+                                                     false, false));
+        REQUIRE(mat.GetNRow() == 5);
+
 
     }SECTION("Test Symmetric") {
         cout << "Testing Matrix Is Symmetric ..." << endl;
@@ -132,6 +233,58 @@ TEST_LINEAR_ALGEBRA() {
         SIMPLE_DISPATCH(FLOAT, linear::IsSymmetric, a, isSymmetric)
         REQUIRE(isSymmetric == false);
 
+        /* Several tiles, the last one partial */
+        auto side_len = 200;
+        values.resize(side_len * side_len);
+        for (auto i = 0; i < side_len; i++) {
+            for (auto j = 0; j < side_len; j++) {
+                values[ i + ( j * side_len ) ] = 1.0 / ( i + j + 1 );
+            }
+        }
+        DataType b(values, DOUBLE);
+        b.ToMatrix(side_len, side_len);
+
+        SIMPLE_DISPATCH(DOUBLE, linear::IsSymmetric, b, isSymmetric)
+        REQUIRE(isSymmetric == true);
+        REQUIRE(b.HasProperty(MATRIX_NEARLY_SYMMETRIC));
+        REQUIRE(!b.HasProperty(MATRIX_SYMMETRIC));
+
+        /* Modifying the data drops the cached answer */
+        b.SetValMatrix(190, 5, b.GetValMatrix(190, 5) + 1e-6);
+        REQUIRE(!b.HasProperty(MATRIX_NEARLY_SYMMETRIC));
+
+        SIMPLE_DISPATCH(DOUBLE, linear::IsSymmetric, b, isSymmetric)
+        REQUIRE(isSymmetric == false);
+        REQUIRE(b.HasProperty(MATRIX_NOT_SYMMETRIC));
+
+        linear::IsSymmetric <double>(b, isSymmetric, 0);
+        REQUIRE(isSymmetric == false);
+        linear::IsSymmetric <double>(b, isSymmetric, 1e-7);
+        REQUIRE(isSymmetric == false);
+        linear::IsSymmetric <double>(b, isSymmetric, 1e-5);
+        REQUIRE(isSymmetric == true);
+        REQUIRE(!b.HasProperty(MATRIX_SYMMETRIC));
+
+        /* A mismatch on the diagonal tiles */
+        b.SetValMatrix(190, 5, values[ 190 + ( 5 * side_len ) ]);
+        b.SetValMatrix(3, 1, 0);
+        SIMPLE_DISPATCH(DOUBLE, linear::IsSymmetric, b, isSymmetric)
+        REQUIRE(isSymmetric == false);
+
+        b.SetValMatrix(3, 1, values[ 3 + side_len ]);
+        b.LazyTranspose();
+        SIMPLE_DISPATCH(DOUBLE, linear::IsSymmetric, b, isSymmetric)
+        REQUIRE(isSymmetric == true);
+        REQUIRE(!b.HasProperty(MATRIX_SYMMETRIC));
+
+        /* Only the exact check marks the matrix symmetric */
+        linear::IsSymmetric <double>(b, isSymmetric, 1e-3);
+        REQUIRE(isSymmetric == true);
+        REQUIRE(!b.HasProperty(MATRIX_SYMMETRIC));
+        linear::IsSymmetric <double>(b, isSymmetric, 0);
+        REQUIRE(isSymmetric == true);
+        REQUIRE(b.HasProperty(MATRIX_SYMMETRIC));
+
     }SECTION("Testing Transpose") {
         cout << "Testing Matrix Transpose ..." << endl;
         vector <double> values = {1, 5, 9, 2, 6, 10, 3, 7, 11, 4, 8, 12};
@@ -146,6 +299,273 @@ TEST_LINEAR_ALGEBRA() {
             REQUIRE(a.GetVal(i) == i + 1);
         }
 
+    }SECTION("Testing Blocked Transpose") {
+        cout << "Testing Blocked Matrix Transpose ..." << endl;
+        vector <size_t> rows = {37, 37, 16, 1};
+        vector <size_t> cols = {37, 21, 45, 19};
+
+        for (auto k = 0; k < rows.size(); k++) {
+            auto row = rows[ k ];
+            auto col = cols[ k ];
+            vector <double> values(row * col);
+            for (auto i = 0; i < values.size(); i++) {
+                values[ i ] = i;
+            }
+
+            DataType a(values, DOUBLE);
+            a.ToMatrix(row, col);
+            DataType b(FLOAT);
+
+            a.Transpose(b);
+            REQUIRE(b.GetPrecision() == DOUBLE);
+            REQUIRE(b.GetNRow() == col);
+            REQUIRE(b.GetNCol() == row);
+            REQUIRE(a.GetNRow() == row);
+
+            a.Transpose();
+            REQUIRE(a.GetNRow() == col);
+            REQUIRE(a.GetNCol() == row);
+
+            for (auto j = 0; j < col; j++) {
+                for (auto i = 0; i < row; i++) {
+                    REQUIRE(a.GetValMatrix(j, i) == values[ j * row + i ]);
+                    REQUIRE(b.GetValMatrix(j, i) == values[ j * row + i ]);
+                }
+            }
+        }
+
+    }SECTION("Testing Lazy Transpose") {
+        cout << "Testing Lazy Transpose ..." << endl;
+        vector <double> values(12);
+        for (auto i = 0; i < values.size(); i++) {
+            values[ i ] = i * 0.5 - 2;
+        }
+
+        DataType a(values, DOUBLE);
+        a.ToMatrix(3, 4);
+        DataType a_t(a);
+        a_t.LazyTranspose();
+        DataType a_phys(a);
+        a_phys.Transpose();
+
+        REQUIRE(a_t.IsTransposed());
+        REQUIRE(a_t.GetNRow() == 4);
+        REQUIRE(a_t.GetNCol() == 3);
+
+        DataType out_lazy(DOUBLE);
+        DataType out_phys(DOUBLE);
+        DataType empty(DOUBLE);
+
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a_t, a, out_lazy, false,
+                        false)
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a_phys, a, out_phys,
+                        false, false)
+        REQUIRE(out_lazy.GetNRow() == 4);
+        REQUIRE(out_lazy.GetNCol() == 4);
+        for (auto i = 0; i < out_phys.GetSize(); i++) {
+            REQUIRE(out_lazy.GetVal(i) == out_phys.GetVal(i));
+        }
+
+        out_lazy.ClearUp();
+        out_phys.ClearUp();
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a_t, empty, out_lazy,
+                        true, false)
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a_phys, empty, out_phys,
+                        true, false)
+        REQUIRE(out_lazy.GetNRow() == 3);
+        for (auto i = 0; i < out_phys.GetSize(); i++) {
+            REQUIRE(out_lazy.GetVal(i) == out_phys.GetVal(i));
+        }
+
+        double norm_lazy = 0;
+        double norm_phys = 0;
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, a_t, "O", norm_lazy)
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, a_phys, "O", norm_phys)
+        REQUIRE(norm_lazy == norm_phys);
+        REQUIRE(a_t.IsTransposed());
+
+        values = {2, 0, 0, 1, 1, 0, 3, 1, 2};
+        DataType tri(values, DOUBLE);
+        tri.ToMatrix(3, 3);
+        DataType tri_t(tri);
+        tri_t.LazyTranspose();
+        vector <double> rhs = {8, 4, 2};
+        DataType b(rhs, DOUBLE);
+        b.ToMatrix(3, 1);
+
+        SIMPLE_DISPATCH(DOUBLE, linear::BackSolve, tri_t, b, out_lazy, 3,
+                        false, false)
+        tri.Transpose();
+        SIMPLE_DISPATCH(DOUBLE, linear::BackSolve, tri, b, out_phys, 3, false,
+                        false)
+        for (auto i = 0; i < out_phys.GetSize(); i++) {
+            REQUIRE(out_lazy.GetVal(i) == out_phys.GetVal(i));
+        }
+
+        for (auto i = 0; i < a_t.GetSize(); i++) {
+            REQUIRE(a_t.GetVal(i) == a_phys.GetVal(i));
+        }
+        REQUIRE(a_t.IsTransposed() == false);
+
+    }SECTION("Testing Determinant") {
+        cout << "Testing Determinant ..." << endl;
+
+        /** det = -2 , needs one row interchange **/
+        vector <double> values = {1, 3, 2, 4};
+        DataType a(values, DOUBLE);
+        a.ToMatrix(2, 2);
+
+        double modulus = 0;
+        int sign = 0;
+        SIMPLE_DISPATCH(DOUBLE, linear::Determinant, a, modulus, sign, true)
+        REQUIRE(sign == -1);
+        REQUIRE(modulus == Approx(std::log(2.0)));
+
+        SIMPLE_DISPATCH(DOUBLE, linear::Determinant, a, modulus, sign, false)
+        REQUIRE(sign == -1);
+        REQUIRE(modulus == Approx(2.0));
+
+        /** Lazily transposed input must give the same result **/
+        a.LazyTranspose();
+        SIMPLE_DISPATCH(DOUBLE, linear::Determinant, a, modulus, sign, false)
+        REQUIRE(sign == -1);
+        REQUIRE(modulus == Approx(2.0));
+
+        /** Singular matrix **/
+        values = {1, 2, 2, 4};
+        DataType b(values, FLOAT);
+        b.ToMatrix(2, 2);
+        SIMPLE_DISPATCH(FLOAT, linear::Determinant, b, modulus, sign, true)
+        REQUIRE(sign == 1);
+        REQUIRE(std::isinf(modulus));
+        REQUIRE(modulus < 0);
+
+        /** 400 x 400 diagonal of 10s : det = 1e400 overflows a double **/
+        auto side_len = 400;
+        DataType c(side_len, side_len, DOUBLE);
+        for (auto i = 0; i < side_len; i++) {
+            c.SetValMatrix(i, i, ( i == 0 ) ? -10 : 10);
+        }
+        SIMPLE_DISPATCH(DOUBLE, linear::Determinant, c, modulus, sign, true)
+        REQUIRE(sign == -1);
+        REQUIRE(modulus == Approx(side_len * std::log(10.0)));
+
+        values = {1, 2, 3};
+        DataType d(values, DOUBLE);
+        REQUIRE_THROWS(linear::Determinant <double>(d, modulus, sign, true));
+
+    }SECTION("Testing Packed Storage") {
+        cout << "Testing Packed Storage ..." << endl;
+
+        vector <double> values = {4, 12, -16, 12, 37, -43, -16, -43, 98};
+        DataType a(values, DOUBLE);
+        a.ToMatrix(3, 3);
+
+        /** Pack and unpack both triangles **/
+        for (auto upper: {true, false}) {
+            DataType temp(a);
+            temp.ToPacked(upper);
+            REQUIRE(temp.IsPacked() == true);
+            REQUIRE(temp.GetSize() == 9);
+            REQUIRE(temp.GetNRow() == 3);
+
+            auto pPacked = (double *) temp.GetPackedData();
+            vector <double> validate = upper ? vector <double>{4, 12, 37, -16,
+                                                               -43, 98}
+                                             : vector <double>{4, 12, -16, 37,
+                                                               -43, 98};
+            for (auto i = 0; i < validate.size(); i++) {
+                REQUIRE(pPacked[ i ] == validate[ i ]);
+            }
+
+            bool is_symmetric = false;
+            SIMPLE_DISPATCH(DOUBLE, linear::IsSymmetric, temp, is_symmetric)
+            REQUIRE(is_symmetric == true);
+
+            temp.Unpack();
+            REQUIRE(temp.IsPacked() == false);
+            for (auto i = 0; i < values.size(); i++) {
+                REQUIRE(temp.GetVal(i) == values[ i ]);
+            }
+        }
+
+        /** Packed Cholesky factor and inverse **/
+        DataType a_packed(a);
+        a_packed.ToPacked(false);
+        DataType chol_full(DOUBLE);
+        DataType chol_packed(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, chol_full, true)
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a_packed, chol_packed, true)
+
+        REQUIRE(chol_packed.IsPacked() == true);
+        REQUIRE(chol_packed.IsPackedUpper() == true);
+        REQUIRE(chol_packed.IsPackedTriangular() == true);
+
+        vector <double> rhs = {1, 2, 3};
+        DataType b(rhs, DOUBLE);
+        b.ToMatrix(3, 1);
+        DataType solve_full(DOUBLE);
+        DataType solve_packed(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::BackSolve, chol_full, b, solve_full, 3,
+                        true, true)
+        SIMPLE_DISPATCH(DOUBLE, linear::BackSolve, chol_packed, b,
+                        solve_packed, 3, true, true)
+        REQUIRE(chol_packed.IsPacked() == true);
+        for (auto i = 0; i < solve_full.GetSize(); i++) {
+            REQUIRE(solve_packed.GetVal(i) == Approx(solve_full.GetVal(i)));
+        }
+
+        DataType inv_full(DOUBLE);
+        DataType inv_packed(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CholeskyInv, chol_full, inv_full, 3)
+        SIMPLE_DISPATCH(DOUBLE, linear::CholeskyInv, chol_packed, inv_packed, 3)
+        REQUIRE(inv_packed.IsPacked() == true);
+        REQUIRE(inv_packed.IsPackedTriangular() == false);
+
+        /* The reduced internal precision applies to packed factors too */
+        DataType inv_packed_single(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CholeskyInv, chol_packed,
+                        inv_packed_single, 3, "Single")
+        REQUIRE(inv_packed_single.GetPrecision() == FLOAT);
+        REQUIRE(inv_packed_single.IsPacked() == true);
+        REQUIRE(chol_packed.IsPacked() == true);
+        for (auto i = 0; i < inv_full.GetSize(); i++) {
+            REQUIRE(fabs(inv_packed_single.GetVal(i) - inv_full.GetVal(i)) <=
+                    1e-5 * fabs(inv_full.GetVal(i)) + 1e-6);
+        }
+
+        for (auto i = 0; i < chol_full.GetSize(); i++) {
+            REQUIRE(chol_packed.GetVal(i) == Approx(chol_full.GetVal(i)));
+            REQUIRE(inv_packed.GetVal(i) == Approx(inv_full.GetVal(i)));
+        }
+
+        /** Packed crossprod and tcrossprod **/
+        vector <double> values_x(15);
+        for (auto i = 0; i < values_x.size(); i++) {
+            values_x[ i ] = ( i % 4 ) - 1.5 * i;
+        }
+        DataType x(values_x, DOUBLE);
+        x.ToMatrix(5, 3);
+        DataType dump(0, DOUBLE);
+
+        for (auto transpose: {true, false}) {
+            for (auto upper: {true, false}) {
+                DataType cross_full(DOUBLE);
+                DataType cross_packed(DOUBLE);
+                SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, x, dump,
+                                cross_full, transpose, !transpose)
+                SIMPLE_DISPATCH(DOUBLE, linear::PackedCrossProduct, x,
+                                cross_packed, transpose, upper)
+
+                REQUIRE(cross_packed.IsPacked() == true);
+                REQUIRE(cross_packed.GetNRow() == cross_full.GetNRow());
+                for (auto i = 0; i < cross_full.GetSize(); i++) {
+                    REQUIRE(cross_packed.GetVal(i) ==
+                            Approx(cross_full.GetVal(i)));
+                }
+            }
+        }
+
     }SECTION("Testing Cholesky Decomposition") {
         cout << "Testing Cholesky Decomposition ..." << endl;
         vector <double> values = {4, 12, -16, 12, 37, -43, -16, -43, 98};
@@ -252,6 +672,377 @@ TEST_LINEAR_ALGEBRA() {
             REQUIRE(val <= error);
         }
 
+    }SECTION("Testing Mixed Precision Solve") {
+        cout << "Testing Mixed Precision Solve ..." << endl;
+        auto n = 30;
+        auto nrhs = 3;
+        vector <double> values(n * n);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < n; j++) {
+                values[ i + ( j * n ) ] =
+                    ( i == j ) ? n : sin(i + 2 * j) + 1.0 / ( 1 + i + j );
+            }
+        }
+        DataType a(values, DOUBLE);
+        a.ToMatrix(n, n);
+
+        vector <double> values_b(n * nrhs);
+        for (auto i = 0; i < values_b.size(); i++) {
+            values_b[ i ] = cos(i) * 100;
+        }
+        DataType b(values_b, DOUBLE);
+        b.ToMatrix(n, nrhs);
+
+        DataType output(DOUBLE);
+        DataType output_refined(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, b, output, false, "same")
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, b, output_refined, false,
+                        "Float")
+
+        REQUIRE(output_refined.GetNRow() == n);
+        REQUIRE(output_refined.GetNCol() == nrhs);
+        for (auto i = 0; i < n * nrhs; i++) {
+            REQUIRE(fabs(output_refined.GetVal(i) - output.GetVal(i)) <=
+                    1e-12 * fabs(output.GetVal(i)) + 1e-13);
+        }
+
+        /* Hilbert matrix is too ill-conditioned for a single precision
+         * factorization, refinement stalls and falls back to double */
+        auto n_hilbert = 12;
+        vector <double> values_hilbert(n_hilbert * n_hilbert);
+        for (auto i = 0; i < n_hilbert; i++) {
+            for (auto j = 0; j < n_hilbert; j++) {
+                values_hilbert[ i + ( j * n_hilbert ) ] = 1.0 / ( i + j + 1 );
+            }
+        }
+        DataType hilbert(values_hilbert, DOUBLE);
+        hilbert.ToMatrix(n_hilbert, n_hilbert);
+        vector <double> values_c(n_hilbert, 1);
+        DataType c(values_c, DOUBLE);
+        c.ToMatrix(n_hilbert, 1);
+
+        DataType output_hilbert(DOUBLE);
+        DataType output_hilbert_refined(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, hilbert, c, output_hilbert,
+                        false, "same")
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, hilbert, c,
+                        output_hilbert_refined, false, "single")
+
+        for (auto i = 0; i < n_hilbert; i++) {
+            REQUIRE(output_hilbert_refined.GetVal(i) ==
+                    output_hilbert.GetVal(i));
+        }
+
+    }SECTION("Testing Cholesky Solve") {
+        cout << "Testing Cholesky Solve ..." << endl;
+        auto n = 20;
+        auto nrhs = 2;
+        vector <double> values(n * n);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < n; j++) {
+                values[ i + ( j * n ) ] = exp(-0.5 * fabs(i - j));
+            }
+        }
+        DataType a(values, DOUBLE);
+        a.ToMatrix(n, n);
+
+        vector <double> values_b(n * nrhs);
+        for (auto i = 0; i < values_b.size(); i++) {
+            values_b[ i ] = sin(i) + 1;
+        }
+        DataType b(values_b, DOUBLE);
+        b.ToMatrix(n, nrhs);
+
+        DataType validate(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, b, validate, false)
+
+        for (auto internal_precision: {"same", "single"}) {
+            DataType output(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::CholeskySolve, a, b, output, false,
+                            internal_precision)
+
+            REQUIRE(output.GetNRow() == n);
+            REQUIRE(output.GetNCol() == nrhs);
+            for (auto i = 0; i < n * nrhs; i++) {
+                REQUIRE(fabs(output.GetVal(i) - validate.GetVal(i)) <=
+                        1e-12 * fabs(validate.GetVal(i)) + 1e-12);
+            }
+        }
+
+        /* Inverse of A */
+        DataType validate_inv(DOUBLE);
+        DataType dump(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, dump, validate_inv, true)
+
+        DataType output_inv(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CholeskySolve, a, dump, output_inv,
+                        true, "float")
+        REQUIRE(output_inv.GetNRow() == n);
+        REQUIRE(output_inv.GetNCol() == n);
+        for (auto i = 0; i < n * n; i++) {
+            REQUIRE(fabs(output_inv.GetVal(i) - validate_inv.GetVal(i)) <=
+                    1e-12 * fabs(validate_inv.GetVal(i)) + 1e-12);
+        }
+
+        /* Single precision inverse from the Cholesky factor */
+        DataType chol(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, chol, true)
+        DataType output_chol_inv(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CholeskyInv, chol, output_chol_inv, n,
+                        "single")
+        /* The unrefined inverse is labelled with its accuracy */
+        REQUIRE(output_chol_inv.GetPrecision() == FLOAT);
+        REQUIRE(output_chol_inv.HasProperty(MATRIX_SPD));
+        for (auto i = 0; i < n * n; i++) {
+            REQUIRE(fabs(output_chol_inv.GetVal(i) - validate_inv.GetVal(i)) <=
+                    1e-4 * fabs(validate_inv.GetVal(i)) + 1e-5);
+        }
+
+        /* Not positive definite */
+        values[ 0 ] = -1;
+        DataType a_wrong(values, DOUBLE);
+        a_wrong.ToMatrix(n, n);
+        DataType output_wrong(DOUBLE);
+        REQUIRE_THROWS(linear::CholeskySolve <double>(a_wrong, b, output_wrong,
+                                                      false, "single"));
+        REQUIRE_THROWS(linear::CholeskyInv <double>(chol, output_wrong, n,
+                                                    "quad"));
+
+    }SECTION("Testing Structured Solve") {
+        cout << "Testing Structured Solve ..." << endl;
+        auto n = 6;
+        vector <double> values(n * n);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < n; j++) {
+                values[ i + ( j * n ) ] =
+                    ( i == j ) ? n : cos(i + 3 * j) + 1.0 / ( 1 + i + j );
+            }
+        }
+        DataType general(values, DOUBLE);
+        general.ToMatrix(n, n);
+
+        vector <double> values_b(n * 2);
+        for (auto i = 0; i < values_b.size(); i++) {
+            values_b[ i ] = sin(i) + 2;
+        }
+        DataType b(values_b, DOUBLE);
+        b.ToMatrix(n, 2);
+
+        /* Structure known from the producing operation */
+        DataType spd(DOUBLE);
+        DataType dump(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, general, dump, spd,
+                        false, false)
+        REQUIRE(spd.HasProperty(MATRIX_SYMMETRIC));
+        REQUIRE_FALSE(spd.HasProperty(MATRIX_SPD));
+
+        DataType chol(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, spd, chol, true)
+        REQUIRE(chol.HasProperty(MATRIX_UPPER_TRIANGULAR));
+        REQUIRE_FALSE(chol.HasProperty(MATRIX_LOWER_TRIANGULAR));
+        REQUIRE(spd.HasProperty(MATRIX_SPD));
+
+        chol.LazyTranspose();
+        REQUIRE(chol.HasProperty(MATRIX_LOWER_TRIANGULAR));
+        REQUIRE_FALSE(chol.HasProperty(MATRIX_UPPER_TRIANGULAR));
+        chol.LazyTranspose();
+
+        /* Residual of A X = B, or A X = I for the inverse */
+        auto validate = [ & ](DataType &aInput, const bool &aSingle) {
+            DataType output(DOUBLE);
+            DataType product(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::Solve, aInput, b, output, aSingle)
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, aInput, output,
+                            product, false, false)
+
+            REQUIRE(output.GetNRow() == n);
+            REQUIRE(output.GetNCol() == ( aSingle ? n : 2 ));
+            for (auto j = 0; j < output.GetNCol(); j++) {
+                for (auto i = 0; i < n; i++) {
+                    auto expected = aSingle ? ( i == j ) : b.GetValMatrix(i, j);
+                    REQUIRE(fabs(product.GetValMatrix(i, j) - expected) <
+                            1e-10);
+                }
+            }
+        };
+
+        validate(chol, false);
+        validate(chol, true);
+        validate(spd, false);
+        validate(spd, true);
+
+        /* Lower triangular matrix found by probing */
+        DataType lower(values, DOUBLE);
+        lower.ToMatrix(n, n);
+        lower.FillTriangle(0, true);
+        validate(lower, false);
+        REQUIRE(lower.HasProperty(MATRIX_PROBED));
+        REQUIRE(lower.HasProperty(MATRIX_LOWER_TRIANGULAR));
+
+        /* Symmetric indefinite matrix falls back to LU */
+        DataType indefinite(spd);
+        indefinite.SetValMatrix(0, 0, -100);
+        REQUIRE_FALSE(indefinite.HasProperty(MATRIX_SYMMETRIC));
+        validate(indefinite, false);
+        REQUIRE(indefinite.HasProperty(MATRIX_SYMMETRIC));
+        REQUIRE_FALSE(indefinite.HasProperty(MATRIX_SPD));
+
+        validate(general, false);
+        REQUIRE(general.HasProperty(MATRIX_PROBED));
+        REQUIRE_FALSE(general.HasProperty(MATRIX_SYMMETRIC));
+        REQUIRE_FALSE(general.HasProperty(MATRIX_UPPER_TRIANGULAR));
+
+        /* Symmetric only up to the default tolerance, the solve still
+         * uses the whole matrix */
+        vector <double> values_tiny = {2e-17, 0, 1e-17, 3e-17};
+        DataType tiny(values_tiny, DOUBLE);
+        tiny.ToMatrix(2, 2);
+        auto is_symmetric = false;
+        SIMPLE_DISPATCH(DOUBLE, linear::IsSymmetric, tiny, is_symmetric)
+        REQUIRE(is_symmetric);
+        REQUIRE_FALSE(tiny.HasProperty(MATRIX_SYMMETRIC));
+
+        vector <double> values_tiny_b = {1, 1};
+        DataType tiny_b(values_tiny_b, DOUBLE);
+        tiny_b.ToMatrix(2, 1);
+        DataType tiny_x(DOUBLE);
+        DataType tiny_product(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Solve, tiny, tiny_b, tiny_x, false)
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, tiny, tiny_x,
+                        tiny_product, false, false)
+        for (auto i = 0; i < 2; i++) {
+            REQUIRE(fabs(tiny_product.GetVal(i) - 1) < 1e-10);
+        }
+        REQUIRE(tiny.HasProperty(MATRIX_UPPER_TRIANGULAR));
+
+        /* Singular triangular matrices are still reported */
+        lower.SetValMatrix(2, 2, 0);
+        DataType output_singular(DOUBLE);
+        REQUIRE_THROWS(
+            linear::Solve <double>(lower, b, output_singular, false));
+
+    }SECTION("Testing Overwrite Decompositions") {
+        cout << "Testing Overwrite Decompositions ..." << endl;
+        auto n = 8;
+        vector <double> values(n * n);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < n; j++) {
+                values[ i + ( j * n ) ] = exp(-0.3 * fabs(i - j));
+            }
+        }
+        vector <double> values_b(n);
+        for (auto i = 0; i < n; i++) {
+            values_b[ i ] = i + 1;
+        }
+        DataType b(values_b, DOUBLE);
+        b.ToMatrix(n, 1);
+
+        /* Packed and in place solves may pick another LAPACK routine */
+        auto require_equal = [](DataType &aOutput, DataType &aValidate) {
+            REQUIRE(aOutput.GetNRow() == aValidate.GetNRow());
+            REQUIRE(aOutput.GetNCol() == aValidate.GetNCol());
+            for (auto i = 0; i < aValidate.GetSize(); i++) {
+                REQUIRE(fabs(aOutput.GetVal(i) - aValidate.GetVal(i)) <=
+                        1e-12 * fabs(aValidate.GetVal(i)) + 1e-12);
+            }
+        };
+
+        /* The factor takes over the buffer of the input */
+        DataType a(values, DOUBLE);
+        a.ToMatrix(n, n);
+        DataType validate(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, validate, true)
+        auto pBuffer = a.GetData(CPU);
+        DataType output(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, output, true, true)
+        REQUIRE(a.GetSize() == 0);
+        REQUIRE_FALSE(a.IsMatrix());
+        REQUIRE(output.GetData(CPU) == pBuffer);
+        require_equal(output, validate);
+        REQUIRE(output.HasProperty(MATRIX_UPPER_TRIANGULAR));
+
+        /* A failed factorization still consumes the input */
+        DataType a_wrong(values, DOUBLE);
+        a_wrong.ToMatrix(n, n);
+        a_wrong.SetValMatrix(0, 0, -1);
+        REQUIRE_THROWS(linear::Cholesky <double>(a_wrong, output, true, true));
+        REQUIRE(a_wrong.GetSize() == 0);
+
+        a = DataType(values, DOUBLE);
+        a.ToMatrix(n, n);
+        a.ToPacked(true);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, output, true, true)
+        REQUIRE(a.GetSize() == 0);
+        REQUIRE(output.IsPacked());
+        require_equal(output, validate);
+
+        for (auto single: {false, true}) {
+            for (auto symmetric: {false, true}) {
+                a = DataType(values, DOUBLE);
+                a.ToMatrix(n, n);
+                if (!symmetric) {
+                    a.SetValMatrix(0, n - 1, 0.5);
+                }
+                DataType copy(a);
+                SIMPLE_DISPATCH(DOUBLE, linear::Solve, copy, b, validate,
+                                single)
+                SIMPLE_DISPATCH(DOUBLE, linear::Solve, a, b, output, single,
+                                "same", true)
+                REQUIRE(a.GetSize() == 0);
+                require_equal(output, validate);
+            }
+        }
+
+        a = DataType(values, DOUBLE);
+        a.ToMatrix(n, n);
+        DataType validate_values(DOUBLE);
+        DataType validate_vectors(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Eigen, a, validate_values,
+                        &validate_vectors)
+        DataType output_values(DOUBLE);
+        DataType output_vectors(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Eigen, a, output_values,
+                        &output_vectors, true)
+        REQUIRE(a.GetSize() == 0);
+        require_equal(output_values, validate_values);
+        require_equal(output_vectors, validate_vectors);
+
+        a = DataType(values, DOUBLE);
+        a.ToMatrix(n, n);
+        DataType validate_s(DOUBLE);
+        DataType validate_u(DOUBLE);
+        DataType validate_v(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::SVD, a, validate_s, validate_u,
+                        validate_v, n, n)
+        DataType output_s(DOUBLE);
+        DataType output_u(DOUBLE);
+        DataType output_v(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::SVD, a, output_s, output_u, output_v,
+                        n, n, true, true)
+        REQUIRE(a.GetSize() == 0);
+        require_equal(output_s, validate_s);
+        require_equal(output_u, validate_u);
+        require_equal(output_v, validate_v);
+
+        /* The compact QR is returned in the buffer of a lazy transposed
+         * input once materialized */
+        a = DataType(values, DOUBLE);
+        a.ToMatrix(n / 2, n * 2);
+        DataType copy(a);
+        copy.Transpose();
+        a.LazyTranspose();
+        DataType qraux(DOUBLE);
+        DataType pivot(DOUBLE);
+        DataType rank(DOUBLE);
+        DataType validate_qraux(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::QRDecomposition, copy, validate,
+                        validate_qraux, pivot, rank)
+        SIMPLE_DISPATCH(DOUBLE, linear::QRDecomposition, a, output, qraux,
+                        pivot, rank, true)
+        REQUIRE(a.GetSize() == 0);
+        require_equal(output, validate);
+        require_equal(qraux, validate_qraux);
+
     }SECTION("Testing Back solve") {
         cout << "Testing Back Solve ..." << endl;
         vector <double> values = {1, 0, 0, 2, 1, 0, 3, 1, 2};
@@ -326,6 +1117,108 @@ TEST_LINEAR_ALGEBRA() {
             REQUIRE(c.GetVal(i) == validate[ i ]);
         }
 
+    }SECTION("Triangular and Symmetric Multiply") {
+        cout << "Testing Trmm and Symm ..." << endl;
+
+        /* Both triangles are filled, only the referenced one must be read */
+        vector <double> values(16);
+        for (auto i = 0; i < 16; i++) {
+            values[ i ] = ( i * 5 ) % 7 - 3;
+        }
+        DataType a(values, DOUBLE);
+        a.ToMatrix(4, 4);
+        vector <double> values_b = {1, 2, -1, 0, 3, -2, 1, 1};
+        DataType b(values_b, DOUBLE);
+        b.ToMatrix(4, 2);
+
+        /* Reference op(T) B , T being the referenced triangle of A */
+        auto triangle = [ & ](size_t i, size_t j, bool upper) {
+            return ( upper ? i <= j : i >= j ) ? values[ i + ( j * 4 ) ] : 0;
+        };
+        auto symmetric = [ & ](size_t i, size_t j, bool upper) {
+            return ( upper == ( i <= j )) ? values[ i + ( j * 4 ) ]
+                                          : values[ j + ( i * 4 ) ];
+        };
+
+        for (auto upper: {true, false}) {
+            for (auto transpose: {false, true}) {
+                DataType output(DOUBLE);
+                SIMPLE_DISPATCH(DOUBLE, linear::TriangularMultiply, a, b,
+                                output, upper, transpose, 'L', 2)
+                REQUIRE(output.GetNRow() == 4);
+                REQUIRE(output.GetNCol() == 2);
+                for (auto j = 0; j < 2; j++) {
+                    for (auto i = 0; i < 4; i++) {
+                        double expected = 0;
+                        for (auto k = 0; k < 4; k++) {
+                            auto val = transpose ? triangle(k, i, upper)
+                                                 : triangle(i, k, upper);
+                            expected += 2 * val * values_b[ k + ( j * 4 ) ];
+                        }
+                        REQUIRE(output.GetValMatrix(i, j) == expected);
+                    }
+                }
+            }
+
+            DataType output(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::SymmetricMultiply, a, b, output,
+                            upper)
+            for (auto j = 0; j < 2; j++) {
+                for (auto i = 0; i < 4; i++) {
+                    double expected = 0;
+                    for (auto k = 0; k < 4; k++) {
+                        expected += symmetric(i, k, upper) *
+                                    values_b[ k + ( j * 4 ) ];
+                    }
+                    REQUIRE(output.GetValMatrix(i, j) == expected);
+                }
+            }
+        }
+
+        /* A vector is a row on the right side , x t(U) = t(U x) */
+        vector <double> values_x = {1, -1, 2, 3};
+        DataType x(values_x, DOUBLE);
+        DataType right(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::TriangularMultiply, a, x, right, true,
+                        true, 'R')
+        REQUIRE(!x.IsMatrix());
+        REQUIRE(right.GetNRow() == 1);
+        REQUIRE(right.GetNCol() == 4);
+        DataType left(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::TriangularMultiply, a, x, left, true,
+                        false, 'L')
+        REQUIRE(left.GetNCol() == 1);
+        for (auto i = 0; i < 4; i++) {
+            REQUIRE(right.GetVal(i) == left.GetVal(i));
+        }
+
+        /* A lazily transposed upper triangle is a lower one */
+        DataType a_t(a, DOUBLE);
+        a_t.LazyTranspose();
+        REQUIRE(a_t.IsTransposed());
+        DataType lazy(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::TriangularMultiply, a_t, x, lazy,
+                        false, false, 'L')
+        DataType lazy_sym(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::SymmetricMultiply, a_t, x, lazy_sym,
+                        false, 'R')
+        DataType validate_sym(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::SymmetricMultiply, a, x, validate_sym,
+                        true, 'L')
+        for (auto i = 0; i < 4; i++) {
+            double expected = 0;
+            for (auto k = 0; k < 4; k++) {
+                expected += triangle(k, i, true) * values_x[ k ];
+            }
+            REQUIRE(lazy.GetVal(i) == expected);
+            REQUIRE(lazy_sym.GetVal(i) == validate_sym.GetVal(i));
+        }
+
+        DataType wrong(DOUBLE);
+        REQUIRE_THROWS(linear::TriangularMultiply <double>(a, b, wrong, true,
+                                                           false, 'R'));
+        REQUIRE_THROWS(linear::SymmetricMultiply <double>(b, b, wrong));
+
     }SECTION("SVD") {
         cout << "Testing Singular Value Decomposition ..." << endl;
 
@@ -390,6 +1283,145 @@ TEST_LINEAR_ALGEBRA() {
             REQUIRE(temp_two.GetVal(i) == a.GetVal(i));
         }
 
+        /* Fewer vectors than min(m, n) are the leading ones, and all of the
+         * left vectors can be asked with only some of the right ones */
+        for (auto nu: {2, 9}) {
+            DataType d_some(FLOAT);
+            DataType u_some(FLOAT);
+            DataType v_some(FLOAT);
+            SIMPLE_DISPATCH(FLOAT, linear::SVD, a, d_some, u_some, v_some, nu,
+                            2)
+            REQUIRE(d_some.GetSize() == 4);
+            REQUIRE(u_some.GetNRow() == 9);
+            REQUIRE(u_some.GetNCol() == nu);
+            REQUIRE(v_some.GetNRow() == 4);
+            REQUIRE(v_some.GetNCol() == 2);
+            for (auto j = 0; j < 2; j++) {
+                for (auto i = 0; i < 9; i++) {
+                    REQUIRE(fabs(fabs(u_some.GetValMatrix(i, j)) -
+                                 fabs(u.GetValMatrix(i, j))) < 1e-5);
+                }
+                for (auto i = 0; i < 4; i++) {
+                    REQUIRE(fabs(fabs(v_some.GetValMatrix(i, j)) -
+                                 fabs(v.GetValMatrix(i, j))) < 1e-5);
+                }
+            }
+        }
+
+
+    }SECTION("Randomized SVD") {
+        cout << "Testing Randomized SVD ..." << endl;
+
+        /* Rank 3 matrix, the randomized SVD recovers it exactly */
+        size_t row = 40;
+        size_t col = 12;
+        vector <double> values(row * col);
+        for (auto j = 0; j < col; j++) {
+            for (auto i = 0; i < row; i++) {
+                values[ i + ( j * row ) ] =
+                    sin(i + 1.0) * ( j + 1 ) + cos(2.0 * i) * ( j % 3 ) +
+                    ( i % 5 ) * 0.5 * ( col - j ) + 3;
+            }
+        }
+        DataType a(values, DOUBLE);
+        a.ToMatrix(row, col);
+
+        DataType d_exact(DOUBLE);
+        DataType u_exact(DOUBLE);
+        DataType v_exact(DOUBLE);
+        linear::SVD <double>(a, d_exact, u_exact, v_exact, col, col);
+
+        DataType d(DOUBLE);
+        DataType u(DOUBLE);
+        DataType v(DOUBLE);
+        linear::RandomizedSVD <double>(a, d, u, v, 3, 2, 1);
+
+        REQUIRE(d.GetSize() == 3);
+        REQUIRE(u.GetNRow() == row);
+        REQUIRE(u.GetNCol() == 3);
+        REQUIRE(v.GetNRow() == col);
+        REQUIRE(v.GetNCol() == 3);
+
+        for (auto i = 0; i < 3; i++) {
+            REQUIRE(fabs(d.GetVal(i) - d_exact.GetVal(i)) <
+                    1e-8 * d_exact.GetVal(0));
+        }
+
+        for (auto j = 0; j < col; j++) {
+            for (auto i = 0; i < row; i++) {
+                double val = 0;
+                for (auto k = 0; k < 3; k++) {
+                    val += u.GetValMatrix(i, k) * d.GetVal(k) *
+                           v.GetValMatrix(j, k);
+                }
+                REQUIRE(fabs(val - a.GetValMatrix(i, j)) < 1e-8);
+            }
+        }
+
+        /* VT and single precision */
+        DataType a_float(a, FLOAT);
+        DataType d_float(FLOAT);
+        DataType u_float(FLOAT);
+        DataType vt_float(FLOAT);
+        SIMPLE_DISPATCH(FLOAT, linear::RandomizedSVD, a_float, d_float, u_float,
+                        vt_float, 2, 5, 2, false)
+        REQUIRE(vt_float.GetNRow() == 2);
+        REQUIRE(vt_float.GetNCol() == col);
+        for (auto i = 0; i < 2; i++) {
+            REQUIRE(fabs(d_float.GetVal(i) - d_exact.GetVal(i)) <
+                    1e-4 * d_exact.GetVal(0));
+        }
+
+        REQUIRE_THROWS(linear::RandomizedSVD <double>(a, d, u, v, 0));
+        REQUIRE_THROWS(linear::RandomizedSVD <double>(a, d, u, v, col + 1));
+
+        cout << "Testing Randomized PCA ..." << endl;
+
+        DataType sdev(DOUBLE);
+        DataType rotation(DOUBLE);
+        DataType center(DOUBLE);
+        DataType scores(DOUBLE);
+        linear::PrincipalComponents <double>(a, sdev, rotation, center,
+                                             scores, 3);
+
+        /* Validate against the exact SVD of the explicitly centered data */
+        DataType centered = a;
+        for (auto j = 0; j < col; j++) {
+            double mean = 0;
+            for (auto i = 0; i < row; i++) {
+                mean += a.GetValMatrix(i, j);
+            }
+            mean /= row;
+            REQUIRE(fabs(center.GetVal(j) - mean) < 1e-10);
+            for (auto i = 0; i < row; i++) {
+                centered.SetValMatrix(i, j, a.GetValMatrix(i, j) - mean);
+            }
+        }
+        linear::SVD <double>(centered, d_exact, u_exact, v_exact, col,
+                             col);
+
+        for (auto i = 0; i < 3; i++) {
+            REQUIRE(fabs(sdev.GetVal(i) -
+                         d_exact.GetVal(i) / sqrt(row - 1.0)) < 1e-8);
+        }
+
+        REQUIRE(scores.GetNRow() == row);
+        REQUIRE(scores.GetNCol() == 3);
+        for (auto k = 0; k < 3; k++) {
+            for (auto i = 0; i < row; i++) {
+                double val = 0;
+                for (auto j = 0; j < col; j++) {
+                    val += centered.GetValMatrix(i, j) *
+                           rotation.GetValMatrix(j, k);
+                }
+                REQUIRE(fabs(val - scores.GetValMatrix(i, k)) < 1e-8);
+            }
+        }
+
+        linear::PrincipalComponents <double>(a, sdev, rotation, center,
+                                             scores, 2, false);
+        REQUIRE(center.GetSize() == 0);
+        REQUIRE(sdev.GetSize() == 2);
 
     }SECTION("Eigen") {
         cout << "Testing Eigen ..." << endl;
@@ -422,6 +1454,323 @@ TEST_LINEAR_ALGEBRA() {
                 (float) validate_values[ i ];
             REQUIRE(val <= err);
         }
+    }SECTION("Partial Eigen") {
+        cout << "Testing Partial Eigen ..." << endl;
+
+        size_t n = 60;
+        vector <double> values(n * n);
+        for (auto j = 0; j < n; j++) {
+            for (auto i = 0; i < n; i++) {
+                values[ i + ( j * n ) ] =
+                    1.0 / ( i + j + 1 ) + ( i == j ) * ( i + 1.0 );
+            }
+        }
+        DataType a(values, DOUBLE);
+        a.ToMatrix(n, n);
+
+        DataType validate_values(DOUBLE);
+        DataType validate_vectors(DOUBLE);
+        linear::Eigen <double>(a, validate_values, &validate_vectors);
+
+        /* Syevr selection by index */
+        DataType eigen_values(DOUBLE);
+        DataType eigen_vectors(DOUBLE);
+        linear::EigenRange <double>(a, eigen_values, &eigen_vectors, 3, 7);
+
+        REQUIRE(eigen_values.GetSize() == 5);
+        REQUIRE(eigen_vectors.GetNRow() == n);
+        REQUIRE(eigen_vectors.GetNCol() == 5);
+        for (auto i = 0; i < 5; i++) {
+            REQUIRE(fabs(eigen_values.GetVal(i) -
+                         validate_values.GetVal(i + 2)) < 1e-10);
+            for (auto r = 0; r < n; r++) {
+                REQUIRE(fabs(fabs(eigen_vectors.GetValMatrix(r, i)) -
+                             fabs(validate_vectors.GetValMatrix(r, i + 2))) <
+                        1e-8);
+            }
+        }
+
+        linear::EigenRange <double>(a, eigen_values, nullptr, n - 1, n);
+        REQUIRE(eigen_values.GetSize() == 2);
+        REQUIRE(fabs(eigen_values.GetVal(1) - validate_values.GetVal(n - 1)) <
+                1e-10);
+
+        REQUIRE_THROWS(
+            linear::EigenRange <double>(a, eigen_values, nullptr, 0, 2));
+        REQUIRE_THROWS(
+            linear::EigenRange <double>(a, eigen_values, nullptr, 4, 3));
+
+        /* Lanczos , largest and smallest */
+        linear::Lanczos <double>(a, eigen_values, &eigen_vectors, 4, true);
+        REQUIRE(eigen_values.GetSize() == 4);
+        for (auto i = 0; i < 4; i++) {
+            REQUIRE(fabs(eigen_values.GetVal(i) - validate_values.GetVal(i)) <
+                    1e-6);
+            for (auto r = 0; r < n; r++) {
+                REQUIRE(fabs(fabs(eigen_vectors.GetValMatrix(r, i)) -
+                             fabs(validate_vectors.GetValMatrix(r, i))) <
+                        1e-5);
+            }
+        }
+
+        linear::Lanczos <double>(a, eigen_values, nullptr, 3, false);
+        for (auto i = 0; i < 3; i++) {
+            REQUIRE(fabs(eigen_values.GetVal(i) -
+                         validate_values.GetVal(n - 3 + i)) < 1e-6);
+        }
+
+        /* Float storage */
+        DataType a_float(a, FLOAT);
+        DataType values_float(FLOAT);
+        SIMPLE_DISPATCH(FLOAT, linear::Lanczos, a_float, values_float,
+                        nullptr, 2, true, 1e-5)
+        for (auto i = 0; i < 2; i++) {
+            REQUIRE(fabs(values_float.GetVal(i) - validate_values.GetVal(i)) <
+                    1e-3);
+        }
+
+        REQUIRE_THROWS(linear::Lanczos <double>(a, eigen_values, nullptr, 0));
+
+    }SECTION("Least Squares") {
+        cout << "Testing Least Squares ..." << endl;
+
+        size_t n = 50;
+        size_t p = 4;
+        vector <double> values(n * p);
+        vector <double> values_y(n * 2);
+        vector <double> values_w(n);
+        for (auto i = 0; i < n; i++) {
+            auto t = i / 10.0;
+            values[ i ] = 1;
+            values[ i + n ] = t;
+            values[ i + ( 2 * n ) ] = sin(t);
+            values[ i + ( 3 * n ) ] = cos(3 * t);
+            values_y[ i ] = 2 - t + 0.5 * sin(t) + 0.01 * ( i % 7 );
+            values_y[ i + n ] = t * t;
+            values_w[ i ] = 1 + ( i % 3 );
+        }
+        DataType x(values, DOUBLE);
+        x.ToMatrix(n, p);
+        DataType y(values_y, DOUBLE);
+        y.ToMatrix(n, 2);
+        DataType weights(values_w, DOUBLE);
+
+        /* t(X) W (Y - X B) - lambda B must vanish at the solution */
+        auto check_stationary = [ & ](DataType &aCoefficients,
+                                      DataType &aResiduals, DataType *apWeights,
+                                      const double &aLambda,
+                                      const double &aError) {
+            for (auto k = 0; k < 2; k++) {
+                for (auto j = 0; j < p; j++) {
+                    double val = -aLambda * aCoefficients.GetValMatrix(j, k);
+                    for (auto i = 0; i < n; i++) {
+                        auto w = apWeights ? apWeights->GetVal(i) : 1;
+                        val += x.GetValMatrix(i, j) * w *
+                               aResiduals.GetValMatrix(i, k);
+                    }
+                    REQUIRE(fabs(val) < aError);
+                }
+            }
+        };
+
+        DataType coefficients(DOUBLE);
+        DataType residuals(DOUBLE);
+        DataType validate(DOUBLE);
+        size_t rank = 0;
+
+        for (auto &method: {"auto", "qr", "chol"}) {
+            for (auto lambda: {0.0, 2.5}) {
+                SIMPLE_DISPATCH(DOUBLE, linear::LeastSquares, x, y, nullptr,
+                                coefficients, residuals, rank, lambda, method)
+                REQUIRE(rank == p);
+                REQUIRE(coefficients.GetNRow() == p);
+                REQUIRE(coefficients.GetNCol() == 2);
+                REQUIRE(residuals.GetNRow() == n);
+                check_stationary(coefficients, residuals, nullptr, lambda,
+                                 1e-9);
+
+                SIMPLE_DISPATCH(DOUBLE, linear::LeastSquares, x, y, &weights,
+                                coefficients, residuals, rank, lambda, method)
+                check_stationary(coefficients, residuals, &weights, lambda,
+                                 1e-9);
+            }
+        }
+
+        /* Single precision factors refined with double residuals */
+        SIMPLE_DISPATCH(DOUBLE, linear::LeastSquares, x, y, &weights,
+                        validate, residuals, rank, 0.0, "qr")
+        for (auto &method: {"qr", "chol"}) {
+            SIMPLE_DISPATCH(DOUBLE, linear::LeastSquares, x, y, &weights,
+                            coefficients, residuals, rank, 0.0, method,
+                            "Single")
+            for (auto i = 0; i < coefficients.GetSize(); i++) {
+                REQUIRE(fabs(coefficients.GetVal(i) - validate.GetVal(i)) <
+                        1e-10);
+            }
+        }
+
+        /* Rank deficient X falls back to the QR path */
+        DataType x_deficient(values, DOUBLE);
+        x_deficient.ToMatrix(n, p);
+        for (auto i = 0; i < n; i++) {
+            x_deficient.SetValMatrix(i, 3, 2 * x.GetValMatrix(i, 1));
+        }
+        DataType y_vector(values_y, DOUBLE);
+        y_vector.ToVector();
+        vector <double> values_head(values_y.begin(), values_y.begin() + n);
+        DataType y_head(values_head, FLOAT);
+        SIMPLE_DISPATCH(DOUBLE, linear::LeastSquares, x_deficient, y_head,
+                        nullptr, coefficients, residuals, rank)
+        REQUIRE(rank == 3);
+        REQUIRE(!coefficients.IsMatrix());
+        REQUIRE(coefficients.GetSize() == p);
+        auto aliased = 0;
+        for (auto j = 0; j < p; j++) {
+            aliased += std::isnan(coefficients.GetVal(j));
+        }
+        REQUIRE(aliased == 1);
+        for (auto j = 0; j < p; j++) {
+            double val = 0;
+            for (auto i = 0; i < n; i++) {
+                val += x_deficient.GetValMatrix(i, j) * residuals.GetVal(i);
+            }
+            REQUIRE(fabs(val) < 1e-5);
+        }
+
+        REQUIRE_THROWS(linear::LeastSquares <double>(x_deficient, y_head,
+                                                     nullptr, coefficients,
+                                                     residuals, rank, 0,
+                                                     "svd"));
+        REQUIRE_THROWS(linear::LeastSquares <double>(x, y_vector, nullptr,
+                                                     coefficients, residuals,
+                                                     rank));
+        REQUIRE_THROWS(linear::LeastSquares <double>(x, y, nullptr,
+                                                     coefficients, residuals,
+                                                     rank, 0, "qr", "quad"));
+        weights.SetVal(3, -1);
+        REQUIRE_THROWS(linear::LeastSquares <double>(x, y, &weights,
+                                                     coefficients, residuals,
+                                                     rank));
+
+    }SECTION("TSQR") {
+        cout << "Testing TSQR ..." << endl;
+
+        size_t n = 3000;
+        size_t p = 6;
+        vector <double> values(n * p);
+        vector <double> values_y(n * 2);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < p; j++) {
+                values[ i + ( j * n ) ] = sin(( i + 1.0 ) * ( j + 1 )) + j;
+            }
+            values_y[ i ] = cos(i / 100.0);
+            values_y[ i + n ] = i / 1000.0;
+        }
+        DataType x(values, DOUBLE);
+        x.ToMatrix(n, p);
+        DataType y(values_y, DOUBLE);
+        y.ToMatrix(n, 2);
+
+        DataType gram(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, x, x, gram, true, false)
+
+        DataType coefficients(DOUBLE);
+        DataType residuals(DOUBLE);
+        size_t rank;
+        SIMPLE_DISPATCH(DOUBLE, linear::LeastSquares, x, y, nullptr,
+                        coefficients, residuals, rank, 0.0, "qr")
+
+        for (auto block_rows: {0, 400, 1000, 5000}) {
+            DataType r(DOUBLE);
+            DataType q(DOUBLE);
+            DataType qty(DOUBLE);
+            DataType gram_r(DOUBLE);
+            DataType product(DOUBLE);
+            DataType identity(DOUBLE);
+            DataType solution(DOUBLE);
+            DataType solution_q(DOUBLE);
+
+            /* R only, t(Q) y from the augmented factorization */
+            SIMPLE_DISPATCH(DOUBLE, linear::TSQR, x, r, nullptr, &y, &qty,
+                            block_rows)
+            REQUIRE(r.GetNRow() == p);
+            REQUIRE(qty.GetNCol() == 2);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, r, r, gram_r, true,
+                            false)
+            for (auto i = 0; i < gram.GetSize(); i++) {
+                REQUIRE(fabs(gram_r.GetVal(i) - gram.GetVal(i)) <
+                        1e-10 * fabs(gram.GetVal(0)));
+            }
+            for (auto j = 0; j < p; j++) {
+                for (auto i = j + 1; i < p; i++) {
+                    REQUIRE(r.GetValMatrix(i, j) == 0);
+                }
+            }
+            SIMPLE_DISPATCH(DOUBLE, linear::BackSolve, r, qty, solution, p,
+                            true, false)
+            for (auto i = 0; i < coefficients.GetSize(); i++) {
+                REQUIRE(fabs(solution.GetVal(i) - coefficients.GetVal(i)) <
+                        1e-9);
+            }
+
+            /* Explicit Q */
+            SIMPLE_DISPATCH(DOUBLE, linear::TSQR, x, r, &q, &y, &qty,
+                            block_rows)
+            REQUIRE(q.GetNRow() == n);
+            REQUIRE(q.GetNCol() == p);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, q, r, product,
+                            false, false)
+            double error = 0;
+            for (auto i = 0; i < x.GetSize(); i++) {
+                error = std::max(error, fabs(product.GetVal(i) - x.GetVal(i)));
+            }
+            REQUIRE(error < 1e-10);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, q, q, identity, true,
+                            false)
+            for (auto j = 0; j < p; j++) {
+                for (auto i = 0; i < p; i++) {
+                    REQUIRE(fabs(identity.GetValMatrix(i, j) - ( i == j )) <
+                            1e-12);
+                }
+            }
+            SIMPLE_DISPATCH(DOUBLE, linear::BackSolve, r, qty, solution_q, p,
+                            true, false)
+            for (auto i = 0; i < coefficients.GetSize(); i++) {
+                REQUIRE(fabs(solution_q.GetVal(i) - coefficients.GetVal(i)) <
+                        1e-9);
+            }
+
+            /* The implicit t(Q) y matches the product with the formed Q */
+            DataType qty_formed(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, q, y, qty_formed,
+                            true, false)
+            for (auto i = 0; i < qty.GetSize(); i++) {
+                REQUIRE(fabs(qty.GetVal(i) - qty_formed.GetVal(i)) <
+                        1e-10 * ( 1 + fabs(qty_formed.GetVal(i)) ));
+            }
+        }
+
+        DataType x_float(values, FLOAT);
+        x_float.ToMatrix(n, p);
+        DataType r_float(FLOAT);
+        DataType q_float(FLOAT);
+        SIMPLE_DISPATCH(FLOAT, linear::TSQR, x_float, r_float, &q_float,
+                        nullptr, nullptr, 700)
+        DataType validate(FLOAT);
+        SIMPLE_DISPATCH(FLOAT, linear::CrossProduct, q_float, r_float,
+                        validate, false, false)
+        double error = 0;
+        for (auto i = 0; i < x.GetSize(); i++) {
+            error = std::max(error, fabs(validate.GetVal(i) - x.GetVal(i)));
+        }
+        REQUIRE(error < 1e-4);
+
+        DataType x_wide(values, DOUBLE);
+        x_wide.ToMatrix(p, n);
+        REQUIRE_THROWS(
+            linear::TSQR <double>(x_wide, r_float, nullptr, nullptr, nullptr));
+        REQUIRE_THROWS(linear::TSQR <double>(x, r_float, nullptr, &y, nullptr));
+
     }SECTION("Norm") {
         cout << "Testing Norm ..." << endl;
 
@@ -449,6 +1798,66 @@ TEST_LINEAR_ALGEBRA() {
         auto val = fabs(norm_val - 19.87461) / 19.87461;
         REQUIRE(val <= 0.001);
 
+        /* Several row blocks and columns per thread, with negative values */
+        size_t row = 700;
+        size_t col = 90;
+        vector <double> values_large(row * col);
+        vector <double> row_sums(row, 0);
+        double column_max = 0;
+        double max_mod = 0;
+        double sum_squares = 0;
+        for (auto j = 0; j < col; j++) {
+            double column_sum = 0;
+            for (auto i = 0; i < row; i++) {
+                auto value = sin(0.37 * i + 1.3 * j) * ( 1 + ( i % 7 ));
+                values_large[ i + ( j * row ) ] = value;
+                row_sums[ i ] += fabs(value);
+                column_sum += fabs(value);
+                max_mod = std::max(max_mod, fabs(value));
+                sum_squares += value * value;
+            }
+            column_max = std::max(column_max, column_sum);
+        }
+        auto row_max = *std::max_element(row_sums.begin(), row_sums.end());
+
+        DataType large(values_large, DOUBLE);
+        large.ToMatrix(row, col);
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "1", norm_val)
+        REQUIRE(fabs(norm_val - column_max) <= 1e-12 * column_max);
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "I", norm_val)
+        REQUIRE(fabs(norm_val - row_max) <= 1e-12 * row_max);
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "M", norm_val)
+        REQUIRE(norm_val == max_mod);
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "E", norm_val)
+        REQUIRE(fabs(norm_val - sqrt(sum_squares)) <=
+                1e-12 * sqrt(sum_squares));
+
+        /* Spectral norm against the largest singular value */
+        DataType s(DOUBLE);
+        DataType u(DOUBLE);
+        DataType v(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::SVD, large, s, u, v, col, col)
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "2", norm_val)
+        REQUIRE(fabs(norm_val - s.GetVal(0)) <= 1e-10 * s.GetVal(0));
+
+        large.LazyTranspose();
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "2", norm_val)
+        REQUIRE(fabs(norm_val - s.GetVal(0)) <= 1e-10 * s.GetVal(0));
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, large, "I", norm_val)
+        REQUIRE(fabs(norm_val - column_max) <= 1e-12 * column_max);
+        REQUIRE(large.IsTransposed());
+
+        SIMPLE_DISPATCH(FLOAT, linear::Norm, a, "2", norm_val)
+        REQUIRE(fabs(norm_val - 19.82171) / 19.82171 <= 0.001);
+
+        vector <double> values_zeros(12, 0);
+        DataType zeros(values_zeros, DOUBLE);
+        zeros.ToMatrix(4, 3);
+        SIMPLE_DISPATCH(DOUBLE, linear::Norm, zeros, "2", norm_val)
+        REQUIRE(norm_val == 0);
+
+        REQUIRE_THROWS(linear::Norm <double>(zeros, "X", norm_val));
+
     }SECTION("QR Decomposition") {
         cout << "Testing QR Decomposition ..." << endl;
         vector <double> values = {1, 2, 3, 2, 4, 6, 3, 3, 3};
@@ -569,6 +1978,50 @@ TEST_LINEAR_ALGEBRA() {
             REQUIRE(output_temp.GetVal(i) == values[ i ]);
         }
 
+        cout << "Testing QR.QY and QR.QTY ..." << endl;
+
+        values = {1, -2, 0.5, 4, 0, 3};
+        DataType y(values, DOUBLE);
+        y.ToMatrix(3, 2);
+
+        DataType qy(DOUBLE);
+        DataType validate(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::QRDecompositionQY, qr, qraux, y, qy,
+                        false)
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, q, y, validate, false,
+                        false)
+        REQUIRE(qy.GetNRow() == 3);
+        REQUIRE(qy.GetNCol() == 2);
+        for (auto i = 0; i < qy.GetSize(); i++) {
+            REQUIRE(fabs(qy.GetVal(i) - validate.GetVal(i)) < 1e-10);
+        }
+
+        /* t(Q) Q y = y */
+        DataType qty(DOUBLE);
+        DataType y_vector(values, FLOAT);
+        SIMPLE_DISPATCH(DOUBLE, linear::QRDecompositionQY, qr, qraux, qy,
+                        qty, true)
+        for (auto i = 0; i < qty.GetSize(); i++) {
+            REQUIRE(fabs(qty.GetVal(i) - y.GetVal(i)) < 1e-10);
+        }
+
+        REQUIRE_THROWS(
+            linear::QRDecompositionQY <double>(qr, qraux, y_vector, qty, true));
+
+        values = {1, -2, 0.5};
+        DataType y_short(values, FLOAT);
+        SIMPLE_DISPATCH(DOUBLE, linear::QRDecompositionQY, qr, qraux, y_short,
+                        qty, true)
+        REQUIRE(!qty.IsMatrix());
+        REQUIRE(qty.GetSize() == 3);
+        for (auto i = 0; i < 3; i++) {
+            auto val = 0.0;
+            for (auto j = 0; j < 3; j++) {
+                val += q.GetValMatrix(j, i) * values[ j ];
+            }
+            REQUIRE(fabs(qty.GetVal(i) - val) < 1e-6);
+        }
+
 
     }SECTION("Testing R Cond") {
 
@@ -604,6 +2057,107 @@ TEST_LINEAR_ALGEBRA() {
 
         val = fabs(b - 1.334e-05) / 1.334e-05;
         REQUIRE(val <= 0.001);
+    }SECTION("Testing Sparse Multiplication") {
+
+        cout << "Testing Sparse Multiplication ..." << endl;
+
+        /* 5x4 sparse matrix with an empty row and a duplicated entry */
+        vector <size_t> row_idx = {0, 0, 1, 3, 3, 4, 0};
+        vector <size_t> col_idx = {0, 3, 1, 0, 2, 3, 0};
+        vector <double> sparse_vals = {2, -1, 3, 4, 0.5, 6, 1};
+
+        vector <double> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        DataType b(values, DOUBLE);
+        b.ToMatrix(4, 3);
+
+        vector <double> values_c = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                    13, 14, 15};
+        DataType c(values_c, DOUBLE);
+        c.ToMatrix(5, 3);
+
+        for (auto format : {SparseFormat::CSR, SparseFormat::CSC}) {
+            SparseDataType a(row_idx, col_idx, sparse_vals, 5, 4, DOUBLE,
+                             format);
+            DataType dense(DOUBLE);
+            a.ToDense(dense);
+
+            /* A %*% B */
+            DataType output(DOUBLE);
+            DataType validate(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, b, output, false,
+                            false)
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, dense, b, validate,
+                            false, false)
+            REQUIRE(output.GetNRow() == 5);
+            REQUIRE(output.GetNCol() == 3);
+            for (auto i = 0; i < validate.GetSize(); i++) {
+                REQUIRE(output.GetVal(i) == validate.GetVal(i));
+            }
+
+            /* t(A) %*% C */
+            DataType validate_t(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, c, output, true,
+                            false)
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, dense, c,
+                            validate_t, true, false)
+            REQUIRE(output.GetNRow() == 4);
+            REQUIRE(output.GetNCol() == 3);
+            for (auto i = 0; i < validate_t.GetSize(); i++) {
+                REQUIRE(output.GetVal(i) == validate_t.GetVal(i));
+            }
+
+            /* A %*% t(t(B)) with a lazily transposed B */
+            DataType b_t(b);
+            b_t.LazyTranspose();
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, b_t, output,
+                            false, true)
+            for (auto i = 0; i < validate.GetSize(); i++) {
+                REQUIRE(output.GetVal(i) == validate.GetVal(i));
+            }
+
+            /* t(C) %*% A , dense on the left */
+            DataType validate_d(DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, c, a, output, true,
+                            false)
+            SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, c, dense,
+                            validate_d, true, false)
+            REQUIRE(output.GetNRow() == 3);
+            REQUIRE(output.GetNCol() == 4);
+            for (auto i = 0; i < 3; i++) {
+                for (auto j = 0; j < 4; j++) {
+                    REQUIRE(output.GetValMatrix(i, j) ==
+                            validate_d.GetValMatrix(i, j));
+                }
+            }
+
+            /* SpMV */
+            vector <double> values_x = {1, -1, 2, 0.5};
+            DataType x(values_x, DOUBLE);
+            SIMPLE_DISPATCH(DOUBLE, linear::SparseMultiply, a, x, output,
+                            false, false, 2, 0)
+            vector <double> validate_y = {5, -6, 0, 10, 6};
+            REQUIRE(output.GetNRow() == 5);
+            REQUIRE(output.GetNCol() == 1);
+            for (auto i = 0; i < validate_y.size(); i++) {
+                REQUIRE(output.GetVal(i) == validate_y[ i ]);
+            }
+
+            /* alpha and beta accumulation */
+            SIMPLE_DISPATCH(DOUBLE, linear::SparseMultiply, a, x, output,
+                            false, false, 1, 1)
+            for (auto i = 0; i < validate_y.size(); i++) {
+                REQUIRE(output.GetVal(i) == 1.5 * validate_y[ i ]);
+            }
+
+            REQUIRE_THROWS(
+                linear::SparseMultiply <double>(a, c, output, false, false));
+
+            DataType b_float(values, FLOAT);
+            b_float.ToMatrix(4, 3);
+            REQUIRE_THROWS(
+                linear::SparseMultiply <double>(a, b_float, output, false,
+                                                false));
+        }
     }
 }
 
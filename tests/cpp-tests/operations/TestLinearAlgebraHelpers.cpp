@@ -302,20 +302,20 @@ TEST_LINEAR_ALGEBRA_HELPERS() {
         b_non_symmetric.ToMatrix(3, 3);
 
         auto output = false;
-        helper_host->IsSymmetric(a_symmetric, output, nullptr);
+        helper_host->IsSymmetric(a_symmetric, output, 0, nullptr);
         REQUIRE(output == true);
 
 
-        helper_host->IsSymmetric(b_non_symmetric, output, nullptr);
+        helper_host->IsSymmetric(b_non_symmetric, output, 0, nullptr);
         REQUIRE(output == false);
 
         auto output_dev = false;
-        helper_dev->IsSymmetric(a_symmetric, output_dev,
+        helper_dev->IsSymmetric(a_symmetric, output_dev, 0,
                                 mpcr::kernels::ContextManager::GetGPUContext());
         REQUIRE(output_dev == true);
 
 
-        helper_dev->IsSymmetric(b_non_symmetric, output_dev,
+        helper_dev->IsSymmetric(b_non_symmetric, output_dev, 0,
                                 mpcr::kernels::ContextManager::GetGPUContext());
         REQUIRE(output_dev == false);
 
@@ -303,6 +303,9 @@ TEST_MATH_OPERATIONS() {
             REQUIRE(b.GetVal(i) == log2((float) values[ i ]));
         }
 
+        REQUIRE_THROWS(math::Log <float>(a, b, 5));
+        REQUIRE(b.GetSize() == 4);
+
     }SECTION("Test Exponential") {
 
         cout << "Testing Exponential ..." << endl;
@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2023, King Abdullah University of Science and Technology
+ * All rights reserved.
+ *
+ * MPCR is an R package provided by the STSDS group at KAUST
+ *
+ **/
+
+#include <libraries/catch/catch.hpp>
+#include <utilities/MPCRDispatcher.hpp>
+#include <operations/LinearAlgebra.hpp>
+#include <operations/TileLinearAlgebra.hpp>
+
+
+using namespace std;
+using namespace mpcr::precision;
+using namespace mpcr::operations;
+
+
+vector <double>
+GenerateTileValues(const size_t &aSize, const size_t &aSeed) {
+    vector <double> values(aSize);
+    for (auto i = 0; i < aSize; i++) {
+        values[ i ] = (double) ( ( i * 7 + aSeed * 13 ) % 17 ) / 4 - 2;
+    }
+    return values;
+}
+
+
+void
+TEST_TILE_LINEAR_ALGEBRA() {
+
+    SECTION("Tile GEMM") {
+        cout << "Testing Tile GEMM ..." << endl;
+
+        auto values_a = GenerateTileValues(35, 1);
+        auto values_b = GenerateTileValues(30, 2);
+        auto values_c = GenerateTileValues(42, 3);
+
+        DataType a(values_a, DOUBLE);
+        a.ToMatrix(7, 5);
+        DataType b(values_b, DOUBLE);
+        b.ToMatrix(5, 6);
+        DataType c(values_c, DOUBLE);
+        c.ToMatrix(7, 6);
+
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, b, c, false, false,
+                        true, 2, 0.5)
+
+        MPCRTile tile_a(7, 5, 3, 2, values_a, {"double"});
+        MPCRTile tile_b(5, 6, 2, 4, values_b, {"double"});
+        MPCRTile tile_c(7, 6, 3, 4, values_c, {"double"});
+
+        tile::TileGemm(tile_a, tile_b, tile_c, false, false, 2, 0.5);
+
+        for (auto i = 0; i < 7; i++) {
+            for (auto j = 0; j < 6; j++) {
+                REQUIRE(fabs(tile_c.GetVal(i, j) - c.GetValMatrix(i, j)) <
+                        1e-10);
+            }
+        }
+
+        /* Mixed precision tiles with transposed inputs */
+        vector <double> values_at(35);
+        vector <double> values_bt(30);
+        for (auto i = 0; i < 7; i++) {
+            for (auto j = 0; j < 5; j++) {
+                values_at[ j + ( i * 5 ) ] = values_a[ i + ( j * 7 ) ];
+            }
+        }
+        for (auto i = 0; i < 5; i++) {
+            for (auto j = 0; j < 6; j++) {
+                values_bt[ j + ( i * 6 ) ] = values_b[ i + ( j * 5 ) ];
+            }
+        }
+
+        MPCRTile tile_at(5, 7, 2, 3, values_at,
+                         {"float", "double", "float", "double", "float",
+                          "double", "float", "double", "float"});
+        MPCRTile tile_bt(6, 5, 4, 2, values_bt, {"float"});
+        MPCRTile tile_ct(7, 6, 3, 4, values_c,
+                         {"double", "float", "float", "float", "double",
+                          "float"});
+
+        tile::TileGemm(tile_at, tile_bt, tile_ct, true, true, 2, 0.5);
+
+        for (auto i = 0; i < 7; i++) {
+            for (auto j = 0; j < 6; j++) {
+                REQUIRE(fabs(tile_ct.GetVal(i, j) - c.GetValMatrix(i, j)) <
+                        1e-4);
+            }
+        }
+
+        REQUIRE_THROWS(tile::TileGemm(tile_a, tile_a, tile_c, false, false,
+                                      1, 0));
+        MPCRTile tile_wrong(5, 6, 3, 4, values_b, {"double"});
+        REQUIRE_THROWS(tile::TileGemm(tile_a, tile_wrong, tile_c, false,
+                                      false, 1, 0));
+    }
+
+    SECTION("Tile TRSM") {
+        cout << "Testing Tile TRSM ..." << endl;
+
+        auto n = 6;
+        auto values = GenerateTileValues(n * n, 4);
+        for (auto i = 0; i < n; i++) {
+            values[ i + ( i * n ) ] = 10 + i;
+        }
+
+        for (auto upper: {true, false}) {
+            /* Dense triangular copy of A used for validation */
+            auto values_tri = values;
+            for (auto i = 0; i < n; i++) {
+                for (auto j = 0; j < n; j++) {
+                    if (( upper && i > j ) || ( !upper && i < j )) {
+                        values_tri[ i + ( j * n ) ] = 0;
+                    }
+                }
+            }
+            DataType a(values_tri, DOUBLE);
+            a.ToMatrix(n, n);
+
+            for (auto left: {true, false}) {
+                for (auto transpose: {true, false}) {
+                    auto row_b = left ? n : 4;
+                    auto col_b = left ? 4 : n;
+                    auto values_b = GenerateTileValues(row_b * col_b, 5);
+
+                    MPCRTile tile_a(n, n, 2, 2, values,
+                                    {"double", "float", "double", "float",
+                                     "double", "float", "double", "float",
+                                     "double"});
+                    MPCRTile tile_b(row_b, col_b, left ? 2 : 3,
+                                    left ? 3 : 2, values_b, {"double"});
+
+                    tile::TileTrsm(tile_a, tile_b, left, upper, transpose,
+                                   2);
+
+                    DataType x(DOUBLE);
+                    tile_b.GetMatrix(x, DOUBLE);
+                    DataType validate(DOUBLE);
+
+                    if (left) {
+                        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, x,
+                                        validate, transpose, false)
+                    } else {
+                        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, x, a,
+                                        validate, false, transpose)
+                    }
+
+                    for (auto i = 0; i < values_b.size(); i++) {
+                        REQUIRE(fabs(validate.GetVal(i) -
+                                     2 * values_b[ i ]) < 1e-4);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Tile SYRK") {
+        cout << "Testing Tile SYRK ..." << endl;
+
+        auto values_a = GenerateTileValues(24, 6);
+        auto values_c = GenerateTileValues(36, 7);
+
+        DataType a(values_a, DOUBLE);
+        a.ToMatrix(6, 4);
+        DataType validate(values_c, DOUBLE);
+        validate.ToMatrix(6, 6);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, a, validate, false,
+                        true, true, 0.5, 2)
+
+        MPCRTile tile_a(6, 4, 2, 3, values_a, {"double"});
+        MPCRTile tile_c(6, 6, 2, 2, values_c,
+                        {"double", "float", "float", "float", "double",
+                         "float", "float", "float", "double"});
+
+        tile::TileSyrk(tile_a, tile_c, false, 0.5, 2);
+
+        for (auto i = 0; i < 6; i++) {
+            for (auto j = 0; j < 6; j++) {
+                if (i >= j) {
+                    REQUIRE(fabs(tile_c.GetVal(i, j) -
+                                 validate.GetValMatrix(i, j)) < 1e-4);
+                } else {
+                    REQUIRE(tile_c.GetVal(i, j) == values_c[ i + ( j * 6 ) ]);
+                }
+            }
+        }
+
+        /* t(A) %*% A */
+        DataType validate_t(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::CrossProduct, a, a, validate_t, true,
+                        false)
+        MPCRTile tile_ct(4, 4, 3, 3, GenerateTileValues(16, 8), {"double"});
+        tile::TileSyrk(tile_a, tile_ct, true, 1, 0);
+
+        for (auto i = 0; i < 4; i++) {
+            for (auto j = 0; j <= i; j++) {
+                REQUIRE(fabs(tile_ct.GetVal(i, j) -
+                             validate_t.GetValMatrix(i, j)) < 1e-10);
+            }
+        }
+
+        REQUIRE_THROWS(tile::TileSyrk(tile_a, tile_a, false, 1, 0));
+    }
+
+    SECTION("Tile Cholesky") {
+        cout << "Testing Tile Cholesky ..." << endl;
+
+        /* Exponentially decaying covariance matrix */
+        auto n = 12;
+        vector <double> values(n * n);
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j < n; j++) {
+                values[ i + ( j * n ) ] = exp(-2.0 * fabs(i - j));
+            }
+        }
+
+        DataType a(values, DOUBLE);
+        a.ToMatrix(n, n);
+        DataType validate(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, validate, false)
+
+        MPCRTile tile_a(n, n, 3, 3, values, {"double"});
+        vector <double> flops;
+        tile::TileCholesky(tile_a, flops);
+
+        REQUIRE(flops[ 0 ] == 0);
+        REQUIRE(flops[ 1 ] == 0);
+        REQUIRE(fabs(flops[ 2 ] - ( n * n * n / 3.0 )) < 1e-6);
+
+        for (auto i = 0; i < n; i++) {
+            for (auto j = 0; j <= i; j++) {
+                REQUIRE(fabs(tile_a.GetVal(i, j) -
+                             validate.GetValMatrix(i, j)) < 1e-10);
+            }
+        }
+
+        DataType validate_upper(DOUBLE);
+        SIMPLE_DISPATCH(DOUBLE, linear::Cholesky, a, validate_upper, true)
+
+        for (auto tolerance: {0.0, 1e-10, 1e-4}) {
+            DataType output(DOUBLE);
+            double accuracy = 0;
+            vector <double> flop_share;
+            linear::Cholesky <double>(a, output, true, tolerance, 3, accuracy,
+                                      flop_share);
+
+            REQUIRE(flop_share[ 0 ] == 0);
+            REQUIRE(fabs(flop_share[ 1 ] + flop_share[ 2 ] - 1) < 1e-12);
+            if (tolerance == 0) {
+                REQUIRE(flop_share[ 2 ] == 1);
+                REQUIRE(accuracy < 1e-14);
+            } else {
+                REQUIRE(flop_share[ 1 ] > 0);
+                REQUIRE(accuracy < tolerance);
+                /* The estimate sees the error of the single precision tiles */
+                REQUIRE(accuracy > 1e-14);
+            }
+
+            for (auto i = 0; i < n * n; i++) {
+                REQUIRE(fabs(output.GetVal(i) - validate_upper.GetVal(i)) <
+                        1e-5);
+            }
+        }
+
+        /* Single precision input runs all the tiles in single precision */
+        DataType a_float(values, FLOAT);
+        a_float.ToMatrix(n, n);
+        DataType output_float(FLOAT);
+        double accuracy = 0;
+        vector <double> flop_share;
+        linear::Cholesky <float>(a_float, output_float, false, 0, 5, accuracy,
+                                 flop_share);
+        REQUIRE(output_float.GetPrecision() == FLOAT);
+        REQUIRE(flop_share[ 1 ] == 1);
+        REQUIRE(accuracy < 1e-5);
+
+        values[ 0 ] = -1;
+        MPCRTile tile_wrong(n, n, 3, 3, values, {"double"});
+        REQUIRE_THROWS(tile::TileCholesky(tile_wrong, flops));
+    }
+}
+
+
+TEST_CASE("TileLinearAlgebra", "[Tile Linear Algebra]") {
+    mpcr::kernels::ContextManager::GetOperationContext()->SetOperationPlacement(
+        CPU);
+    TEST_TILE_LINEAR_ALGEBRA();
+}